@@ -0,0 +1,134 @@
+// AudioBenchmark.cpp
+// Zombie audio under a horde. For N doubling from 1250 up to the limit, a fixed-seed World is
+// filled to N zombies (horde spawning, player kept alive), then played by the soak bot, which
+// shoots, so zombies are hit and die. Each tick ZombieVoices listens from the player and
+// VoiceScheduler picks the voices on the simulation clock, as the game does each frame. Alongside,
+// a second listener evaluates every zombie within earshot instead of the nearest maxSources.
+// Reports, per tick, the cost of both, the zombies the grid search examined and the ones
+// evaluated, and over the run the requests, culls, voices started and taken over, and the most
+// voices playing at once.
+// Exits 1 if a tick evaluates more than maxSources zombies, more than maxVoices ever play at once,
+// no voice ever starts, or the bounded cost per tick at the largest N is more than 4x the cost at
+// the smallest (it is meant to stay flat as the horde grows).
+//
+// Usage: audio_bench [maxZombies=20000] [ticks=600] [seed=1]
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "Bot.h"
+#include "ZombieVoices.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+struct RunResult {
+    double boundedUs = 0.0;   // Per tick
+    double unboundedUs = 0.0;
+    double examined = 0.0;
+    int maxEvaluated = 0;
+    double unboundedEvaluated = 0.0;
+    int maxActive = 0;
+    VoiceScheduler::Stats totals;
+};
+
+static RunResult Run(int zombieCount, int ticks, uint64_t seed) {
+    World world(1200.0f, 800.0f);
+    world.start(CreateMinigun(), seed);
+    world.setHordeMode(true);
+    world.waveDirector.setConfig(WaveConfig::Horde(zombieCount));
+    world.floor.zombies.reserve(zombieCount);
+
+    // Let the horde arrive before anyone shoots
+    PlayerInput idle = { { 0, 0 }, { world.width, world.height / 2 }, false, false };
+    for (int i = 0; i < 2400 && (int)world.floor.zombies.size() < zombieCount; ++i) {
+        world.player.health = world.player.maxHealth;
+        world.step(TICK_SECONDS, idle);
+    }
+
+    ZombieVoices voices;
+    VoiceScheduler scheduler;
+    ZombieVoices::Config everyone;
+    everyone.maxSources = 2 * zombieCount; // The whole horde, dying ones included
+    ZombieVoices allVoices(everyone);
+    VoiceScheduler allScheduler;
+    Bot bot(seed);
+
+    RunResult result;
+    for (int t = 0; t < ticks; ++t) {
+        world.player.health = world.player.maxHealth;
+        world.step(TICK_SECONDS, bot.think(world));
+
+        auto start = Clock::now();
+        voices.listen(world, world.player.pos, scheduler);
+        scheduler.schedule(world.time);
+        result.boundedUs += ElapsedUs(start);
+
+        start = Clock::now();
+        allVoices.listen(world, world.player.pos, allScheduler);
+        allScheduler.schedule(world.time);
+        result.unboundedUs += ElapsedUs(start);
+
+        result.examined += voices.getLastExamined();
+        result.maxEvaluated = std::max(result.maxEvaluated, voices.getLastEvaluated());
+        result.unboundedEvaluated += allVoices.getLastEvaluated();
+        result.maxActive = std::max(result.maxActive, scheduler.getActiveVoices(world.time));
+    }
+    result.boundedUs /= ticks;
+    result.unboundedUs /= ticks;
+    result.examined /= ticks;
+    result.unboundedEvaluated /= ticks;
+    result.totals = scheduler.getTotals();
+    return result;
+}
+
+int main(int argc, char** argv) {
+    int maxZombies = argc > 1 ? atoi(argv[1]) : 20000;
+    int ticks = argc > 2 ? atoi(argv[2]) : 600;
+    uint64_t seed = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1;
+    if (maxZombies < 1250) maxZombies = 1250;
+    if (ticks < 60) ticks = 60;
+
+    SetTraceLogLevel(LOG_WARNING);
+    ZombieVoices::Config voiceConfig;
+    VoiceScheduler::Config mixerConfig;
+    printf("Zombie audio: nearest %d zombies within %.0f px, %d voices, %d ticks per size, seed %llu\n",
+           voiceConfig.maxSources, voiceConfig.audibleDistance, mixerConfig.maxVoices, ticks, (unsigned long long)seed);
+    printf("  %7s %10s %9s %9s %14s %14s %8s %7s %7s %7s %7s %6s\n", "zombies", "bounded", "examined", "evaluated",
+           "all in earshot", "(evaluated)", "requests", "culled", "limited", "started", "stolen", "peak");
+
+    bool bounded = true, capped = true, heard = false;
+    double firstUs = 0.0, lastUs = 0.0;
+    for (int n = 1250; n <= maxZombies; n *= 2) {
+        RunResult r = Run(n, ticks, seed);
+        printf("  %7d %7.2f us %9.1f %9d %11.2f us %14.1f %8d %7d %7d %7d %7d %6d\n", n, r.boundedUs, r.examined,
+               r.maxEvaluated, r.unboundedUs, r.unboundedEvaluated, r.totals.requested, r.totals.culled,
+               r.totals.limited, r.totals.started, r.totals.stolen, r.maxActive);
+        bounded = bounded && r.maxEvaluated <= voiceConfig.maxSources;
+        capped = capped && r.maxActive <= mixerConfig.maxVoices;
+        heard = heard || r.totals.started > 0;
+        if (n == 1250) firstUs = r.boundedUs;
+        lastUs = r.boundedUs;
+    }
+
+    bool flat = lastUs <= 4.0 * firstUs;
+    if (!bounded || !capped || !heard || !flat) {
+        printf("FAILED: %s, %s, %s, bounded cost %.2f us at the largest horde vs %.2f us at the smallest\n",
+               bounded ? "evaluations bounded" : "a tick evaluated too many zombies",
+               capped ? "voices capped" : "too many voices at once", heard ? "voices started" : "nothing was heard",
+               lastUs, firstUs);
+        return 1;
+    }
+    printf("  At most %d zombies evaluated and %d voices playing per tick at any horde size\n", voiceConfig.maxSources,
+           mixerConfig.maxVoices);
+    return 0;
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Bit-granular counterparts of ByteWriter/ByteReader (NetProtocol.h), used by the snapshot codec.
+// Fields are packed LSB-first into a 64-bit accumulator and flushed to the caller's buffer
+// 32 bits at a time; overflow sets a flag instead of writing past the end.
+class BitWriter {
+public:
+    BitWriter(uint8_t* data, size_t capacity)
+        : data(data), capacity(capacity), size(0), scratch(0), scratchBits(0), overflow(false) {}
+
+    // Writes the low 'count' bits of 'value' (count 1..32)
+    void bits(uint32_t value, int count) {
+        uint64_t mask = (count == 32) ? 0xFFFFFFFFull : ((1ull << count) - 1);
+        scratch |= ((uint64_t)value & mask) << scratchBits;
+        scratchBits += count;
+        if (scratchBits >= 32) {
+            flushBytes(4);
+        }
+    }
+
+    void flag(bool value) { bits(value ? 1u : 0u, 1); }
+
+    // Two's complement in 'count' bits; the caller guarantees the value fits
+    void signedBits(int32_t value, int count) { bits((uint32_t)value, count); }
+
+    // Unsigned value with a 2-bit size class: 4, 8, 16 or 32 payload bits. Small counts, id gaps
+    // and health values cost 6 or 10 bits instead of a full word.
+    void varBits(uint32_t value) {
+        if (value < (1u << 4)) { bits(0, 2); bits(value, 4); }
+        else if (value < (1u << 8)) { bits(1, 2); bits(value, 8); }
+        else if (value < (1u << 16)) { bits(2, 2); bits(value, 16); }
+        else { bits(3, 2); bits(value, 32); }
+    }
+
+    // Flushes the partial last byte; returns the total size in bytes
+    size_t finish() {
+        flushBytes((scratchBits + 7) / 8);
+        scratchBits = 0;
+        return size;
+    }
+
+    size_t getBitCount() const { return size * 8 + scratchBits; }
+    bool overflowed() const { return overflow; }
+
+private:
+    uint8_t* data;
+    size_t capacity;
+    size_t size;
+    uint64_t scratch;
+    int scratchBits;
+    bool overflow;
+
+    void flushBytes(int count) {
+        if (size + count > capacity) {
+            overflow = true;
+        } else {
+            for (int i = 0; i < count; ++i) data[size + i] = (uint8_t)(scratch >> (8 * i));
+            size += count;
+        }
+        scratch >>= 8 * count;
+        scratchBits -= 8 * count;
+    }
+};
+
+// Reads what BitWriter wrote; reading past the end yields zeros and sets a flag
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size)
+        : data(data), size(size), offset(0), scratch(0), scratchBits(0), overflow(false) {}
+
+    uint32_t bits(int count) {
+        if (scratchBits < count) refill(count);
+        uint64_t mask = (count == 32) ? 0xFFFFFFFFull : ((1ull << count) - 1);
+        uint32_t value = (uint32_t)(scratch & mask);
+        scratch >>= count;
+        scratchBits -= count;
+        return value;
+    }
+
+    bool flag() { return bits(1) != 0; }
+
+    int32_t signedBits(int count) {
+        uint32_t value = bits(count);
+        uint32_t sign = 1u << (count - 1);
+        return (int32_t)((value ^ sign) - sign); // Sign-extend
+    }
+
+    uint32_t varBits() {
+        static const int PAYLOAD_BITS[4] = { 4, 8, 16, 32 };
+        return bits(PAYLOAD_BITS[bits(2)]);
+    }
+
+    bool overflowed() const { return overflow; }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+    uint64_t scratch;
+    int scratchBits;
+    bool overflow;
+
+    void refill(int needed) {
+        while (scratchBits < needed) {
+            if (offset >= size) {
+                // Pretend zeros follow so the caller's read completes; the flag reports the truncation
+                overflow = true;
+                scratchBits = needed;
+                return;
+            }
+            scratch |= (uint64_t)data[offset++] << scratchBits;
+            scratchBits += 8;
+        }
+    }
+};
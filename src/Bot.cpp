@@ -0,0 +1,99 @@
+#include "Bot.h"
+#include "raymath.h"
+
+BotConfig BotConfig::Default() {
+    BotConfig config;
+    config.aimRange = 700.0f;
+    config.kiteDistance = 180.0f;
+    config.threatRadius = 220.0f;
+    config.surroundRadius = 70.0f;
+    config.surroundedCount = 3;
+    config.dashCooldown = 1.5f;
+    config.strafeSeconds = 1.5f;
+    config.edgeMargin = 120.0f;
+    return config;
+}
+
+Bot::Bot(uint64_t seed, const BotConfig& config)
+    : config(config), rng(seed), strafeSign(1.0f), strafeTimer(0.0f), dashTimer(0.0f), lastTime(0.0f) {
+    rollStrafeTimer();
+}
+
+void Bot::rollStrafeTimer() {
+    strafeTimer = config.strafeSeconds * (0.5f + rng.range(0, 100) / 100.0f);
+}
+
+static bool IsAlive(const Zombie& zombie) {
+    return zombie.currentState == Zombie::ZombieState::CHASING || zombie.currentState == Zombie::ZombieState::ATTACKING;
+}
+
+PlayerInput Bot::think(const World& world) {
+    const Player& player = world.player;
+    PlayerInput input = { { 0, 0 }, Vector2Add(player.pos, player.facing), false, false };
+
+    // Timers run on simulation time; a restart (time going backwards) just resets the reference
+    float deltaTime = world.time >= lastTime ? world.time - lastTime : 0.0f;
+    lastTime = world.time;
+    strafeTimer -= deltaTime;
+    dashTimer -= deltaTime;
+    if (strafeTimer <= 0.0f) {
+        strafeSign = -strafeSign;
+        rollStrafeTimer();
+    }
+
+    // Crowd pressure: nearer zombies push harder (1/distance), and count towards being surrounded
+    Vector2 away = { 0, 0 };
+    int surrounding = 0;
+    float surroundRadiusSq = config.surroundRadius * config.surroundRadius;
+    world.zombieGrid.forEachInRadius(player.pos, config.threatRadius, [&](int, const Zombie& zombie) {
+        if (!IsAlive(zombie)) return;
+        Vector2 fromZombie = Vector2Subtract(player.pos, zombie.pos);
+        float distSq = Vector2LengthSqr(fromZombie);
+        if (distSq < 1.0f) distSq = 1.0f;
+        away = Vector2Add(away, Vector2Scale(fromZombie, 1.0f / distSq));
+        if (distSq < surroundRadiusSq) surrounding++;
+    });
+    Vector2 escape = Vector2LengthSqr(away) > 0.0f ? Vector2Normalize(away) : Vector2{ 0, 0 };
+
+    Vector2 move = { 0, 0 };
+    int target = world.zombieGrid.nearestAlive(player.pos, config.aimRange);
+    if (target >= 0) {
+        Vector2 targetPos = world.floor.zombies[target].pos;
+        input.aim = targetPos;
+        input.fire = true;
+
+        Vector2 toTarget = Vector2Subtract(targetPos, player.pos);
+        float distance = Vector2Length(toTarget);
+        if (distance > 0.0f) {
+            toTarget = Vector2Scale(toTarget, 1.0f / distance);
+            move = { -toTarget.y * strafeSign, toTarget.x * strafeSign };
+        }
+        if (distance < config.kiteDistance) move = Vector2Add(move, Vector2Scale(escape, 2.0f));
+    }
+
+    // Stay off the arena edges, where the bot would get pinned against the spawn ring
+    Vector2 toCenter = Vector2Subtract({ world.width / 2, world.height / 2 }, player.pos);
+    if (player.pos.x < config.edgeMargin || player.pos.x > world.width - config.edgeMargin ||
+        player.pos.y < config.edgeMargin || player.pos.y > world.height - config.edgeMargin) {
+        move = Vector2Add(move, Vector2Scale(Vector2Normalize(toCenter), 1.5f));
+    }
+
+    // A wall just ahead: turn the strafe around instead of grinding into it
+    if (Vector2LengthSqr(move) > 0.0f) {
+        Vector2 probe = Vector2Add(player.pos, Vector2Scale(Vector2Normalize(move), player.size + 10.0f));
+        if (world.floor.wallIndex.overlapsCircle(probe, player.size)) {
+            strafeSign = -strafeSign;
+            rollStrafeTimer();
+            move = Vector2LengthSqr(escape) > 0.0f ? escape : Vector2Normalize(toCenter);
+        }
+    }
+
+    if (surrounding >= config.surroundedCount && dashTimer <= 0.0f && !player.isDashing) {
+        input.dash = true;
+        dashTimer = config.dashCooldown;
+        if (Vector2LengthSqr(escape) > 0.0f) move = escape; // World dashes along the move direction
+    }
+
+    input.move = move;
+    return input;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "raylib.h"
+#include "World.h"
+#include "Rng.h"
+#include <cstdint>
+
+// Tuning for Bot. Distances are in pixels, times in seconds.
+struct BotConfig {
+    float aimRange;        // Zombies farther than this are not targeted
+    float kiteDistance;    // Back away once the target is closer than this
+    float threatRadius;    // Zombies within this push the bot away from them
+    float surroundRadius;  // Zombies within this count towards being surrounded
+    int surroundedCount;   // That many zombies within surroundRadius trigger a dash
+    float dashCooldown;    // The player can dash again as soon as a dash ends; the bot waits this long
+    float strafeSeconds;   // Average time between strafe direction changes
+    float edgeMargin;      // Steer back towards the center when closer than this to the arena edge
+
+    static BotConfig Default();
+};
+
+// Scripted player for load generation and soak tests. Each tick it reads the world as the last
+// step left it and produces the same PlayerInput the keyboard and mouse would:
+//   aim      at the nearest live zombie (ZombieGrid query), firing while one is in range
+//   strafe   sideways to the target, flipping direction now and then or when a wall is ahead
+//   kite     away from nearby zombies, weighted by closeness, once the target gets close
+//   dash     away from the crowd when surrounded
+// Its randomness comes from its own Rng, so a world seed plus a bot seed replays exactly.
+class Bot {
+public:
+    explicit Bot(uint64_t seed, const BotConfig& config = BotConfig::Default());
+
+    PlayerInput think(const World& world);
+
+    const BotConfig& getConfig() const { return config; }
+
+private:
+    BotConfig config;
+    Rng rng;
+    float strafeSign;
+    float strafeTimer;
+    float dashTimer;
+    float lastTime; // world.time at the previous think(), for the timers
+
+    void rollStrafeTimer();
+};
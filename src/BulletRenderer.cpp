@@ -0,0 +1,128 @@
+#include "BulletRenderer.h"
+#include "raymath.h"
+#include "Renderer.h"
+
+const int BulletRenderer::SPRITE_SIZE = 32;
+
+// Bullet look, kept identical to the old four-circle Bullet::draw
+static const float GLOW_RADIUS_SCALE = 2.5f;    // Outer glow radius relative to bullet radius
+static const float TRAIL_OFFSET_TIME = 0.05f;   // Trail sits this many seconds of travel behind
+static const float SPARKLE_OFFSET_TIME = 0.1f;  // Sparkle sits this many seconds of travel ahead
+static const Color GLOW_COLOR = { 255, 50, 50, 100 };
+static const Color TRAIL_COLOR = { 255, 80, 80, 150 };
+static const Color SPIT_COLOR = { 150, 220, 50, 230 };
+static const float SPIT_DRAW_SCALE = 1.6f; // The soft dot's edge fades out, so draw it a bit larger than the hit radius
+
+BulletRenderer::BulletRenderer()
+    : atlas({}), headSrc({ 0, 0, 0, 0 }), dotSrc({ 0, 0, 0, 0 }), loaded(false), stats({ 0, 0, 0.0 }) {}
+
+BulletRenderer::~BulletRenderer() {
+    unload();
+}
+
+void BulletRenderer::load() {
+    if (loaded) return;
+
+    const int cell = SPRITE_SIZE;
+    Image image = GenImageColor(cell * 2, cell, BLANK);
+
+    // Left cell: soft red glow with the solid core baked into its center.
+    // The glow circle is 2.5x the core radius, so the core covers the inner 40%.
+    float half = cell * 0.5f;
+    float coreFraction = 1.0f / GLOW_RADIUS_SCALE;
+    for (int y = 0; y < cell; ++y) {
+        for (int x = 0; x < cell; ++x) {
+            float dx = (x + 0.5f - half) / half;
+            float dy = (y + 0.5f - half) / half;
+            float d = sqrtf(dx * dx + dy * dy); // 0 at center, 1 at cell edge
+            if (d > 1.0f) continue;
+
+            Color c = GLOW_COLOR;
+            if (d <= coreFraction) {
+                c = RED;
+            } else {
+                // Slight edge softening instead of a hard tessellated rim
+                float edge = Clamp((1.0f - d) * 8.0f, 0.0f, 1.0f);
+                c.a = (unsigned char)(GLOW_COLOR.a * edge);
+            }
+            ImageDrawPixel(&image, x, y, c);
+        }
+    }
+
+    // Right cell: white dot, tinted per use for the trail and the sparkle
+    for (int y = 0; y < cell; ++y) {
+        for (int x = 0; x < cell; ++x) {
+            float dx = (x + 0.5f - half) / half;
+            float dy = (y + 0.5f - half) / half;
+            float d = sqrtf(dx * dx + dy * dy);
+            if (d > 1.0f) continue;
+            float edge = Clamp((1.0f - d) * 8.0f, 0.0f, 1.0f);
+            ImageDrawPixel(&image, cell + x, y, ColorAlpha(WHITE, edge));
+        }
+    }
+
+    atlas = LoadTextureFromImage(image);
+    UnloadImage(image);
+    SetTextureFilter(atlas, TEXTURE_FILTER_BILINEAR);
+
+    headSrc = { 0, 0, (float)cell, (float)cell };
+    dotSrc = { (float)cell, 0, (float)cell, (float)cell };
+    loaded = true;
+}
+
+void BulletRenderer::unload() {
+    if (!loaded) return;
+    UnloadTexture(atlas);
+    atlas = {};
+    loaded = false;
+}
+
+void BulletRenderer::draw(Renderer& renderer, const std::vector<Bullet>& bullets) {
+    double start = GetTime();
+    stats.bulletsDrawn = 0;
+    stats.quadsSubmitted = 0;
+
+    if (loaded || !renderer.usesGpu()) {
+        for (const Bullet& bullet : bullets) {
+            if (!bullet.active) continue;
+
+            float speed = Vector2Length(bullet.velocity);
+            float angle = atan2f(bullet.velocity.y, bullet.velocity.x) * RAD2DEG;
+
+            // Motion trail: the dot sprite stretched along the velocity, drawn first so the head covers it
+            float trailRadius = bullet.radius * 0.8f;
+            float trailLength = trailRadius * 2.0f + speed * TRAIL_OFFSET_TIME;
+            Vector2 trailCenter = Vector2Subtract(bullet.pos, Vector2Scale(bullet.velocity, TRAIL_OFFSET_TIME * 0.5f));
+            renderer.drawTexturePro(atlas, dotSrc,
+                           { trailCenter.x, trailCenter.y, trailLength, trailRadius * 2.0f },
+                           { trailLength * 0.5f, trailRadius }, angle, TRAIL_COLOR);
+
+            // Glow + core in one quad
+            float glowRadius = bullet.radius * GLOW_RADIUS_SCALE;
+            renderer.drawTexturePro(atlas, headSrc,
+                           { bullet.pos.x, bullet.pos.y, glowRadius * 2.0f, glowRadius * 2.0f },
+                           { glowRadius, glowRadius }, 0.0f, WHITE);
+
+            // Tiny white sparkle at the front
+            float sparkleRadius = bullet.radius * 0.4f;
+            Vector2 sparklePos = Vector2Add(bullet.pos, Vector2Scale(bullet.velocity, SPARKLE_OFFSET_TIME));
+            renderer.drawTexturePro(atlas, dotSrc,
+                           { sparklePos.x, sparklePos.y, sparkleRadius * 2.0f, sparkleRadius * 2.0f },
+                           { sparkleRadius, sparkleRadius }, 0.0f, WHITE);
+
+            stats.bulletsDrawn++;
+            stats.quadsSubmitted += 3;
+        }
+    }
+
+    stats.cpuMs = (GetTime() - start) * 1000.0;
+}
+
+void BulletRenderer::drawSpit(Renderer& renderer, const EnemyProjectiles& projectiles) {
+    if (!loaded && renderer.usesGpu()) return;
+    float radius = EnemyProjectiles::RADIUS * SPIT_DRAW_SCALE;
+    for (int i = 0; i < projectiles.getCount(); ++i) {
+        renderer.drawTexturePro(atlas, dotSrc, { projectiles.x[i], projectiles.y[i], radius * 2.0f, radius * 2.0f },
+                                { radius, radius }, 0.0f, SPIT_COLOR);
+    }
+}
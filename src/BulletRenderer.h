@@ -0,0 +1,51 @@
+#pragma once
+#include "raylib.h"
+#include "Bullet.h"
+#include "EnemyProjectiles.h"
+#include <vector>
+
+class Renderer;
+
+// Draws the whole bullet layer as textured quads sampled from one glow sprite that is
+// baked once at startup. Every quad uses the same texture, so raylib's internal batch never
+// has to flush between bullets for a state change; the layer costs one draw call per batch it
+// fills (three quads a bullet against 8192 quads per batch on desktop, 2048 on the web, so a
+// 2000-bullet layer is one call on desktop and three on the web; see drawcost_probe).
+class BulletRenderer {
+public:
+    // Per-frame instrumentation for the last draw() call
+    struct FrameStats {
+        int bulletsDrawn;
+        int quadsSubmitted;
+        double cpuMs; // CPU time spent building the quad stream
+    };
+
+    BulletRenderer();
+    ~BulletRenderer();
+
+    BulletRenderer(const BulletRenderer&) = delete;
+    BulletRenderer& operator=(const BulletRenderer&) = delete;
+
+    // Bakes the glow sprite. Requires an active window/GL context (call after InitWindow).
+    void load();
+    void unload();
+
+    // Draws every active bullet straight from the player's bullet storage.
+    // Headless renderers still receive the quads so the layer can be counted.
+    void draw(Renderer& renderer, const std::vector<Bullet>& bullets);
+
+    // Draws the zombies' projectiles: one tinted quad each from the same atlas, so it can share
+    // the bullet layer's batch. Not counted in the frame stats.
+    void drawSpit(Renderer& renderer, const EnemyProjectiles& projectiles);
+
+    const FrameStats& getStats() const { return stats; }
+
+    static const int SPRITE_SIZE; // Size in pixels of one sprite cell in the atlas
+
+private:
+    Texture2D atlas; // Two cells side by side: [bullet head | soft white dot]
+    Rectangle headSrc;
+    Rectangle dotSrc;
+    bool loaded;
+    FrameStats stats;
+};
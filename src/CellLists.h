@@ -0,0 +1,79 @@
+#pragma once
+#include <algorithm>
+#include <memory_resource>
+#include <vector>
+
+// Rewrites the lists of the cells [minCol, maxCol] x [minRow, maxRow] of a compressed cell list
+// ('cellStart': one offset per cell plus one into 'cellItems', items grouped by cell) and leaves
+// every other cell's list as it was. rangeOf(item, minCol, minRow, maxCol, maxRow) must return the
+// item's clamped cell range exactly as the full build computes it (false: the item touches no
+// cell), and items are visited in index order, so the dirty cells end up listing what a fresh build
+// would. Only the stretch of 'cellItems' from the first to the last dirty cell is rewritten; the
+// offsets after it are shifted. Used when walls break (they only shrink or vanish, so every wall
+// touching a dirty cell is still found by scanning the current wall list).
+template <typename RangeFn>
+void RelistCells(std::pmr::vector<int>& cellStart, std::pmr::vector<int>& cellItems, int cols,
+                 int minCol, int minRow, int maxCol, int maxRow, int itemCount, RangeFn&& rangeOf) {
+    int width = maxCol - minCol + 1;
+    int dirtyCount = width * (maxRow - minRow + 1);
+
+    // The dirty cells' new lists, grouped by cell in row-major order (a counting sort over the items)
+    auto forEachDirtyCell = [&](int item, auto&& fn) {
+        int itemMinCol, itemMinRow, itemMaxCol, itemMaxRow;
+        if (!rangeOf(item, itemMinCol, itemMinRow, itemMaxCol, itemMaxRow)) return;
+        if (itemMaxCol < minCol || itemMinCol > maxCol || itemMaxRow < minRow || itemMinRow > maxRow) return;
+        int fromCol = itemMinCol > minCol ? itemMinCol : minCol;
+        int toCol = itemMaxCol < maxCol ? itemMaxCol : maxCol;
+        int fromRow = itemMinRow > minRow ? itemMinRow : minRow;
+        int toRow = itemMaxRow < maxRow ? itemMaxRow : maxRow;
+        for (int row = fromRow; row <= toRow; ++row)
+            for (int col = fromCol; col <= toCol; ++col)
+                fn((row - minRow) * width + col - minCol);
+    };
+    std::vector<int> dirtyStart(dirtyCount + 1, 0);
+    for (int item = 0; item < itemCount; ++item) {
+        forEachDirtyCell(item, [&](int local) { dirtyStart[local + 1]++; });
+    }
+    for (int i = 0; i < dirtyCount; ++i) dirtyStart[i + 1] += dirtyStart[i];
+    std::vector<int> dirtyItems(dirtyStart[dirtyCount]);
+    std::vector<int> cursor(dirtyStart.begin(), dirtyStart.end() - 1);
+    for (int item = 0; item < itemCount; ++item) {
+        forEachDirtyCell(item, [&](int local) { dirtyItems[cursor[local]++] = item; });
+    }
+
+    // The stretch from the first dirty cell to the last, row by row: the dirty block's new lists,
+    // then the clean cells up to the next row's block copied over as one run, their offsets shifted
+    int first = minRow * cols + minCol;
+    int last = maxRow * cols + maxCol;
+    int oldBegin = cellStart[first];
+    int oldEnd = cellStart[last + 1];
+    std::vector<int> items;
+    items.reserve(oldEnd - oldBegin + dirtyItems.size());
+    for (int row = minRow; row <= maxRow; ++row) {
+        int blockFirst = row * cols + minCol;
+        int localFirst = (row - minRow) * width;
+        for (int col = 0; col < width; ++col) {
+            cellStart[blockFirst + col] = oldBegin + (int)items.size();
+            items.insert(items.end(), dirtyItems.begin() + dirtyStart[localFirst + col],
+                         dirtyItems.begin() + dirtyStart[localFirst + col + 1]);
+        }
+        if (row == maxRow) break;
+
+        int runFirst = blockFirst + width;
+        int runEnd = blockFirst + cols; // The next row's block
+        int shift = oldBegin + (int)items.size() - cellStart[runFirst];
+        items.insert(items.end(), cellItems.begin() + cellStart[runFirst], cellItems.begin() + cellStart[runEnd]);
+        if (shift != 0) {
+            for (int cell = runFirst; cell < runEnd; ++cell) cellStart[cell] += shift;
+        }
+    }
+
+    // Splice the stretch back in and shift the offsets behind it
+    int shift = (int)items.size() - (oldEnd - oldBegin);
+    if (shift > 0) cellItems.insert(cellItems.begin() + oldEnd, shift, 0);
+    else if (shift < 0) cellItems.erase(cellItems.begin() + oldEnd + shift, cellItems.begin() + oldEnd);
+    std::copy(items.begin(), items.end(), cellItems.begin() + oldBegin);
+    if (shift != 0) {
+        for (int cell = last + 1; cell < (int)cellStart.size(); ++cell) cellStart[cell] += shift;
+    }
+}
@@ -0,0 +1,212 @@
+#include "ClientPrediction.h"
+#include "WeaponTypes.h"
+#include "ZombieTypes.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility> // For std::move
+
+const float PlayerPredictor::CORRECTION_EPSILON = 0.01f;
+const float PlayerPredictor::SMOOTHING_SECONDS = 0.1f;
+const float PlayerPredictor::SNAP_DISTANCE = 100.0f;
+const int PlayerPredictor::MAX_PENDING_INPUTS = 128; // Two seconds at 60 Hz
+
+const float ZombieInterpolator::INTERPOLATION_DELAY = 0.1f; // Three 30 Hz states, less one of jitter
+const int ZombieInterpolator::MAX_STATES = 32;
+const float ZombieInterpolator::MAX_ZOMBIE_SPEED = RunnerZombie::LEAP_SPEED;
+const float ZombieInterpolator::MATCH_SLACK = 1.0f; // Positions travel in 1/16 px steps
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+PlayerPredictor::PlayerPredictor(float worldWidth, float worldHeight, float tickSeconds)
+    : width(worldWidth), height(worldHeight), tickSeconds(tickSeconds), time(0.0f), playing(false),
+      player({ worldWidth / 2, worldHeight / 2 }, { 1, 0 }, 20.0f, 100, CreatePistol()),
+      floor(16 * 1024), drawOffset({ 0, 0 }) {}
+
+void PlayerPredictor::start(Weapon&& weapon) {
+    // The player World::start puts on floor 1
+    player = Player({ width / 2, height / 2 }, { 1, 0 }, 20.0f, 100, std::move(weapon));
+    player.weapon.lastFireTime = -1.0f / player.weapon.fireRate;
+    time = 0.0f;
+    playing = true;
+    pending.clear();
+    drawOffset = { 0, 0 };
+}
+
+void PlayerPredictor::setWalls(const NetWalls& walls) {
+    floor.reset(walls.floor);
+    floor.walls.assign(walls.walls, walls.walls + walls.count);
+    floor.occupancy.build(floor.walls, width, height);
+}
+
+void PlayerPredictor::step(const PlayerInput& input, bool replay) {
+    time += tickSeconds;
+    float shotTimes[World::MAX_SHOTS_PER_STEP];
+    int shots = World::controlPlayer(player, input, tickSeconds, time, floor, shotTimes);
+    if (!replay) {
+        for (int i = 0; i < shots; ++i) player.shoot(time - shotTimes[i], tickSeconds);
+    }
+    World::updatePlayer(player, tickSeconds, noZombies, noZombieGrid, floor.walls, { width, height });
+    player.detonations.clear(); // The server resolves what the bullets really hit
+    player.wallHits.clear();
+}
+
+void PlayerPredictor::record(PendingInput& entry) const {
+    entry.pos = player.pos;
+    entry.dashing = player.isDashing;
+    entry.dashTimer = player.dashTimer;
+    entry.fireTime = player.weapon.lastFireTime;
+}
+
+void PlayerPredictor::predict(uint32_t sequence, const PlayerInput& input) {
+    if (!playing || sequence == 0) return;
+    PendingInput entry = { sequence, input, { 0, 0 }, false, 0.0f, 0.0f };
+    entry.input.fireLead = 0.0f; // Does not travel; the server steps without it
+
+    auto start = Clock::now();
+    step(entry.input, false);
+    stats.predictUs += ElapsedUs(start);
+    stats.predictedSteps++;
+
+    record(entry);
+    pending.push_back(entry);
+    if ((int)pending.size() > MAX_PENDING_INPUTS) pending.pop_front();
+}
+
+void PlayerPredictor::reconcile(const NetWorldState& state) {
+    player.health = state.playerHealth; // Never predicted
+    stats.states++;
+
+    // Inputs the server has stepped are settled; the last of them is what this state shows
+    while (!pending.empty() && pending.front().sequence < state.lastInputSequence) pending.pop_front();
+    bool agrees = false;
+    if (!pending.empty() && pending.front().sequence == state.lastInputSequence) {
+        const PendingInput& predicted = pending.front();
+        agrees = Vector2Distance(predicted.pos, state.playerPos) <= CORRECTION_EPSILON &&
+                 predicted.dashing == state.playerDashing &&
+                 std::fabs(predicted.dashTimer - state.playerDashTimer) <= 1e-4f &&
+                 std::fabs(predicted.fireTime - state.fireTime) <= 1e-4f;
+        pending.pop_front();
+    }
+    if (state.status != (uint8_t)World::Status::PLAYING) {
+        playing = false; // The server stops stepping; so do we
+        pending.clear();
+        player.pos = state.playerPos;
+        drawOffset = { 0, 0 };
+        return;
+    }
+    if (agrees) return;
+
+    // Take the server's player and step the inputs it has not seen yet again. Bullets, tracers and
+    // the muzzle flash already shown stay as they are: the replay only moves the player.
+    Vector2 before = getDrawPosition();
+    player.pos = state.playerPos;
+    player.facing = state.playerFacing;
+    player.isDashing = state.playerDashing;
+    player.dashTimer = state.playerDashTimer;
+    player.dashDirection = state.playerDashDirection;
+    player.weapon.lastFireTime = state.fireTime;
+    player.weapon.triggerHeld = state.triggerHeld;
+    time = state.time;
+
+    std::vector<Bullet> bullets;
+    std::vector<Tracer> tracers;
+    bullets.swap(player.bullets);
+    tracers.swap(player.tracers);
+    float muzzleFlash = player.muzzleFlashTimer;
+    auto start = Clock::now();
+    for (PendingInput& entry : pending) {
+        step(entry.input, true);
+        record(entry);
+    }
+    stats.replayUs += ElapsedUs(start);
+    stats.replayedSteps += pending.size();
+    bullets.swap(player.bullets);
+    tracers.swap(player.tracers);
+    player.muzzleFlashTimer = muzzleFlash;
+
+    float error = Vector2Distance(before, player.pos);
+    stats.corrections++;
+    stats.errorSum += error;
+    stats.maxError = std::max(stats.maxError, error);
+    drawOffset = error < SNAP_DISTANCE ? Vector2Subtract(before, player.pos) : Vector2{ 0, 0 };
+}
+
+void PlayerPredictor::smooth(float frameSeconds) {
+    drawOffset = Vector2Scale(drawOffset, expf(-frameSeconds / SMOOTHING_SECONDS));
+}
+
+ZombieInterpolator::ZombieInterpolator(float tickSeconds) : tickSeconds(tickSeconds), renderLag(0.0f) {}
+
+void ZombieInterpolator::clear() {
+    states.clear();
+    renderLag = 0.0f;
+}
+
+void ZombieInterpolator::push(const NetWorldState& state, double arrivalSeconds) {
+    if (!states.empty() && state.tick <= states.back().tick) return;
+    Received received;
+    if ((int)states.size() >= MAX_STATES) {
+        received.zombies.swap(states.front().zombies); // Reuse the oldest state's storage
+        states.pop_front();
+    }
+    received.tick = state.tick;
+    received.arrival = arrivalSeconds;
+    received.zombies.assign(state.zombies, state.zombies + state.zombiesSent);
+    std::sort(received.zombies.begin(), received.zombies.end(),
+              [](const NetZombieState& a, const NetZombieState& b) { return a.id < b.id; });
+    states.push_back(std::move(received));
+}
+
+ZombieInterpolator::Sample ZombieInterpolator::sample(double nowSeconds, std::vector<NetZombieState>& out) {
+    out.clear();
+    if (states.empty()) return Sample::NONE;
+
+    // Server tick 0 on our clock, as seen by the state that took the shortest path here
+    double offset = states.front().arrival - states.front().tick * (double)tickSeconds;
+    for (const Received& received : states) offset = std::min(offset, received.arrival - received.tick * (double)tickSeconds);
+    double renderTick = (nowSeconds - offset - INTERPOLATION_DELAY) / tickSeconds;
+    renderLag = (float)((states.back().tick - renderTick) * tickSeconds);
+
+    if (renderTick >= states.back().tick) {
+        out = states.back().zombies;
+        stats.held++;
+        return Sample::HELD;
+    }
+    if (renderTick < states.front().tick) {
+        out = states.front().zombies;
+        stats.early++;
+        return Sample::EARLY;
+    }
+
+    size_t next = 1;
+    while (states[next].tick <= renderTick) next++;
+    const Received& a = states[next - 1];
+    const Received& b = states[next];
+    float t = (float)((renderTick - a.tick) / (b.tick - a.tick));
+    float reach = MAX_ZOMBIE_SPEED * (b.tick - a.tick) * tickSeconds + MATCH_SLACK;
+    for (const NetZombieState& later : b.zombies) {
+        NetZombieState zombie = later;
+        // Wire ids wrap and restart each floor: of the earlier zombies sharing this one's id, take the
+        // nearest that has its size and could have moved here in between
+        auto range = std::equal_range(a.zombies.begin(), a.zombies.end(), later,
+                                      [](const NetZombieState& x, const NetZombieState& y) { return x.id < y.id; });
+        const NetZombieState* match = nullptr;
+        float matchDistSq = reach * reach;
+        for (auto earlier = range.first; earlier != range.second; ++earlier) {
+            float distSq = Vector2DistanceSqr(earlier->pos, later.pos);
+            if (earlier->size != later.size || distSq > matchDistSq) continue;
+            match = &*earlier;
+            matchDistSq = distSq;
+        }
+        if (match) zombie.pos = Vector2Lerp(match->pos, later.pos, t);
+        else if (range.first != range.second) stats.idMismatches++;
+        out.push_back(zombie);
+    }
+    stats.interpolated++;
+    return Sample::INTERPOLATED;
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include "raylib.h"
+#include "NetProtocol.h"
+#include "World.h"
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+// Client-side prediction of the local player. Every input the client sends is also stepped here
+// at once, through the server's own World::controlPlayer and World::updatePlayer on the floor's
+// walls as received from the server, so moving, dashing and firing answer without waiting a
+// round trip. Each STATE names the last input the server stepped; the predictor compares its
+// prediction for that input with the server's player and, if they differ, takes the server's
+// player and replays the inputs sent since. The difference is not shown as a jump: the drawn
+// position carries it as an offset that decays over SMOOTHING_SECONDS.
+//
+// Only the player is predicted. Zombies, health and score come from the server (zombies through
+// ZombieInterpolator); predicted bullets are local effects that never hit anything.
+class PlayerPredictor {
+public:
+    static const float CORRECTION_EPSILON; // Position difference (px) that counts as a misprediction
+    static const float SMOOTHING_SECONDS;  // Time constant of the drawn correction's decay
+    static const float SNAP_DISTANCE;      // Corrections this large are drawn as a jump
+    static const int MAX_PENDING_INPUTS;   // Inputs kept for replay; the oldest are forgotten beyond this
+
+    struct Stats {
+        uint64_t predictedSteps = 0;
+        uint64_t states = 0;        // States reconciled against
+        uint64_t corrections = 0;   // States that disagreed with the prediction
+        uint64_t replayedSteps = 0; // Steps re-simulated by corrections
+        double predictUs = 0.0;     // Time spent predicting new inputs
+        double replayUs = 0.0;      // Time spent re-simulating
+        double errorSum = 0.0;      // Over corrections, px
+        float maxError = 0.0f;
+    };
+
+    PlayerPredictor(float worldWidth, float worldHeight, float tickSeconds);
+
+    // A new game with 'weapon', as the server starts it (World::start)
+    void start(Weapon&& weapon);
+    // Takes the floor's walls; later predictions and replays collide with these
+    void setWalls(const NetWalls& walls);
+
+    // Steps 'input', just sent as 'sequence', and keeps it until the server has stepped it too
+    void predict(uint32_t sequence, const PlayerInput& input);
+    // Checks the prediction against 'state', re-simulating from the server's player if they differ
+    void reconcile(const NetWorldState& state);
+    // Decays the drawn correction offset; call once per rendered frame
+    void smooth(float frameSeconds);
+
+    const Player& getPlayer() const { return player; }
+    Vector2 getDrawPosition() const { return Vector2Add(player.pos, drawOffset); }
+    int getPendingInputs() const { return (int)pending.size(); }
+    const Stats& getStats() const { return stats; }
+
+private:
+    // An input sent but not yet confirmed, and the player it was predicted to leave
+    struct PendingInput {
+        uint32_t sequence;
+        PlayerInput input;
+        Vector2 pos;
+        bool dashing;
+        float dashTimer;
+        float fireTime;
+    };
+
+    float width;
+    float height;
+    float tickSeconds;
+    float time; // Predicted World::time
+    bool playing;
+    Player player;
+    Floor floor;        // Walls and their occupancy grid only
+    ZombieList noZombies; // Predicted bullets hit nothing
+    ZombieGrid noZombieGrid;
+    std::deque<PendingInput> pending;
+    Vector2 drawOffset;
+    Stats stats;
+
+    // One tick of 'input'; 'replay' re-simulates quietly (no shots, no sound, no bullets)
+    void step(const PlayerInput& input, bool replay);
+    void record(PendingInput& entry) const;
+};
+
+// Remote zombies for drawing, interpolated between the last two STATEs around a render time held
+// INTERPOLATION_DELAY behind the newest state the client could have received. Zombies are matched
+// across states by id; one that only appears in the later state is drawn where it is there.
+// Arrival times map server ticks to the client's clock through the least-delayed recent state,
+// so jitter within the delay never leaves the render time past the newest state.
+class ZombieInterpolator {
+public:
+    static const float INTERPOLATION_DELAY; // Seconds behind the server
+    static const int MAX_STATES;            // States kept
+    // Fastest a zombie moves (a Runner's leap), px/s. A zombie in the later state is interpolated
+    // from the one in the earlier state with the same wire id and size that lies within this speed
+    // (plus MATCH_SLACK px of quantisation) of it; with none, the id was reused and it is drawn
+    // where the later state has it.
+    static const float MAX_ZOMBIE_SPEED;
+    static const float MATCH_SLACK;
+
+    enum class Sample {
+        NONE,         // No state yet
+        INTERPOLATED, // Between two states
+        HELD,         // Past the newest state (it arrived late or was lost): drawn as of that one
+        EARLY         // Before the oldest state kept: drawn as of that one
+    };
+
+    struct Stats {
+        uint64_t interpolated = 0;
+        uint64_t held = 0;
+        uint64_t early = 0;
+        uint64_t idMismatches = 0; // Zombies whose id matched one in the earlier state that was not them
+    };
+
+    explicit ZombieInterpolator(float tickSeconds);
+
+    void clear();
+    // A STATE received at 'arrivalSeconds' on the client's clock (newest tick first or in order;
+    // older ticks than the newest kept are ignored)
+    void push(const NetWorldState& state, double arrivalSeconds);
+    // The zombies to draw at 'nowSeconds'
+    Sample sample(double nowSeconds, std::vector<NetZombieState>& out);
+
+    float getRenderLag() const { return renderLag; } // Seconds behind the newest state at the last sample()
+    const Stats& getStats() const { return stats; }
+
+private:
+    struct Received {
+        uint32_t tick;
+        double arrival;
+        std::vector<NetZombieState> zombies; // Sorted by id
+    };
+
+    float tickSeconds;
+    std::deque<Received> states;
+    float renderLag;
+    Stats stats;
+};
@@ -1,17 +1,17 @@
 #include "raylib.h"
 #include <algorithm>
 #include "raymath.h"
-#include <vector>
+#include "CollisionUtils.h"
 
 //CollisionUtils.cpp
-bool CollidesWithWall(Vector2 point, const std::vector<Rectangle>& walls) {
+bool CollidesWithWall(Vector2 point, const WallList& walls) {
     for (const auto& wall : walls) {
         if (CheckCollisionPointRec(point, wall)) return true;
     }
     return false;
 }
 
-bool CollidesWithWallCircle(Vector2 center, float radius, const std::vector<Rectangle>& walls) {
+bool CollidesWithWallCircle(Vector2 center, float radius, const WallList& walls) {
     for (const auto& wall : walls) {
         if (CheckCollisionCircleRec(center, radius, wall)) return true;
     }
@@ -1,6 +1,6 @@
 #pragma once
 #include "raylib.h"
-#include <vector>
+#include "FloorArena.h" // WallList
 
-bool CollidesWithWall(Vector2 point, const std::vector<Rectangle>& walls);
-bool CollidesWithWallCircle(Vector2 center, float radius, const std::vector<Rectangle>& walls);
+bool CollidesWithWall(Vector2 point, const WallList& walls);
+bool CollidesWithWallCircle(Vector2 center, float radius, const WallList& walls);
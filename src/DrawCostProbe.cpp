@@ -0,0 +1,141 @@
+// DrawCostProbe.cpp
+// Headless draw-workload check: renders a fixed scene through NullRenderer and reports
+// primitives/vertices per frame and per zombie. Exits non-zero when the per-zombie cost
+// exceeds the budget, so CI can fail a build when zombie drawing gets heavier.
+// Also draws a 2000-bullet layer and reports the draw calls raylib's batch would split it into,
+// with the desktop and the web batch sizes, and the CPU time per frame of building its quads;
+// fails if the layer needs more calls than its vertex count alone forces (a state change crept in).
+//
+// Usage: drawcost_probe [zombieCount] [maxPrimitivesPerZombie] [maxVerticesPerZombie]
+
+#include "raylib.h"
+#include "Renderer.h"
+#include "Player.h"
+#include "ZombieTypes.h"
+#include "WeaponTypes.h"
+#include "BulletRenderer.h"
+#include "HudLayer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+// Current cost of one live zombie (body + health bar + archetype extras, averaged over the
+// archetypes in their busiest state); raise deliberately, never by accident
+static const int DEFAULT_MAX_PRIMITIVES_PER_ZOMBIE = 34;
+static const int DEFAULT_MAX_VERTICES_PER_ZOMBIE = 1232;
+
+static const int HEAVY_BULLET_COUNT = 2000;
+static const int HEAVY_BULLET_FRAMES = 200; // Averaged over, for the CPU time
+
+// Draws the heavy bullet layer through a NullRenderer with 'batchQuads' per batch; returns false if
+// it took more draw calls than full batches alone account for
+static bool ProbeBulletLayer(const char* name, int batchQuads, const std::vector<Bullet>& bullets) {
+    NullRenderer renderer(batchQuads);
+    BulletRenderer bulletRenderer;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < HEAVY_BULLET_FRAMES; ++frame) {
+        renderer.beginFrame();
+        bulletRenderer.draw(renderer, bullets);
+    }
+    double cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() /
+                   HEAVY_BULLET_FRAMES;
+    const NullRenderer::FrameCounts& counts = renderer.getCounts();
+    int fullBatches = (counts.vertices + batchQuads * 4 - 1) / (batchQuads * 4);
+    printf("  %-8s batch %5d quads: %d draw calls (%d batch flushes), %d quads, %.3f ms CPU per frame\n", name,
+           batchQuads, counts.drawCalls, counts.batchFlushes, counts.vertices / 4, cpuMs);
+    return counts.drawCalls <= fullBatches;
+}
+
+int main(int argc, char** argv) {
+    int zombieCount = argc > 1 ? atoi(argv[1]) : 1000;
+    int maxPrimitivesPerZombie = argc > 2 ? atoi(argv[2]) : DEFAULT_MAX_PRIMITIVES_PER_ZOMBIE;
+    int maxVerticesPerZombie = argc > 3 ? atoi(argv[3]) : DEFAULT_MAX_VERTICES_PER_ZOMBIE;
+    if (zombieCount < 1) zombieCount = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    NullRenderer renderer;
+    BulletRenderer bulletRenderer; // Never loaded: headless, quads are only counted
+    HudLayer hud(1200, 800);
+
+    Player player({ 600, 400 }, { 1, 0 }, 20.0f, 100, CreatePistol());
+    for (int i = 0; i < 200; ++i) {
+        player.bullets.emplace_back(Vector2{ 10.0f + i * 5.0f, 100.0f }, Vector2{ 600.0f, 0.0f }, 20);
+    }
+
+    EnemyProjectiles spit;
+    for (int i = 0; i < 200; ++i) spit.spawn({ { 10.0f + i * 5.0f, 700.0f }, { 0.0f, -300.0f }, 1.0f, 8 });
+
+    // Every archetype in turn, with the Runners mid-leap, the Exploders' fuses lit and the Spitters
+    // rearing back (their costliest looks)
+    std::vector<Zombie> zombies;
+    zombies.reserve(zombieCount);
+    for (int i = 0; i < zombieCount; ++i) {
+        Vector2 pos = { (float)(i % 40) * 30.0f, (float)(i / 40) * 30.0f };
+        zombies.push_back(MakeZombie((ZombieKind)(i % ZOMBIE_KIND_COUNT), pos));
+        Zombie& zombie = zombies.back();
+        if (zombie.kind == ZombieKind::Runner) {
+            zombie.action = Zombie::Action::LEAPING;
+            zombie.leapDirection = { 1, 0 };
+        } else if (zombie.kind == ZombieKind::Exploder) {
+            zombie.action = Zombie::Action::FUSE;
+            zombie.actionTimer = ExploderZombie::FUSE_TIME / 2;
+        } else if (zombie.kind == ZombieKind::Spitter) {
+            zombie.action = Zombie::Action::WINDUP;
+            zombie.actionTimer = SpitterZombie::SPIT_WINDUP / 2;
+        }
+    }
+    ZombieBatches batches;
+    batches.build(zombies.data(), zombieCount);
+
+    // Zombies alone, to get the per-zombie cost
+    renderer.beginFrame();
+    batches.draw(renderer, zombies.data());
+    NullRenderer::FrameCounts zombieCounts = renderer.getCounts();
+
+    // Full frame: player, bullets, spit, zombies, HUD
+    renderer.beginFrame();
+    player.draw(renderer);
+    bulletRenderer.draw(renderer, player.bullets);
+    bulletRenderer.drawSpit(renderer, spit);
+    batches.draw(renderer, zombies.data());
+    hud.drawGameHUD(renderer, player, 1, 3, 0, 20);
+    NullRenderer::FrameCounts frameCounts = renderer.getCounts();
+
+    float primitivesPerZombie = (float)zombieCounts.primitives / zombieCount;
+    float verticesPerZombie = (float)zombieCounts.vertices / zombieCount;
+
+    printf("zombies: %d\n", zombieCount);
+    printf("frame: %d primitives, %d vertices\n", frameCounts.primitives, frameCounts.vertices);
+    for (int k = 0; k < NullRenderer::PRIMITIVE_KIND_COUNT; ++k) {
+        if (frameCounts.byKind[k] == 0) continue;
+        printf("  %-24s %d\n", NullRenderer::getKindName((NullRenderer::PrimitiveKind)k), frameCounts.byKind[k]);
+    }
+    printf("per zombie: %.2f primitives (budget %d), %.2f vertices (budget %d)\n",
+           primitivesPerZombie, maxPrimitivesPerZombie, verticesPerZombie, maxVerticesPerZombie);
+
+    printf("frame: %d draw calls (estimated, desktop batch)\n", frameCounts.drawCalls);
+
+    std::vector<Bullet> heavyBullets;
+    heavyBullets.reserve(HEAVY_BULLET_COUNT);
+    for (int i = 0; i < HEAVY_BULLET_COUNT; ++i) {
+        heavyBullets.emplace_back(Vector2{ 10.0f + (i % 100) * 11.0f, 10.0f + (i / 100) * 38.0f }, Vector2{ 600.0f, 0.0f }, 20);
+    }
+    printf("bullet layer, %d bullets:\n", HEAVY_BULLET_COUNT);
+    bool bulletsBatched = ProbeBulletLayer("desktop", NullRenderer::DESKTOP_BATCH_QUADS, heavyBullets);
+    bulletsBatched = ProbeBulletLayer("web", NullRenderer::WEB_BATCH_QUADS, heavyBullets) && bulletsBatched;
+
+    bool overBudget = primitivesPerZombie > maxPrimitivesPerZombie || verticesPerZombie > maxVerticesPerZombie;
+    if (overBudget) {
+        printf("FAIL: zombie draw cost exceeds budget\n");
+        return 1;
+    }
+    if (!bulletsBatched) {
+        printf("FAIL: the bullet layer breaks its batch on something other than a full vertex buffer\n");
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
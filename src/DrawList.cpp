@@ -0,0 +1,52 @@
+#include "DrawList.h"
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+const int DrawList::Y_OFFSET = 1024;
+
+void DrawList::add(DrawLayer layer, float y, DrawMaterial material, uint32_t payload) {
+    float shifted = std::floor(y) + Y_OFFSET;
+    uint64_t depth = shifted <= 0.0f ? 0 : shifted >= 65535.0f ? 65535 : (uint64_t)shifted;
+    keys.push_back(((uint64_t)layer << LAYER_SHIFT) | (depth << Y_SHIFT) | ((uint64_t)material << MATERIAL_SHIFT) | payload);
+}
+
+void DrawList::sort() {
+    int count = (int)keys.size();
+    scratch.resize(count);
+    payloads.resize(count);
+    if (count == 0) return;
+
+    // All four digit histograms in one read pass
+    static const int DIGITS = 4;
+    static const int FIRST_DIGIT_SHIFT = 32; // The payload (low 32 bits) only breaks ties, which add() keeps in order
+    int histogram[DIGITS][256];
+    std::memset(histogram, 0, sizeof(histogram));
+    for (uint64_t key : keys) {
+        for (int d = 0; d < DIGITS; ++d) histogram[d][(key >> (FIRST_DIGIT_SHIFT + 8 * d)) & 0xFF]++;
+    }
+
+    // Stable scatter per digit, least significant first; a digit all keys share leaves the order as is
+    uint64_t* from = keys.data();
+    uint64_t* to = scratch.data();
+    for (int d = 0; d < DIGITS; ++d) {
+        int shift = FIRST_DIGIT_SHIFT + 8 * d;
+        int* counts = histogram[d];
+        if (counts[(from[0] >> shift) & 0xFF] == count) continue;
+
+        int offset = 0;
+        for (int digit = 0; digit < 256; ++digit) {
+            int n = counts[digit];
+            counts[digit] = offset;
+            offset += n;
+        }
+        for (int i = 0; i < count; ++i) {
+            uint64_t key = from[i];
+            to[counts[(key >> shift) & 0xFF]++] = key;
+        }
+        std::swap(from, to);
+    }
+    if (from != keys.data()) keys.swap(scratch);
+
+    for (int i = 0; i < count; ++i) payloads[i] = (int)(uint32_t)keys[i];
+}
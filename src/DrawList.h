@@ -0,0 +1,65 @@
+#pragma once
+#include "Zombie.h" // ZOMBIE_KIND_COUNT
+#include <cstdint>
+#include <vector>
+
+// Drawn bottom to top; within a layer, items go back to front by their y
+enum class DrawLayer : uint8_t {
+    Entities,   // Player and zombies: whoever stands lower on the screen is in front
+    Projectiles // The bullet and spit layers, over everything that walks
+};
+
+// What an item is drawn with, for grouping. Zombies use their ZombieKind; the rest follow.
+enum class DrawMaterial : uint8_t {
+    Player = ZOMBIE_KIND_COUNT,
+    Bullets,
+    Spit
+};
+
+// One frame's draw items as 64-bit sort keys, radix-sorted each frame so the frame comes out back
+// to front while items of one material at the same depth stay adjacent: the consumer walks the
+// sorted list in runs of one material and hands each run to that material's batched renderer.
+// Key, from the high bits down: layer (4) | y in whole pixels, offset (16) | material (8) |
+// unused (4) | payload (32), where the payload is the caller's index of the item.
+class DrawList {
+public:
+    static const int Y_OFFSET; // Added to y, so the spawn ring above the top edge stays positive
+
+    void clear() { keys.clear(); }
+
+    // Items with the same layer, y and material must be added in ascending payload order (as a
+    // loop over a list does): the sort leaves such ties in the order they were added.
+    void add(DrawLayer layer, float y, DrawMaterial material, uint32_t payload);
+    void add(DrawLayer layer, float y, ZombieKind kind, uint32_t payload) { add(layer, y, (DrawMaterial)kind, payload); }
+
+    // LSD radix sort on the upper 32 bits (8-bit digits), skipping digits every key shares, then
+    // unpacks the payloads in sorted order for the runs
+    void sort();
+
+    // After sort(): calls fn(DrawMaterial, const int* payloads, int count) for each run of
+    // consecutive items in the same layer with the same material
+    template <typename Fn>
+    void forEachRun(Fn&& fn) const {
+        int count = (int)keys.size();
+        for (int start = 0; start < count;) {
+            uint64_t group = keys[start] & GROUP_MASK;
+            int end = start + 1;
+            while (end < count && (keys[end] & GROUP_MASK) == group) end++;
+            fn((DrawMaterial)((keys[start] >> MATERIAL_SHIFT) & 0xFF), payloads.data() + start, end - start);
+            start = end;
+        }
+    }
+
+    int getCount() const { return (int)keys.size(); }
+    const std::vector<uint64_t>& getKeys() const { return keys; }
+
+private:
+    static const int MATERIAL_SHIFT = 36;
+    static const int Y_SHIFT = 44;
+    static const int LAYER_SHIFT = 60;
+    static const uint64_t GROUP_MASK = (0xFull << LAYER_SHIFT) | (0xFFull << MATERIAL_SHIFT); // Layer and material
+
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> scratch; // The radix sort's other buffer
+    std::vector<int> payloads;     // Sorted payloads; kept with their capacity between frames
+};
@@ -0,0 +1,111 @@
+// DrawListBenchmark.cpp
+// Draw ordering benchmark: a fixed-seed World is filled to N zombies (horde spawning, player kept
+// alive and not shooting), then stepped frame by frame. Each frame the draw list is filled the way
+// the game fills it (the player and every zombie y-sorted on the entity layer, the projectile
+// layers on top) and sorted, once with DrawList's radix sort and once with std::sort over the
+// same keys. Reports the fill and sort cost per frame and how many material runs the consumer
+// would draw, and exits 1 if the radix sort's order ever differs from std::sort's.
+//
+// Usage: drawsort_bench [zombies=20000] [frames=300] [seed=1]
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "DrawList.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+struct Timing {
+    double total = 0.0;
+    double worst = 0.0;
+    void add(double us) {
+        total += us;
+        worst = std::max(worst, us);
+    }
+};
+
+// As main.cpp
+static void FillDrawList(const World& world, DrawList& drawList) {
+    const Player& player = world.player;
+    const ZombieList& zombies = world.floor.zombies;
+    drawList.clear();
+    drawList.add(DrawLayer::Entities, player.pos.y + player.size, DrawMaterial::Player, 0);
+    for (int i = 0; i < (int)zombies.size(); ++i) {
+        drawList.add(DrawLayer::Entities, zombies[i].pos.y + zombies[i].size, zombies[i].kind, (uint32_t)i);
+    }
+    drawList.add(DrawLayer::Projectiles, 0.0f, DrawMaterial::Bullets, 0);
+    drawList.add(DrawLayer::Projectiles, 0.0f, DrawMaterial::Spit, 0);
+}
+
+int main(int argc, char** argv) {
+    int zombieCount = argc > 1 ? atoi(argv[1]) : 20000;
+    int frames = argc > 2 ? atoi(argv[2]) : 300;
+    uint64_t seed = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1;
+    if (zombieCount < 1) zombieCount = 1;
+    if (frames < 1) frames = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(1200.0f, 800.0f);
+    world.start(CreatePistol(), seed);
+    world.setHordeMode(true);
+    world.waveDirector.setConfig(WaveConfig::Horde(zombieCount));
+    world.floor.zombies.reserve(zombieCount);
+
+    // Hold still and let the horde arrive; nobody shoots, so nobody dies
+    PlayerInput input = { { 0, 0 }, { world.width, world.height / 2 }, false, false };
+    for (int i = 0; i < 2400 && (int)world.floor.zombies.size() < zombieCount; ++i) {
+        world.player.health = world.player.maxHealth;
+        world.step(TICK_SECONDS, input);
+    }
+
+    DrawList drawList;
+    std::vector<uint64_t> reference;
+    Timing fill, radix, comparison;
+    long long runs = 0;
+    int mismatches = 0;
+    for (int f = 0; f < frames; ++f) {
+        world.player.health = world.player.maxHealth;
+        world.step(TICK_SECONDS, input);
+
+        auto start = Clock::now();
+        FillDrawList(world, drawList);
+        fill.add(ElapsedUs(start));
+        reference.assign(drawList.getKeys().begin(), drawList.getKeys().end());
+
+        start = Clock::now();
+        drawList.sort();
+        radix.add(ElapsedUs(start));
+
+        start = Clock::now();
+        std::sort(reference.begin(), reference.end());
+        comparison.add(ElapsedUs(start));
+
+        if (reference != drawList.getKeys()) mismatches++;
+        drawList.forEachRun([&](DrawMaterial, const int*, int) { runs++; });
+    }
+
+    printf("Draw list: %d items per frame (%d zombies), %d frames, seed %llu\n", drawList.getCount(),
+           (int)world.floor.zombies.size(), frames, (unsigned long long)seed);
+    printf("  Fill:        %8.1f us mean, %8.1f us worst\n", fill.total / frames, fill.worst);
+    printf("  Radix sort:  %8.1f us mean, %8.1f us worst\n", radix.total / frames, radix.worst);
+    printf("  std::sort:   %8.1f us mean, %8.1f us worst\n", comparison.total / frames, comparison.worst);
+    printf("  Runs:        %8.1f per frame (batched draw calls into the material renderers)\n", (double)runs / frames);
+    if (mismatches > 0) {
+        printf("FAILED: the radix sort's order differs from std::sort on %d frames\n", mismatches);
+        return 1;
+    }
+    printf("  Radix order matches std::sort on every frame\n");
+    return 0;
+}
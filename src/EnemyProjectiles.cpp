@@ -0,0 +1,57 @@
+#include "EnemyProjectiles.h"
+#include "OccupancyGrid.h"
+
+const int EnemyProjectiles::DEFAULT_CAPACITY = 2048;
+const float EnemyProjectiles::RADIUS = 5.0f;
+
+EnemyProjectiles::EnemyProjectiles(int capacity)
+    : x(capacity), y(capacity), vx(capacity), vy(capacity), life(capacity), damage(capacity), count(0) {}
+
+bool EnemyProjectiles::spawn(const EnemyProjectile& projectile) {
+    if (count == getCapacity()) return false;
+    x[count] = projectile.pos.x;
+    y[count] = projectile.pos.y;
+    vx[count] = projectile.velocity.x;
+    vy[count] = projectile.velocity.y;
+    life[count] = projectile.life;
+    damage[count] = projectile.damage;
+    count++;
+    return true;
+}
+
+void EnemyProjectiles::remove(int index) {
+    int last = --count;
+    x[index] = x[last];
+    y[index] = y[last];
+    vx[index] = vx[last];
+    vy[index] = vy[last];
+    life[index] = life[last];
+    damage[index] = damage[last];
+}
+
+int EnemyProjectiles::update(float deltaTime, Vector2 target, float targetRadius, const OccupancyGrid& walls) {
+    // Moving is a pure streaming pass over the arrays; the tests below need the results anyway
+    for (int i = 0; i < count; ++i) {
+        x[i] += vx[i] * deltaTime;
+        y[i] += vy[i] * deltaTime;
+        life[i] -= deltaTime;
+    }
+
+    // A step is a few pixels, well under the thinnest wall, so testing the end point cannot tunnel
+    float reach = targetRadius + RADIUS;
+    float reachSq = reach * reach;
+    int damageDealt = 0;
+    for (int i = 0; i < count;) {
+        float dx = x[i] - target.x;
+        float dy = y[i] - target.y;
+        if (dx * dx + dy * dy < reachSq) {
+            damageDealt += damage[i];
+            remove(i); // Re-test the same slot: it now holds the last projectile
+        } else if (life[i] <= 0.0f || walls.containsPoint({ x[i], y[i] })) {
+            remove(i);
+        } else {
+            ++i;
+        }
+    }
+    return damageDealt;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+class OccupancyGrid;
+
+// One enemy projectile, for handing projectiles in and out of the pool (checkpoints, tools)
+struct EnemyProjectile {
+    Vector2 pos;
+    Vector2 velocity;
+    float life; // Seconds left before it fizzles out
+    int damage;
+};
+
+// Projectiles fired by zombies, in one pool shared by every shooter. Storage is structure of
+// arrays, so the per-tick sweep streams through exactly the fields it reads. The pool is sized
+// once up front: a shot fired into a full pool is dropped rather than grown, and spent projectiles
+// are swap-removed (live ones stay packed in [0, getCount())), so updating never allocates and
+// costs the same per live projectile however many there are.
+class EnemyProjectiles {
+public:
+    static const int DEFAULT_CAPACITY;
+    static const float RADIUS;
+
+    explicit EnemyProjectiles(int capacity = DEFAULT_CAPACITY);
+
+    // False (and the shot is dropped) when the pool is full
+    bool spawn(const EnemyProjectile& projectile);
+
+    // Moves every projectile. Those that reach the body of radius 'targetRadius' at 'target' are
+    // spent and their damage summed into the return value; those that end up inside a wall (looked
+    // up in the occupancy grid) or run out of life are spent without harm.
+    int update(float deltaTime, Vector2 target, float targetRadius, const OccupancyGrid& walls);
+
+    void clear() { count = 0; }
+
+    EnemyProjectile get(int index) const { return { { x[index], y[index] }, { vx[index], vy[index] }, life[index], damage[index] }; }
+    int getCount() const { return count; }
+    int getCapacity() const { return (int)x.size(); }
+
+    // The live projectiles are [0, getCount()) of each array
+    std::vector<float> x, y;
+    std::vector<float> vx, vy;
+    std::vector<float> life;
+    std::vector<int> damage;
+
+private:
+    int count;
+
+    void remove(int index); // Moves the last live projectile into 'index'
+};
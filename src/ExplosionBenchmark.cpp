@@ -0,0 +1,124 @@
+// ExplosionBenchmark.cpp
+// Area-damage benchmark: a fixed-seed World is filled to N zombies (horde spawning, player kept
+// alive and not shooting), then hit by volleys of simultaneous explosions at random points.
+// Each volley is resolved twice from the same checkpoint: through World::detonate (ZombieGrid
+// radius queries, after the one grid rebuild World::step does per tick with detonations) and by a
+// linear scan of every zombie per explosion with the same falloff. Reports the cost per volley
+// and per explosion for both, and exits 1 unless both leave every zombie with the same health.
+//
+// Usage: blast_bench [zombies=10000] [explosions=100] [volleys=20] [seed=1]
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "WorldCheckpoint.h"
+#include "raymath.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+static const float BLAST_RADIUS = 110.0f; // As CreateLauncher()
+static const int BLAST_DAMAGE = 80;
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// The reference: every zombie tested against every explosion
+static int DetonateLinear(World& world, Vector2 center, float radius, int damage) {
+    int hits = 0;
+    for (Zombie& zombie : world.floor.zombies) {
+        if (zombie.currentState == Zombie::ZombieState::DYING || zombie.currentState == Zombie::ZombieState::DEAD) continue;
+        float distance = Vector2Distance(center, zombie.pos) - zombie.size;
+        if (distance > radius) continue;
+        if (distance < 0.0f) distance = 0.0f;
+        zombie.takeDamage(World::blastDamage(damage, radius, distance));
+        hits++;
+    }
+    return hits;
+}
+
+static void CollectHealth(const World& world, std::vector<int>& health) {
+    health.clear();
+    for (const Zombie& zombie : world.floor.zombies) health.push_back(zombie.health);
+}
+
+int main(int argc, char** argv) {
+    int zombieCount = argc > 1 ? atoi(argv[1]) : 10000;
+    int explosionCount = argc > 2 ? atoi(argv[2]) : 100;
+    int volleys = argc > 3 ? atoi(argv[3]) : 20;
+    uint64_t seed = argc > 4 ? strtoull(argv[4], nullptr, 10) : 1;
+    if (zombieCount < 1) zombieCount = 1;
+    if (explosionCount < 1) explosionCount = 1;
+    if (volleys < 1) volleys = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(1200.0f, 800.0f);
+    world.start(CreateLauncher(), seed);
+    world.setHordeMode(true);
+    world.waveDirector.setConfig(WaveConfig::Horde(zombieCount));
+    world.floor.zombies.reserve(zombieCount);
+
+    // Hold still and let the horde arrive; nobody shoots, so nobody dies
+    PlayerInput input = { { 0, 0 }, { world.width, world.height / 2 }, false, false };
+    for (int i = 0; i < 1200 && (int)world.floor.zombies.size() < zombieCount; ++i) {
+        world.player.health = world.player.maxHealth;
+        world.step(TICK_SECONDS, input);
+    }
+
+    WorldCheckpoint checkpoint;
+    SaveCheckpoint(world, checkpoint);
+
+    Rng rng(seed * 7919);
+    std::vector<Vector2> centers(explosionCount);
+    std::vector<int> gridHealth, linearHealth;
+    double buildUs = 0.0, gridUs = 0.0, linearUs = 0.0;
+    long long gridHits = 0, linearHits = 0;
+    int mismatches = 0;
+
+    for (int v = 0; v < volleys; ++v) {
+        for (Vector2& center : centers) {
+            center = { rng.range(0, (int)world.width) + 0.5f, rng.range(0, (int)world.height) + 0.5f };
+        }
+
+        RestoreCheckpoint(world, checkpoint);
+        auto start = Clock::now();
+        world.zombieGrid.build(world.floor.zombies, world.width, world.height);
+        buildUs += ElapsedUs(start);
+        start = Clock::now();
+        for (const Vector2& center : centers) gridHits += world.detonate(center, BLAST_RADIUS, BLAST_DAMAGE);
+        gridUs += ElapsedUs(start);
+        CollectHealth(world, gridHealth);
+
+        RestoreCheckpoint(world, checkpoint);
+        start = Clock::now();
+        for (const Vector2& center : centers) linearHits += DetonateLinear(world, center, BLAST_RADIUS, BLAST_DAMAGE);
+        linearUs += ElapsedUs(start);
+        CollectHealth(world, linearHealth);
+
+        if (gridHealth != linearHealth) mismatches++;
+    }
+
+    double gridVolleyUs = (buildUs + gridUs) / volleys;
+    double linearVolleyUs = linearUs / volleys;
+    printf("Explosions: %d zombies, %d volleys of %d blasts (radius %.0f, damage %d), seed %llu\n",
+           (int)world.floor.zombies.size(), volleys, explosionCount, BLAST_RADIUS, BLAST_DAMAGE,
+           (unsigned long long)seed);
+    printf("  Hits:    %.1f zombies per blast\n", (double)gridHits / ((double)volleys * explosionCount));
+    printf("  Grid:    %8.1f us per volley (rebuild %.1f us + queries %.1f us), %6.2f us per blast\n",
+           gridVolleyUs, buildUs / volleys, gridUs / volleys, gridUs / volleys / explosionCount);
+    printf("  Linear:  %8.1f us per volley, %6.2f us per blast\n", linearVolleyUs, linearUs / volleys / explosionCount);
+    printf("  Speedup: %.1fx\n", linearVolleyUs / (gridVolleyUs > 0.0 ? gridVolleyUs : 1.0));
+    if (mismatches > 0 || gridHits != linearHits) {
+        printf("FAILED: %d volleys left different health than the linear scan (%lld vs %lld hits)\n",
+               mismatches, gridHits, linearHits);
+        return 1;
+    }
+    printf("  All %d volleys match the linear scan\n", volleys);
+    return 0;
+}
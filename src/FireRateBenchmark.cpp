@@ -0,0 +1,162 @@
+// FireRateBenchmark.cpp
+// Sustained-fire check. Each projectile weapon is fired with the trigger held for a few seconds by
+// a player standing still in an empty, wall-less world, stepped at tick rates from a 10 Hz server
+// to a 144 Hz display. Every bullet stays in flight, so the run can count the shots fired against
+// fireRate x time, and measure the gap between consecutive bullets: shots timed on the fire rate's
+// own grid and aged within their step sit exactly bulletSpeed / fireRate apart. For reference it
+// prints the rate the weapon would reach if it fired at most once per step and restarted its
+// cooldown at the step's end: 1 / (ceil(interval / step) x step).
+// Then the bullets' hit test under load: bullets scattered over a crowd of zombies, flying in every
+// direction, are stepped through World::updatePlayer once with the zombie grid and once with a
+// one-cell grid, which makes every zombie a candidate for every bullet (a linear scan). Reports the
+// update cost per step of each.
+// Exits 1 if any run fires more than one shot off the expected count or spaces two bullets more
+// than 0.5 px off, or if the two hit tests under load hit different zombies.
+//
+// Usage: fire_bench [seconds=2] [seed=1]
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "ZombieTypes.h"
+#include "raymath.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+// Long enough that no bullet reaches the edge within the run, so none are dropped
+static const float WORLD_WIDTH = 4000.0f;
+static const float WORLD_HEIGHT = 800.0f;
+
+static const float LOAD_WORLD_WIDTH = 1200.0f;
+static const float LOAD_WORLD_HEIGHT = 800.0f;
+static const int LOAD_ZOMBIES = 4000;
+static const int LOAD_STEPS = 20;
+static const int LOAD_ZOMBIE_HEALTH = 1000000; // Nobody dies: every step sees the same crowd
+
+struct LoadResult {
+    double updateUs = 0.0; // Per step
+    int hits = 0;
+    uint64_t damage = 0; // Hash of every zombie's health afterwards: which zombies were hit
+};
+
+// Nothing spawns and nothing stands in the way: the shots are all there is
+static void MakeEmptyWorld(World& world, WeaponType weapon, uint64_t seed) {
+    world.start(CreateWeapon(weapon), seed);
+    world.waveDirector.setConfig({ 0.0f, 0.0f, 0, 0 });
+    Floor& floor = world.floor;
+    floor.walls.clear();
+    floor.wallHealth.clear();
+    floor.wallIndex.build(floor.walls, world.width, world.height);
+    floor.occupancy.build(floor.walls, world.width, world.height);
+}
+
+// 'bullets' fresh bullets a step, at 60 Hz, over LOAD_ZOMBIES zombies indexed with 'cellSize'
+static LoadResult RunBulletLoad(int bullets, float cellSize, uint64_t seed) {
+    World world(LOAD_WORLD_WIDTH, LOAD_WORLD_HEIGHT);
+    world.start(CreateMinigun(), seed);
+    Rng rng(seed);
+    ZombieList& zombies = world.floor.zombies;
+    for (int i = 0; i < LOAD_ZOMBIES; ++i) {
+        Vector2 pos = { (float)rng.range(0, (int)LOAD_WORLD_WIDTH), (float)rng.range(0, (int)LOAD_WORLD_HEIGHT) };
+        zombies.push_back(MakeZombie((ZombieKind)(i % ZOMBIE_KIND_COUNT), pos));
+        zombies.back().health = LOAD_ZOMBIE_HEALTH;
+    }
+    ZombieGrid grid;
+    grid.build(zombies, world.width, world.height, cellSize);
+
+    LoadResult result;
+    Player& player = world.player;
+    float deltaTime = 1.0f / 60.0f;
+    for (int step = 0; step < LOAD_STEPS; ++step) {
+        player.bullets.clear();
+        for (int b = 0; b < bullets; ++b) {
+            Vector2 pos = { (float)rng.range(0, (int)LOAD_WORLD_WIDTH), (float)rng.range(0, (int)LOAD_WORLD_HEIGHT) };
+            Vector2 direction = Vector2Normalize({ (float)rng.range(-100, 100), (float)rng.range(-100, 100) });
+            if (direction.x == 0.0f && direction.y == 0.0f) direction = { 1, 0 };
+            player.bullets.emplace_back(pos, Vector2Scale(direction, player.weapon.bulletSpeed), player.weapon.damage);
+        }
+        auto start = std::chrono::steady_clock::now();
+        World::updatePlayer(player, deltaTime, zombies, grid, world.floor.walls, { world.width, world.height });
+        result.updateUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        player.wallHits.clear();
+    }
+    result.updateUs /= LOAD_STEPS;
+    for (const Zombie& zombie : zombies) {
+        result.hits += (LOAD_ZOMBIE_HEALTH - zombie.health) / player.weapon.damage;
+        result.damage = result.damage * 1000003u + (uint64_t)zombie.health;
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    float seconds = argc > 1 ? (float)atof(argv[1]) : 2.0f;
+    uint64_t seed = argc > 2 ? strtoull(argv[2], nullptr, 10) : 1;
+    if (seconds < 0.5f) seconds = 0.5f;
+    if (seconds > 2.0f) seconds = 2.0f; // Keeps the fastest bullet inside the world
+
+    SetTraceLogLevel(LOG_WARNING);
+    const WeaponType weapons[] = { WeaponType::Pistol, WeaponType::Rifle, WeaponType::Minigun };
+    const int tickRates[] = { 10, 20, 30, 60, 144 };
+
+    printf("Sustained fire: trigger held for %.1f s, seed %llu\n", seconds, (unsigned long long)seed);
+    printf("  %-8s %5s %6s %9s %8s %12s %12s\n", "weapon", "tick", "shots", "expected", "rate/s", "snapped/s", "gap error");
+    bool passed = true;
+    for (WeaponType type : weapons) {
+        for (int tickRate : tickRates) {
+            World world(WORLD_WIDTH, WORLD_HEIGHT);
+            MakeEmptyWorld(world, type, seed);
+            Player& player = world.player;
+            float fireRate = player.weapon.fireRate;
+            float interval = 1.0f / fireRate;
+            float deltaTime = 1.0f / tickRate;
+            int steps = (int)std::lround(seconds * tickRate);
+
+            PlayerInput input = { { 0, 0 }, { world.width, player.pos.y }, true, false };
+            for (int i = 0; i < steps; ++i) world.step(deltaTime, input);
+
+            // The first shot leaves at the end of the first step, the rest one interval apart
+            int shots = (int)player.bullets.size();
+            int expected = (int)std::floor((steps - 1) * deltaTime / interval + 1e-3f) + 1;
+            float firstShot = deltaTime;
+            float rate = shots > 1 ? (shots - 1) / (player.weapon.lastFireTime - firstShot) : 0.0f;
+            float snapped = 1.0f / (std::ceil(interval / deltaTime - 1e-4f) * deltaTime);
+
+            // Older bullets are further along; each should lead the next by one interval of flight
+            float gap = player.weapon.bulletSpeed * interval;
+            float worstGap = 0.0f;
+            for (size_t b = 1; b < player.bullets.size(); ++b) {
+                float d = player.bullets[b - 1].pos.x - player.bullets[b].pos.x;
+                worstGap = std::max(worstGap, std::fabs(d - gap));
+            }
+
+            bool ok = std::abs(shots - expected) <= 1 && worstGap <= 0.5f;
+            printf("  %-8s %3d Hz %6d %9d %8.2f %12.2f %9.3f px%s\n", GetWeaponName(type), tickRate, shots, expected, rate,
+                   snapped, worstGap, ok ? "" : "  <-- FAILED");
+            passed = passed && ok;
+        }
+    }
+
+    if (!passed) {
+        printf("FAILED: a run fired off its rate or spaced its bullets unevenly\n");
+        return 1;
+    }
+    printf("  Every run held its fire rate with evenly spaced bullets\n");
+
+    printf("Bullet hit tests: %d zombies, bullets in flight at 60 Hz, %d steps\n", LOAD_ZOMBIES, LOAD_STEPS);
+    printf("  %7s %12s %12s %8s %7s\n", "bullets", "grid us", "linear us", "speedup", "hits");
+    const int bulletCounts[] = { 100, 500, 2000 };
+    for (int bullets : bulletCounts) {
+        LoadResult grid = RunBulletLoad(bullets, ZombieGrid::DEFAULT_CELL_SIZE, seed);
+        LoadResult linear = RunBulletLoad(bullets, std::max(LOAD_WORLD_WIDTH, LOAD_WORLD_HEIGHT), seed);
+        printf("  %7d %12.1f %12.1f %7.1fx %7d\n", bullets, grid.updateUs, linear.updateUs,
+               grid.updateUs > 0.0 ? linear.updateUs / grid.updateUs : 0.0, grid.hits);
+        if (grid.hits != linear.hits || grid.damage != linear.damage) {
+            printf("FAILED: the grid hit %d zombies where a linear scan hits %d, or hit different ones\n", grid.hits, linear.hits);
+            return 1;
+        }
+    }
+    return 0;
+}
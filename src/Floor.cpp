@@ -0,0 +1,33 @@
+#include "Floor.h"
+
+const size_t Floor::DEFAULT_ARENA_BYTES = 1024 * 1024; // Fits a full horde floor without overflowing
+const float Floor::WALL_HEALTH_PER_PIXEL = 2.0f;
+
+Floor::Floor(size_t arenaBytes)
+    : number(0), arena(arenaBytes), walls(&arena), wallHealth(&arena), wallIndex(&arena), occupancy(&arena), spawnPoints(&arena), zombies(&arena) {}
+
+void Floor::reset(int newFloorNumber) {
+    if (number > 0) {
+        const FloorArena::Stats& stats = arena.getStats();
+        TraceLog(LOG_INFO, "FLOOR ARENA: floor %d: %zu allocations, peak %zu / %zu bytes, %zu overflow chunks (%zu bytes)",
+                 number, stats.allocations, stats.bytesAllocated, arena.getCapacity(),
+                 stats.overflowChunks, stats.overflowBytes);
+    }
+
+    // Swap the storage out into temporaries so no container still points into the arena,
+    // then rewind it. Both sides use the same arena, so the pmr swap is well defined.
+    WallList(&arena).swap(walls);
+    WallHealthList(&arena).swap(wallHealth);
+    wallIndex.release();
+    occupancy.release();
+    SpawnPointList(&arena).swap(spawnPoints);
+    ZombieList(&arena).swap(zombies);
+    arena.reset();
+
+    number = newFloorNumber;
+}
+
+int Floor::maxWallHealth(const Rectangle& wall) {
+    float longSide = wall.width > wall.height ? wall.width : wall.height;
+    return (int)(longSide * WALL_HEALTH_PER_PIXEL);
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "FloorArena.h"
+#include "Zombie.h"
+#include "WallIndex.h"
+#include "OccupancyGrid.h"
+
+// Everything that lives for exactly one floor. All containers allocate from the floor's
+// arena, which is rewound in one step when the floor is left (advance or restart).
+class Floor {
+public:
+    static const size_t DEFAULT_ARENA_BYTES;
+    static const float WALL_HEALTH_PER_PIXEL; // Hit points per pixel of a wall's longer side
+
+    // Hit points of an intact wall (or a fresh fragment of a broken one)
+    static int maxWallHealth(const Rectangle& wall);
+
+    explicit Floor(size_t arenaBytes = DEFAULT_ARENA_BYTES);
+
+    Floor(const Floor&) = delete;
+    Floor& operator=(const Floor&) = delete;
+
+    // Logs the outgoing floor's arena stats, drops all per-floor data and rewinds the arena.
+    // Containers keep their identity (references to them stay valid) but start empty.
+    void reset(int newFloorNumber);
+
+    int number;
+
+    FloorArena arena; // Declared before the containers it backs so it outlives them
+    WallList walls;
+    WallHealthList wallHealth;  // Parallel to 'walls'; a wall breaks when it reaches 0
+    WallIndex wallIndex;        // Built from 'walls' once they are generated
+    OccupancyGrid occupancy;    // Likewise; answers raycasts and line-of-sight queries
+    SpawnPointList spawnPoints; // Filled by WaveDirector::beginFloor
+    ZombieList zombies;
+};
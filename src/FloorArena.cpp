@@ -0,0 +1,33 @@
+#include "FloorArena.h"
+
+FloorArena::FloorArena(size_t capacityBytes)
+    : capacity(capacityBytes), buffer(new std::byte[capacityBytes]),
+      stats({ 0, 0, 0, 0, 0 }), overflow(stats),
+      monotonic(buffer.get(), capacityBytes, &overflow) {}
+
+void FloorArena::reset() {
+    // Drops any overflow chunks and rewinds to the initial buffer; no per-object work
+    monotonic.release();
+    stats = { 0, 0, 0, 0, 0 };
+}
+
+void* FloorArena::do_allocate(size_t bytes, size_t alignment) {
+    stats.allocations++;
+    stats.bytesAllocated += bytes;
+    return monotonic.allocate(bytes, alignment);
+}
+
+void FloorArena::do_deallocate(void* /*p*/, size_t /*bytes*/, size_t /*alignment*/) {
+    // Monotonic: memory comes back in one go on reset()
+    stats.deallocations++;
+}
+
+void* FloorArena::OverflowCounter::do_allocate(size_t bytes, size_t alignment) {
+    stats.overflowChunks++;
+    stats.overflowBytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void FloorArena::OverflowCounter::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
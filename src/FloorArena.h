@@ -0,0 +1,64 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// Linear (monotonic) allocator owned by the current floor. Every per-floor container
+// allocates from it through std::pmr, individual frees are no-ops, and reset() rewinds
+// the whole floor's memory at once instead of freeing container by container.
+// Allocation counts and the high-water mark are tracked per floor for instrumentation.
+class FloorArena : public std::pmr::memory_resource {
+public:
+    struct Stats {
+        size_t allocations;    // Calls to allocate() since the last reset
+        size_t deallocations;  // Logical frees (memory is only reclaimed by reset)
+        size_t bytesAllocated; // Peak footprint: nothing is reclaimed until reset
+        size_t overflowChunks; // Heap chunks fetched because the initial buffer ran out
+        size_t overflowBytes;
+    };
+
+    explicit FloorArena(size_t capacityBytes);
+
+    FloorArena(const FloorArena&) = delete;
+    FloorArena& operator=(const FloorArena&) = delete;
+
+    // Rewinds to the start of the initial buffer. All memory handed out so far becomes invalid,
+    // so every container backed by the arena must be emptied (not just cleared) first.
+    void reset();
+
+    const Stats& getStats() const { return stats; }
+    size_t getCapacity() const { return capacity; }
+
+private:
+    // Forwards to the global heap and counts what the monotonic resource asks for once its buffer is full
+    class OverflowCounter : public std::pmr::memory_resource {
+    public:
+        explicit OverflowCounter(Stats& stats) : stats(stats) {}
+    private:
+        Stats& stats;
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    size_t capacity;
+    std::unique_ptr<std::byte[]> buffer;
+    Stats stats;
+    OverflowCounter overflow;
+    std::pmr::monotonic_buffer_resource monotonic;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Walls of the current floor, backed by the floor's arena
+using WallList = std::pmr::vector<Rectangle>;
+
+// Remaining hit points of each wall, parallel to the WallList
+using WallHealthList = std::pmr::vector<int>;
+
+// Pre-validated zombie spawn positions of the current floor (see WaveDirector)
+using SpawnPointList = std::pmr::vector<Vector2>;
@@ -0,0 +1,182 @@
+#include "FloorLayer.h"
+#include "Renderer.h"
+#include "Floor.h"
+#include <cmath>
+
+static const float WALL_SHADOW_OFFSET = 4.0f;
+
+FloorLayer::FloorLayer(int width, int height)
+    : width(width), height(height), target({}), wallTarget({}), valid(false), wallsValid(false), shading(true), scorchCount(0) {}
+
+FloorLayer::~FloorLayer() {
+    unload();
+}
+
+void FloorLayer::drawBackground(Renderer& renderer) const {
+    // Dungeon floor: dark concrete/stone background
+    renderer.clearBackground(Color{ 35, 30, 25, 255 });
+
+    // Add subtle grid lines for stone tiles to give it a dungeon feel
+    int gridSize = 100; // Size of each "tile"
+    Color gridColor = ColorAlpha(Color{50, 45, 40, 255}, 0.5f); // Darker, semi-transparent lines
+
+    for (int x = 0; x < width; x += gridSize) {
+        renderer.drawLine({ (float)x, 0 }, { (float)x, (float)height }, 1, gridColor);
+    }
+    for (int y = 0; y < height; y += gridSize) {
+        renderer.drawLine({ 0, (float)y }, { (float)width, (float)y }, 1, gridColor);
+    }
+
+    if (!shading) return;
+
+    // Add a subtle vignette effect around the edges for atmosphere
+    float screenW = (float)width;
+    float screenH = (float)height;
+    renderer.drawRectangle({ 0, 0, screenW, screenH / 4 }, ColorAlpha(BLACK, 0.4f)); // Top fade
+    renderer.drawRectangle({ 0, screenH - screenH / 4, screenW, screenH / 4 }, ColorAlpha(BLACK, 0.4f)); // Bottom fade
+    renderer.drawRectangle({ 0, 0, screenW / 4, screenH }, ColorAlpha(BLACK, 0.4f)); // Left fade
+    renderer.drawRectangle({ screenW - screenW / 4, 0, screenW / 4, screenH }, ColorAlpha(BLACK, 0.4f)); // Right fade
+}
+
+void FloorLayer::draw(Renderer& renderer) {
+    if (!renderer.usesGpu()) {
+        drawBackground(renderer);
+        return;
+    }
+
+    if (!valid) {
+        if (target.id == 0) target = LoadRenderTexture(width, height);
+        BeginTextureMode(target);
+        drawBackground(renderer);
+        EndTextureMode();
+        valid = true;
+        scorchCount = 0;
+    }
+
+    // Render textures are stored upside down, hence the negative source height
+    Rectangle src = { 0, 0, (float)width, -(float)height };
+    renderer.drawTexturePro(target.texture, src, { 0, 0, (float)width, (float)height }, { 0, 0 }, 0.0f, WHITE);
+}
+
+void FloorLayer::drawWall(Renderer& renderer, const Rectangle& wall, float condition) const {
+    // Wall Design Improvement: Add a subtle shadow and inner detail for a more realistic look
+    float detailInset = 5.0f; // For inner detail
+    float wear = 1.0f - condition;
+
+    // Draw shadow (slightly offset, darker color)
+    if (shading) renderer.drawRectangleRounded({wall.x + WALL_SHADOW_OFFSET, wall.y + WALL_SHADOW_OFFSET, wall.width, wall.height}, 0.3f, 5, ColorAlpha(BLACK, 0.5f));
+
+    // Draw main wall body (a grungier, brownish-grey for concrete/stone), darkening as it takes damage
+    renderer.drawRectangleRounded(wall, 0.3f, 5, Color{ (unsigned char)(90 - 30 * wear), (unsigned char)(80 - 28 * wear), (unsigned char)(70 - 25 * wear), 255 });
+
+    // Draw inner detail (simulates bricks/texture or lighter worn areas)
+    // Smaller rectangle slightly lighter
+    renderer.drawRectangleRounded({wall.x + detailInset, wall.y + detailInset, wall.width - 2 * detailInset, wall.height - 2 * detailInset}, 0.2f, 5,
+                                  Color{ (unsigned char)(110 - 35 * wear), (unsigned char)(100 - 32 * wear), (unsigned char)(90 - 30 * wear), 255 });
+
+    // Cracks along the long side once a third of it is gone, more of them below a third left
+    if (condition < 0.67f) {
+        bool horizontal = wall.width >= wall.height;
+        float length = horizontal ? wall.width : wall.height;
+        float across = horizontal ? wall.height : wall.width;
+        int cracks = condition < 0.33f ? 4 : 2;
+        Color crackColor = Color{ 35, 30, 25, 255 };
+        for (int i = 0; i < cracks; ++i) {
+            float along = length * (i + 1) / (cracks + 1);
+            float lean = (i % 2 == 0 ? 0.3f : -0.3f) * across;
+            Vector2 a = horizontal ? Vector2{ wall.x + along - lean, wall.y } : Vector2{ wall.x, wall.y + along - lean };
+            Vector2 b = horizontal ? Vector2{ wall.x + along + lean, wall.y + across } : Vector2{ wall.x + across, wall.y + along + lean };
+            renderer.drawLine(a, b, 2.0f, crackColor);
+        }
+    }
+
+    // Draw a subtle dark border to define the shape more clearly
+    renderer.drawRectangleRoundedLines(wall, 0.3f, 5, Color{60, 50, 40, 255});
+}
+
+void FloorLayer::drawWalls(Renderer& renderer, const Floor& floor) {
+    if (!renderer.usesGpu()) {
+        for (size_t i = 0; i < floor.walls.size(); ++i) {
+            drawWall(renderer, floor.walls[i], (float)floor.wallHealth[i] / Floor::maxWallHealth(floor.walls[i]));
+        }
+        return;
+    }
+
+    if (!wallsValid) {
+        if (wallTarget.id == 0) wallTarget = LoadRenderTexture(width, height);
+        BeginTextureMode(wallTarget);
+        BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+        ClearBackground(BLANK);
+        for (size_t i = 0; i < floor.walls.size(); ++i) {
+            drawWall(renderer, floor.walls[i], (float)floor.wallHealth[i] / Floor::maxWallHealth(floor.walls[i]));
+        }
+        EndBlendMode();
+        EndTextureMode();
+        wallsValid = true;
+    }
+
+    // Baked premultiplied (the shadows are black, everything else opaque), so the half-transparent
+    // shadows keep the same strength as when drawn straight onto the floor
+    Rectangle src = { 0, 0, (float)width, -(float)height };
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    renderer.drawTexturePro(wallTarget.texture, src, { 0, 0, (float)width, (float)height }, { 0, 0 }, 0.0f, WHITE);
+    EndBlendMode();
+}
+
+void FloorLayer::setShading(bool enabled) {
+    if (enabled == shading) return;
+    shading = enabled;
+    wallsValid = false;
+}
+
+void FloorLayer::redrawWalls(Renderer& renderer, const Floor& floor, Rectangle area) {
+    if (!wallsValid) return; // The next drawWalls() bakes everything anyway
+
+    // The area plus what its shadow and outline reach; neighbours overlapping it are redrawn in
+    // their usual order and clipped, so the patch matches a full bake
+    float margin = WALL_SHADOW_OFFSET + 2.0f;
+    Rectangle dirty = { area.x - margin, area.y - margin, area.width + 2 * margin, area.height + 2 * margin };
+    BeginTextureMode(wallTarget);
+    BeginScissorMode((int)floorf(dirty.x), (int)floorf(dirty.y), (int)ceilf(dirty.width) + 1, (int)ceilf(dirty.height) + 1);
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    ClearBackground(BLANK);
+    for (size_t i = 0; i < floor.walls.size(); ++i) {
+        const Rectangle& wall = floor.walls[i];
+        Rectangle reach = { wall.x - 2.0f, wall.y - 2.0f, wall.width + margin + 2.0f, wall.height + margin + 2.0f };
+        if (!CheckCollisionRecs(reach, dirty)) continue;
+        drawWall(renderer, wall, (float)floor.wallHealth[i] / Floor::maxWallHealth(wall));
+    }
+    EndBlendMode();
+    EndScissorMode();
+    EndTextureMode();
+}
+
+void FloorLayer::scorch(Vector2 center, float radius) {
+    scorchCount++;
+    if (!valid) return; // Not baked yet (or about to be re-baked): nothing to burn into
+
+    // Soft soot disc with a darker core and a few blotches, so marks do not look stamped
+    BeginTextureMode(target);
+    DrawCircleGradient((int)center.x, (int)center.y, radius * 0.8f, ColorAlpha(BLACK, 0.45f), BLANK);
+    DrawCircleGradient((int)center.x, (int)center.y, radius * 0.35f, ColorAlpha(Color{ 20, 12, 5, 255 }, 0.6f), BLANK);
+    for (int i = 0; i < 5; ++i) {
+        float angle = (float)GetRandomValue(0, 359) * DEG2RAD;
+        float distance = radius * 0.1f * (float)GetRandomValue(2, 6);
+        Vector2 blotch = { center.x + cosf(angle) * distance, center.y + sinf(angle) * distance };
+        DrawCircleGradient((int)blotch.x, (int)blotch.y, radius * 0.2f, ColorAlpha(BLACK, 0.35f), BLANK);
+    }
+    EndTextureMode();
+}
+
+void FloorLayer::unload() {
+    if (target.id != 0) {
+        UnloadRenderTexture(target);
+        target = {};
+    }
+    if (wallTarget.id != 0) {
+        UnloadRenderTexture(wallTarget);
+        wallTarget = {};
+    }
+    valid = false;
+    wallsValid = false;
+}
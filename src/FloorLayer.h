@@ -0,0 +1,62 @@
+#pragma once
+#include "raylib.h"
+
+class Renderer;
+class Floor;
+
+// The static floor under everything else (stone, tile lines, edge vignette), baked once per floor
+// into a render texture and drawn as a single quad. Explosions scorch it destructively: the mark
+// is drawn into the texture and stays until invalidate() (new floor, restart) bakes it afresh.
+// The walls (with their damage) live in a second, transparent texture drawn over the entities'
+// floor; when walls are hit or break only the area they covered is cleared and redrawn.
+// Without a GPU backend the background and walls are drawn directly every frame and scorch marks are counted only.
+class FloorLayer {
+public:
+    FloorLayer(int width, int height);
+    ~FloorLayer();
+
+    FloorLayer(const FloorLayer&) = delete;
+    FloorLayer& operator=(const FloorLayer&) = delete;
+
+    // Bakes the texture first if it is missing or invalidated
+    void draw(Renderer& renderer);
+
+    // Burns a blast mark of 'radius' into the floor
+    void scorch(Vector2 center, float radius);
+
+    // Draws the floor's walls, baking them first if the wall texture is missing or invalidated
+    void drawWalls(Renderer& renderer, const Floor& floor);
+
+    // Redraws the walls under 'area' (World::wallChanges) into the wall texture
+    void redrawWalls(Renderer& renderer, const Floor& floor, Rectangle area);
+
+    // Drops all scorch marks; the next draw() re-bakes a clean floor, and the walls too
+    void invalidate() { valid = false; wallsValid = false; }
+
+    // The wall layout changed other than by breaking (rewind, restore): re-bake the walls only
+    void invalidateWalls() { wallsValid = false; }
+
+    // Wall shadows and the edge vignette; the quality governor turns them off under load. The walls
+    // re-bake at once, the background at its next bake (keeping the scorch marks until then).
+    void setShading(bool enabled);
+    bool getShading() const { return shading; }
+
+    // Frees the texture; must run while the GL context still exists
+    void unload();
+
+    int getScorchCount() const { return scorchCount; } // Marks since the last bake
+
+private:
+    int width;
+    int height;
+    RenderTexture2D target;
+    RenderTexture2D wallTarget;
+    bool valid;
+    bool wallsValid;
+    bool shading;
+    int scorchCount;
+
+    void drawBackground(Renderer& renderer) const;
+    // One wall with its shadow, darker and cracked as 'condition' (health left, 1 = intact) drops
+    void drawWall(Renderer& renderer, const Rectangle& wall, float condition) const;
+};
@@ -0,0 +1,305 @@
+#include "GameServer.h"
+#include "WeaponTypes.h"
+#include <algorithm>
+#include <chrono>
+#include <utility> // For std::move
+
+GameServer::Config GameServer::DefaultConfig() {
+    Config config;
+    config.port = NET_DEFAULT_PORT;
+    config.maxSessions = 64;
+    config.tickRate = 60;
+    config.stateInterval = 2; // 30 Hz state
+    config.timeoutSeconds = 5.0f;
+    config.floorArenaBytes = 192 * 1024;
+    config.inputBufferTicks = 8;
+    return config;
+}
+
+GameServer::Session::Session(uint32_t id, const NetAddress& client, size_t floorArenaBytes)
+    : id(id), client(client), world(1200.0f, 800.0f, floorArenaBytes),
+      input({ { 0, 0 }, { 0, 0 }, false, false }), receivedSequence(0), lastInputSequence(0), lastHeardTick(0),
+      wallHash(0), wallFloor(0), wallRevision(0), clientWallRevision(0) {}
+
+GameServer::Telemetry::Telemetry(MetricsRegistry& registry)
+    : world(registry),
+      tickTime(registry.histogram("zh_server_tick_seconds", "Whole server tick: receive, step every session, send")),
+      sessions(registry.gauge("zh_server_sessions", "Live sessions")),
+      packetsIn(registry.counter("zh_server_packets_received_total", "Datagrams received")),
+      packetsOut(registry.counter("zh_server_packets_sent_total", "Datagrams sent")),
+      bytesIn(registry.counter("zh_server_received_bytes_total", "Bytes received")),
+      bytesOut(registry.counter("zh_server_sent_bytes_total", "Bytes sent")) {}
+
+GameServer::GameServer(const Config& config)
+    : config(config), nextSessionId(1), serverTick(0), stats() {}
+
+void GameServer::attachMetrics(MetricsRegistry& registry) {
+    telemetry.reset(new Telemetry(registry));
+}
+
+bool GameServer::start() {
+    if (!socket.open(config.port)) return false;
+    TraceLog(LOG_INFO, "SERVER: Listening on UDP port %d (%d Hz, up to %d sessions)",
+             (int)socket.getLocalPort(), config.tickRate, config.maxSessions);
+    return true;
+}
+
+void GameServer::stop() {
+    for (const auto& session : sessions) {
+        uint8_t packet[16];
+        ByteWriter writer(packet, sizeof(packet));
+        WriteNetHeader(writer, NetMessage::DISCONNECT);
+        writer.u32(session->id);
+        sendPacket(session->client, packet, writer.getSize());
+    }
+    sessions.clear();
+    socket.close();
+}
+
+void GameServer::tick() {
+    using Clock = std::chrono::steady_clock;
+    auto tickStart = Clock::now();
+    serverTick++;
+
+    receive();
+
+    float dt = getTickSeconds();
+    size_t zombies = 0, bullets = 0, enemyProjectiles = 0, arenaBytes = 0, arenaAllocations = 0; // Summed for the metrics
+    uint64_t timeoutTicks = (uint64_t)(config.timeoutSeconds * config.tickRate);
+    for (size_t i = 0; i < sessions.size();) {
+        Session& session = *sessions[i];
+        if (serverTick - session.lastHeardTick > timeoutTicks) {
+            TraceLog(LOG_INFO, "SERVER: Session %u timed out", session.id);
+            sessions.erase(sessions.begin() + i);
+            continue;
+        }
+
+        PlayerInput input = session.input;
+        input.dash = false; // A held input does not dash again
+        if (!session.inputs.empty()) {
+            input = session.inputs.front().input;
+            session.lastInputSequence = session.inputs.front().sequence;
+            session.inputs.pop_front();
+            session.input = input;
+        } else if (session.receivedSequence > 0) {
+            stats.inputsMissing++;
+        }
+
+        auto stepStart = Clock::now();
+        session.world.step(dt, input);
+        auto stepTime = Clock::now() - stepStart;
+        double stepUs = std::chrono::duration<double, std::micro>(stepTime).count();
+        stats.sessionSteps++;
+        stats.sessionStepUsTotal += stepUs;
+        stats.sessionStepUsMax = std::max(stats.sessionStepUsMax, stepUs);
+        if (!session.world.wallChanges.empty() || session.world.currentFloor != session.wallFloor) TrackWalls(session);
+        if (telemetry) {
+            telemetry->world.stepTime.record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(stepTime).count());
+            const World& world = session.world;
+            zombies += world.floor.zombies.size();
+            bullets += world.player.bullets.size();
+            enemyProjectiles += world.enemyProjectiles.getCount();
+            arenaBytes += world.floor.arena.getStats().bytesAllocated;
+            arenaAllocations += world.floor.arena.getStats().allocations;
+        }
+
+        if (serverTick % config.stateInterval == 0 || session.world.status != World::Status::PLAYING) {
+            sendState(session);
+        }
+        ++i;
+    }
+
+    auto tickTime = Clock::now() - tickStart;
+    double tickMs = std::chrono::duration<double, std::milli>(tickTime).count();
+    stats.ticks++;
+    stats.tickMsTotal += tickMs;
+    stats.tickMsMax = std::max(stats.tickMsMax, tickMs);
+
+    if (telemetry) {
+        telemetry->tickTime.record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(tickTime).count());
+        telemetry->sessions.set((double)sessions.size());
+        WorldMetrics& world = telemetry->world;
+        world.steps.add(sessions.size());
+        world.zombies.set((double)zombies);
+        world.bullets.set((double)bullets);
+        world.enemyProjectiles.set((double)enemyProjectiles);
+        world.arenaBytes.set((double)arenaBytes);
+        world.arenaAllocations.set((double)arenaAllocations);
+    }
+}
+
+void GameServer::receive() {
+    uint8_t packet[NET_MAX_PACKET_BYTES];
+    NetAddress from;
+    size_t size;
+    while ((size = socket.receive(from, packet, sizeof(packet))) > 0) {
+        stats.packetsIn++;
+        stats.bytesIn += size;
+        if (telemetry) {
+            telemetry->packetsIn.add();
+            telemetry->bytesIn.add(size);
+        }
+
+        ByteReader reader(packet, size);
+        NetMessage type;
+        if (!ReadNetHeader(reader, type)) continue; // Not ours
+        switch (type) {
+            case NetMessage::CONNECT: handleConnect(from, reader); break;
+            case NetMessage::INPUT: handleInput(from, reader); break;
+            case NetMessage::DISCONNECT: handleDisconnect(from, reader); break;
+            default: break; // Server-to-client messages are ignored
+        }
+    }
+}
+
+void GameServer::handleConnect(const NetAddress& from, ByteReader& reader) {
+    uint8_t weapon = reader.u8();
+    uint64_t seed = reader.u64();
+    if (reader.overflowed()) return;
+
+    // A resent CONNECT (our ACCEPT was lost) gets the existing session again
+    for (const auto& session : sessions) {
+        if (session->client == from) {
+            sendAccept(*session);
+            return;
+        }
+    }
+    if ((int)sessions.size() >= config.maxSessions) {
+        TraceLog(LOG_WARNING, "SERVER: Refusing connection, all %d sessions in use", config.maxSessions);
+        return;
+    }
+
+    std::unique_ptr<Session> session(new Session(nextSessionId++, from, config.floorArenaBytes));
+    if (seed == 0) seed = ((uint64_t)from.ip << 32) ^ ((uint64_t)from.port << 16) ^ serverTick ^ session->id;
+    session->world.start(CreateWeapon((WeaponType)weapon), seed);
+    TrackWalls(*session);
+    session->lastHeardTick = serverTick;
+    TraceLog(LOG_INFO, "SERVER: Session %u started for %u.%u.%u.%u:%d", session->id,
+             from.ip >> 24, (from.ip >> 16) & 255, (from.ip >> 8) & 255, from.ip & 255, (int)from.port);
+    sendAccept(*session);
+    sessions.push_back(std::move(session));
+}
+
+void GameServer::handleInput(const NetAddress& from, ByteReader& reader) {
+    uint32_t sessionId, sequence;
+    uint16_t wallRevision;
+    PlayerInput inputs[NET_INPUT_REDUNDANCY];
+    int count = ReadNetInput(reader, sessionId, wallRevision, sequence, inputs);
+    if (reader.overflowed() || count == 0 || sequence < (uint32_t)count) return;
+
+    Session* session = findSession(sessionId, from);
+    if (!session) return;
+    session->lastHeardTick = serverTick;
+    if (sequence <= session->receivedSequence) return; // Late or duplicate datagram
+    session->clientWallRevision = wallRevision;
+
+    // The datagram repeats the inputs before its newest; queue the ones not seen yet, in order
+    for (int i = 0; i < count; ++i) {
+        uint32_t inputSequence = sequence - (uint32_t)(count - 1 - i);
+        if (inputSequence <= session->receivedSequence) continue;
+        session->inputs.push_back({ inputSequence, inputs[i] });
+        session->receivedSequence = inputSequence;
+    }
+    while ((int)session->inputs.size() > config.inputBufferTicks) {
+        session->inputs.pop_front();
+        stats.inputsDropped++;
+    }
+}
+
+void GameServer::handleDisconnect(const NetAddress& from, ByteReader& reader) {
+    uint32_t sessionId = reader.u32();
+    for (size_t i = 0; i < sessions.size(); ++i) {
+        if (sessions[i]->id == sessionId && sessions[i]->client == from) {
+            TraceLog(LOG_INFO, "SERVER: Session %u disconnected", sessionId);
+            sessions.erase(sessions.begin() + i);
+            return;
+        }
+    }
+}
+
+GameServer::Session* GameServer::findSession(uint32_t id, const NetAddress& from) {
+    for (const auto& session : sessions) {
+        if (session->id == id && session->client == from) return session.get();
+    }
+    return nullptr;
+}
+
+void GameServer::sendAccept(const Session& session) {
+    uint8_t packet[16];
+    ByteWriter writer(packet, sizeof(packet));
+    WriteNetHeader(writer, NetMessage::ACCEPT);
+    writer.u32(session.id);
+    writer.u16((uint16_t)config.tickRate);
+    sendPacket(session.client, packet, writer.getSize());
+}
+
+void GameServer::sendState(const Session& session) {
+    uint8_t packet[NET_MAX_PACKET_BYTES];
+    ByteWriter writer(packet, sizeof(packet));
+    WriteNetState(writer, session.id, session.lastInputSequence, session.wallRevision, session.world);
+    if (writer.overflowed()) {
+        TraceLog(LOG_WARNING, "SERVER: STATE for session %u does not fit in one datagram", session.id);
+        return;
+    }
+    sendPacket(session.client, packet, writer.getSize());
+    if (session.clientWallRevision != session.wallRevision) sendWalls(session); // Until the client has them
+}
+
+void GameServer::sendWalls(const Session& session) {
+    uint8_t packet[NET_MAX_PACKET_BYTES];
+    ByteWriter writer(packet, sizeof(packet));
+    WriteNetWalls(writer, session.id, session.wallRevision, session.world);
+    sendPacket(session.client, packet, writer.getSize());
+}
+
+void GameServer::TrackWalls(Session& session) {
+    // FNV-1a over the rectangles: damage that broke nothing leaves the hash, and the revision, as they were
+    uint64_t hash = 14695981039346656037ull;
+    for (const Rectangle& wall : session.world.floor.walls) {
+        const float fields[4] = { wall.x, wall.y, wall.width, wall.height };
+        const uint8_t* bytes = (const uint8_t*)fields;
+        for (size_t i = 0; i < sizeof(fields); ++i) hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    session.wallFloor = session.world.currentFloor;
+    if (hash == session.wallHash && session.wallRevision != 0) return;
+    session.wallHash = hash;
+    if (++session.wallRevision == 0) session.wallRevision = 1; // 0 means "none yet" to the client
+}
+
+void GameServer::sendPacket(const NetAddress& to, const uint8_t* data, size_t size) {
+    if (socket.send(to, data, size)) {
+        stats.packetsOut++;
+        stats.bytesOut += size;
+        if (telemetry) {
+            telemetry->packetsOut.add();
+            telemetry->bytesOut.add(size);
+        }
+    }
+}
+
+void GameServer::SessionMemory(const Session& session, size_t& reserved, size_t& used) {
+    const World& world = session.world;
+    const FloorArena& arena = world.floor.arena;
+    size_t bullets = sizeof(Bullet);
+    size_t spit = 5 * sizeof(float) + sizeof(int); // One slot across EnemyProjectiles' arrays
+    const EnemyProjectiles& projectiles = world.enemyProjectiles;
+    reserved = sizeof(Session) + arena.getCapacity() + arena.getStats().overflowBytes
+             + world.player.bullets.capacity() * bullets + projectiles.getCapacity() * spit;
+    used = sizeof(Session) + std::min(arena.getStats().bytesAllocated, arena.getCapacity())
+         + arena.getStats().overflowBytes + world.player.bullets.size() * bullets + projectiles.getCount() * spit;
+}
+
+GameServer::Stats GameServer::takeStats() {
+    Stats result = stats;
+    result.sessions = (int)sessions.size();
+    result.sessionBytesReserved = 0;
+    result.sessionBytesUsed = 0;
+    for (const auto& session : sessions) {
+        size_t reserved, used;
+        SessionMemory(*session, reserved, used);
+        result.sessionBytesReserved += reserved;
+        result.sessionBytesUsed += used;
+    }
+    stats = Stats();
+    return result;
+}
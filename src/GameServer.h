@@ -0,0 +1,131 @@
+#pragma once
+#include "UdpSocket.h"
+#include "NetProtocol.h"
+#include "World.h"
+#include "Metrics.h"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+// Authoritative headless server: one World per session, all stepped at a fixed tick from a
+// single thread. Clients connect over UDP, stream INPUT frames and receive a STATE datagram
+// every 'stateInterval' ticks. A session ends when its client disconnects or goes silent.
+//
+// Inputs are queued by sequence and each step consumes exactly one, so a client predicting its
+// player (PlayerPredictor) steps with the same inputs in the same order as the server. The queue
+// is a jitter buffer: a step that finds it empty holds the last input (without its dash) and the
+// client will have to correct; beyond 'inputBufferTicks' the oldest inputs are dropped.
+//
+// Sessions are single-player: World simulates one player, so "co-op" here means many
+// concurrent sessions in one process, not several clients sharing one world.
+class GameServer {
+public:
+    struct Config {
+        uint16_t port;
+        int maxSessions;
+        int tickRate;          // Simulation ticks per second
+        int stateInterval;     // Send STATE every N ticks
+        float timeoutSeconds;  // Drop a session after this long without hearing from its client
+        size_t floorArenaBytes; // Per-session floor arena (World/Floor); sized for normal waves, not hordes
+        int inputBufferTicks;   // Queued inputs kept per session
+    };
+
+    // Rolling counters since the last takeStats() call
+    struct Stats {
+        int sessions;
+        uint64_t ticks;               // Server ticks
+        uint64_t sessionSteps;        // World steps summed over sessions
+        double tickMsTotal;           // Whole server tick (receive + step + send)
+        double tickMsMax;
+        double sessionStepUsTotal;    // Per-session World::step cost, summed
+        double sessionStepUsMax;
+        uint64_t inputsMissing;       // Steps that found no queued input and held the last one
+        uint64_t inputsDropped;       // Queued inputs dropped to keep the queue within inputBufferTicks
+        uint64_t packetsIn, packetsOut;
+        uint64_t bytesIn, bytesOut;
+        size_t sessionBytesReserved;  // Sum over live sessions (see sessionMemory())
+        size_t sessionBytesUsed;
+    };
+
+    static Config DefaultConfig();
+
+    explicit GameServer(const Config& config);
+
+    bool start();
+    void stop();
+
+    // One fixed tick: drain incoming datagrams, step every session, send due states.
+    // The caller paces the calls (see ServerMain.cpp).
+    void tick();
+
+    int getSessionCount() const { return (int)sessions.size(); }
+    float getTickSeconds() const { return 1.0f / config.tickRate; }
+    uint16_t getPort() const { return socket.getLocalPort(); }
+
+    // Returns and clears the counters accumulated since the previous call
+    Stats takeStats();
+
+    // From now on, also records every tick into 'registry' (which must outlive the server): the
+    // tick and per-session step histograms, traffic counters, and the live population summed over
+    // sessions. Unlike Stats these are never reset, so they can be scraped at any rate.
+    void attachMetrics(MetricsRegistry& registry);
+
+private:
+    struct QueuedInput {
+        uint32_t sequence;
+        PlayerInput input;
+    };
+
+    struct Session {
+        uint32_t id;
+        NetAddress client;
+        World world;
+        std::deque<QueuedInput> inputs; // Received, not yet stepped, in sequence order
+        PlayerInput input;              // Last one stepped; held when the queue runs dry
+        uint32_t receivedSequence;      // Newest input queued
+        uint32_t lastInputSequence;     // Newest input stepped
+        uint64_t lastHeardTick;
+        uint64_t wallHash;              // Of the walls as of wallRevision
+        int wallFloor;
+        uint16_t wallRevision;          // Bumped whenever the walls change; never 0
+        uint16_t clientWallRevision;    // Revision the client last reported holding
+
+        Session(uint32_t id, const NetAddress& client, size_t floorArenaBytes);
+    };
+
+    struct Telemetry {
+        WorldMetrics world;
+        LatencyHistogram& tickTime;
+        MetricGauge& sessions;
+        MetricCounter& packetsIn;
+        MetricCounter& packetsOut;
+        MetricCounter& bytesIn;
+        MetricCounter& bytesOut;
+
+        explicit Telemetry(MetricsRegistry& registry);
+    };
+
+    Config config;
+    UdpSocket socket;
+    std::vector<std::unique_ptr<Session>> sessions;
+    uint32_t nextSessionId;
+    uint64_t serverTick;
+    Stats stats;
+    std::unique_ptr<Telemetry> telemetry; // Null until attachMetrics()
+
+    void receive();
+    void handleConnect(const NetAddress& from, ByteReader& reader);
+    void handleInput(const NetAddress& from, ByteReader& reader);
+    void handleDisconnect(const NetAddress& from, ByteReader& reader);
+    Session* findSession(uint32_t id, const NetAddress& from);
+    void sendAccept(const Session& session);
+    void sendState(const Session& session);
+    void sendWalls(const Session& session);
+    // Bumps the session's wall revision if its walls differ from the ones last sent
+    static void TrackWalls(Session& session);
+    void sendPacket(const NetAddress& to, const uint8_t* data, size_t size);
+
+    // Heap owned by one session: the World itself, its floor arena and the player's bullet storage
+    static void SessionMemory(const Session& session, size_t& reserved, size_t& used);
+};
@@ -0,0 +1,25 @@
+#include "HeapCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// One relaxed increment per allocation; the metrics turn the total into a rate
+static std::atomic<uint64_t> heapAllocations(0);
+
+void* operator new(std::size_t size) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+uint64_t HeapAllocationCount() {
+    return heapAllocations.load(std::memory_order_relaxed);
+}
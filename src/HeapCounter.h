@@ -0,0 +1,7 @@
+#pragma once
+#include <cstdint>
+
+// Calls to the global operator new since the process started. Counted by HeapCounter.cpp, which
+// replaces operator new/delete; only the binaries that link it (the game and the server) count,
+// so tools with their own replacement (spit_bench) keep theirs.
+uint64_t HeapAllocationCount();
@@ -0,0 +1,195 @@
+#include "HudLayer.h"
+#include "WeaponTypes.h" // GetWeaponName
+#include "raymath.h"     // Clamp
+#include "Renderer.h"
+#include <cstring>       // strlen
+
+// --- CachedText ---
+
+CachedText::CachedText()
+    : target({}), size({ 0, 0 }), key(0), valid(false), renderCount(0) {}
+
+CachedText::~CachedText() {
+    unload();
+}
+
+void CachedText::update(Renderer& renderer, int newKey, const char* text, float fontSize, float spacing, Color color) {
+    if (!needsUpdate(newKey)) return; // Nothing changed, keep the cached texture
+
+    if (!renderer.usesGpu()) {
+        // Headless: no font or render target available, approximate the default font's metrics
+        size = { (float)strlen(text) * (fontSize + spacing) * 0.5f, fontSize };
+        key = newKey;
+        valid = true;
+        renderCount++;
+        return;
+    }
+
+    Font font = GetFontDefault();
+    Vector2 measured = MeasureTextEx(font, text, fontSize, spacing);
+    int texWidth = (int)ceilf(measured.x);
+    int texHeight = (int)ceilf(measured.y);
+    if (texWidth < 1) texWidth = 1;
+    if (texHeight < 1) texHeight = 1;
+
+    // Reuse the render target when the text still fits, otherwise grow it
+    if (target.id == 0 || target.texture.width < texWidth || target.texture.height < texHeight) {
+        if (target.id != 0) UnloadRenderTexture(target);
+        target = LoadRenderTexture(texWidth, texHeight);
+    }
+
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+    DrawTextEx(font, text, { 0, 0 }, fontSize, spacing, color);
+    EndTextureMode();
+
+    size = measured;
+    key = newKey;
+    valid = true;
+    renderCount++;
+}
+
+void CachedText::draw(Renderer& renderer, Vector2 position) const {
+    if (!valid) return;
+    // Render textures are stored upside down, hence the negative source height
+    Rectangle src = { 0, 0, size.x, -size.y };
+    renderer.drawTexturePro(target.texture, src, { position.x, position.y, size.x, size.y }, { 0, 0 }, 0.0f, WHITE);
+}
+
+void CachedText::unload() {
+    if (target.id != 0) {
+        UnloadRenderTexture(target);
+        target = {};
+    }
+    valid = false;
+}
+
+// --- HudLayer ---
+
+HudLayer::HudLayer(int screenWidth, int screenHeight)
+    : screenWidth(screenWidth), screenHeight(screenHeight) {}
+
+void HudLayer::drawGameHUD(Renderer& renderer, const Player& player, int currentFloor, int maxFloors, int zombiesKilled, int zombiesPerFloor) {
+    // Top Bar Background: Semi-transparent dark bar across the top
+    renderer.drawRectangle({ 0, 0, (float)screenWidth, 70 }, ColorAlpha(BLACK, 0.7f));
+
+    // Game Title
+    titleText.update(renderer, 0, "ZOMBIE SURVIVAL", 30, 2, LIME);
+    titleText.draw(renderer, { 20, 18 });
+
+    // Floor Progress display
+    int floorKey = currentFloor * 1000 + maxFloors;
+    if (floorText.needsUpdate(floorKey)) {
+        floorText.update(renderer, floorKey, TextFormat("FLOOR: %d/%d", currentFloor, maxFloors), 25, 2, GOLD);
+    }
+    floorText.draw(renderer, { (float)screenWidth / 2 - 150, 25 });
+
+    // Zombies Killed / Remaining, turns green when all zombies for the floor are killed.
+    // The floor total is fixed for a run, so the kill count alone keys the cache.
+    Color zombieCountColor = (zombiesKilled >= zombiesPerFloor) ? GREEN : ORANGE;
+    if (killsText.needsUpdate(zombiesKilled)) {
+        killsText.update(renderer, zombiesKilled, TextFormat("ZOMBIES KILLED: %d/%d", zombiesKilled, zombiesPerFloor), 25, 2, zombieCountColor);
+    }
+    killsText.draw(renderer, { (float)screenWidth / 2 + 50, 25 });
+
+    // Player Health Bar (Bottom Left)
+    float healthBarWidth = 200;
+    float healthBarHeight = 25;
+    float healthX = 20;
+    float healthY = screenHeight - 40;
+
+    renderer.drawRectangle({ healthX, healthY, healthBarWidth, healthBarHeight }, ColorAlpha(DARKGRAY, 0.8f));
+    float currentHealthWidth = Clamp(player.health / 100.0f, 0.0f, 1.0f) * healthBarWidth;
+    Color healthColor = LIME;
+    if (player.health < 60) healthColor = YELLOW;
+    if (player.health < 30) healthColor = RED;
+    renderer.drawRectangle({ healthX, healthY, currentHealthWidth, healthBarHeight }, healthColor);
+    renderer.drawRectangleLines({ healthX, healthY, healthBarWidth, healthBarHeight }, 2, BLACK);
+
+    // Health text is keyed on the integer HP, so fractional damage-over-time doesn't re-render it
+    int hp = (int)player.health;
+    if (healthText.needsUpdate(hp)) {
+        healthText.update(renderer, hp, TextFormat("HP: %d", hp), 20, 2, WHITE);
+    }
+    healthText.draw(renderer, { healthX + healthBarWidth / 2 - healthText.width() / 2, healthY + 3 });
+
+    // Current Weapon Display (Bottom Right)
+    float weaponDisplayWidth = 180;
+    float weaponDisplayHeight = 25;
+    float weaponX = screenWidth - weaponDisplayWidth - 20;
+    float weaponY = screenHeight - 40;
+
+    renderer.drawRectangle({ weaponX, weaponY, weaponDisplayWidth, weaponDisplayHeight }, ColorAlpha(DARKGRAY, 0.8f));
+    int weaponKey = (int)player.weapon.type;
+    if (weaponText.needsUpdate(weaponKey)) {
+        weaponText.update(renderer, weaponKey, TextFormat("WEAPON: %s", GetWeaponName(player.weapon.type)), 20, 2, RAYWHITE);
+    }
+    weaponText.draw(renderer, { weaponX + 10, weaponY + 3 });
+    renderer.drawRectangleLines({ weaponX, weaponY, weaponDisplayWidth, weaponDisplayHeight }, 2, BLACK);
+
+    drawCrosshair(renderer);
+}
+
+void HudLayer::drawCrosshair(Renderer& renderer) const {
+    // Follows the mouse every frame, so it stays immediate-mode
+    Vector2 mouse = GetMousePosition();
+    float crosshairSize = 15.0f; // Length of each crosshair arm
+    float gap = 3.0f; // Gap from the center
+    Color crosshairColor = RED;
+
+    // Horizontal lines
+    renderer.drawLine({ mouse.x - crosshairSize, mouse.y }, { mouse.x - gap, mouse.y }, 2, crosshairColor);
+    renderer.drawLine({ mouse.x + gap, mouse.y }, { mouse.x + crosshairSize, mouse.y }, 2, crosshairColor);
+    // Vertical lines
+    renderer.drawLine({ mouse.x, mouse.y - crosshairSize }, { mouse.x, mouse.y - gap }, 2, crosshairColor);
+    renderer.drawLine({ mouse.x, mouse.y + gap }, { mouse.x, mouse.y + crosshairSize }, 2, crosshairColor);
+}
+
+void HudLayer::drawGameOverScreen(Renderer& renderer) {
+    renderer.clearBackground(Color{ 30, 0, 0, 255 }); // Dark red background for game over
+
+    // All strings are constant: rendered on first use, then just blitted
+    deadShadowText.update(renderer, 0, "YOU ARE DEAD!", 80, 2, DARKGRAY);
+    deadText.update(renderer, 0, "YOU ARE DEAD!", 80, 2, RED);
+    gameOverText.update(renderer, 0, "💀 GAME OVER 💀", 50, 2, WHITE);
+    restartText.update(renderer, 0, "R: Restart   F: Retry Floor   Backspace: Rewind", 30, 2, LIGHTGRAY);
+
+    float centerX = (float)screenWidth / 2;
+    float centerY = (float)screenHeight / 2;
+    deadShadowText.draw(renderer, { centerX - deadShadowText.width() / 2, centerY - 80 });     // Shadow text
+    deadText.draw(renderer, { centerX - deadText.width() / 2 - 5, centerY - 85 });             // Main text
+    gameOverText.draw(renderer, { centerX - gameOverText.width() / 2, centerY + 20 });
+    restartText.draw(renderer, { centerX - restartText.width() / 2, centerY + 100 });
+}
+
+void HudLayer::drawGameWinScreen(Renderer& renderer) {
+    renderer.clearBackground(Color{ 0, 30, 0, 255 }); // Dark green background for win
+
+    winShadowText.update(renderer, 0, "CONGRATULATIONS!", 80, 2, DARKGREEN);
+    winText.update(renderer, 0, "CONGRATULATIONS!", 80, 2, LIME);
+    allClearedText.update(renderer, 0, "🏆 ALL FLOORS CLEARED! YOU WIN! 🏆", 40, 2, GOLD);
+    playAgainText.update(renderer, 0, "Press R to Play Again", 30, 2, LIGHTGRAY);
+
+    float centerX = (float)screenWidth / 2;
+    float centerY = (float)screenHeight / 2;
+    winShadowText.draw(renderer, { centerX - winShadowText.width() / 2, centerY - 80 });       // Shadow
+    winText.draw(renderer, { centerX - winText.width() / 2 - 5, centerY - 85 });               // Main
+    allClearedText.draw(renderer, { centerX - allClearedText.width() / 2, centerY + 20 });
+    playAgainText.draw(renderer, { centerX - playAgainText.width() / 2, centerY + 100 });
+}
+
+void HudLayer::unload() {
+    titleText.unload();
+    floorText.unload();
+    killsText.unload();
+    healthText.unload();
+    weaponText.unload();
+    deadShadowText.unload();
+    deadText.unload();
+    gameOverText.unload();
+    restartText.unload();
+    winShadowText.unload();
+    winText.unload();
+    allClearedText.unload();
+    playAgainText.unload();
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "raylib.h"
+#include "Player.h"
+
+class Renderer;
+
+// A piece of text rendered once into its own texture and redrawn as a single quad.
+// The texture is only re-rendered when the caller's key (the value the text shows) changes.
+class CachedText {
+public:
+    CachedText();
+    ~CachedText();
+
+    CachedText(const CachedText&) = delete;
+    CachedText& operator=(const CachedText&) = delete;
+
+    // True when 'key' differs from the value the texture was rendered for.
+    // Check this before formatting the text so unchanged frames do no string work at all.
+    bool needsUpdate(int newKey) const { return !valid || newKey != key; }
+
+    // Re-renders the texture if 'key' differs from the last one.
+    // Without a GPU backend only the key and an approximate size are tracked.
+    void update(Renderer& renderer, int key, const char* text, float fontSize, float spacing, Color color);
+    void draw(Renderer& renderer, Vector2 position) const;
+    void unload();
+
+    float width() const { return size.x; }
+    float height() const { return size.y; }
+    int getRenderCount() const { return renderCount; } // How often the texture was rebuilt
+
+private:
+    RenderTexture2D target;
+    Vector2 size;
+    int key;
+    bool valid;
+    int renderCount;
+};
+
+// Retained HUD: everything that only changes when a game value changes (floor, kill count,
+// health integer, weapon, end screens) lives in CachedText textures. Per-frame cost in steady
+// state is a handful of rectangles and textured quads with no text formatting or measuring.
+class HudLayer {
+public:
+    HudLayer(int screenWidth, int screenHeight);
+
+    void drawGameHUD(Renderer& renderer, const Player& player, int currentFloor, int maxFloors, int zombiesKilled, int zombiesPerFloor);
+    void drawGameOverScreen(Renderer& renderer);
+    void drawGameWinScreen(Renderer& renderer);
+
+    // Frees all cached textures; must run while the GL context still exists
+    void unload();
+
+private:
+    int screenWidth;
+    int screenHeight;
+
+    // In-game HUD
+    CachedText titleText;
+    CachedText floorText;
+    CachedText killsText;
+    CachedText healthText;
+    CachedText weaponText;
+
+    // End screens (constant text, rendered once)
+    CachedText deadShadowText;
+    CachedText deadText;
+    CachedText gameOverText;
+    CachedText restartText;
+    CachedText winShadowText;
+    CachedText winText;
+    CachedText allClearedText;
+    CachedText playAgainText;
+
+    void drawCrosshair(Renderer& renderer) const;
+};
@@ -0,0 +1,59 @@
+#include "InputEvents.h"
+#include <algorithm>
+
+InputRecorder::InputRecorder(InputEventQueue& queue)
+    : queue(queue), last({ { 0, 0 }, { 0, 0 }, false, false }), dropped(0) {}
+
+void InputRecorder::push(InputEvent::Type type, double time, Vector2 value) {
+    if (!queue.push({ type, time, value })) dropped++;
+}
+
+void InputRecorder::record(double time, const PlayerInput& polled) {
+    if (polled.aim.x != last.aim.x || polled.aim.y != last.aim.y) push(InputEvent::Type::Aim, time, polled.aim);
+    if (polled.move.x != last.move.x || polled.move.y != last.move.y) push(InputEvent::Type::Move, time, polled.move);
+    if (polled.dash) push(InputEvent::Type::Dash, time, { 0, 0 });
+    if (polled.fire != last.fire) push(polled.fire ? InputEvent::Type::FirePressed : InputEvent::Type::FireReleased, time, { 0, 0 });
+    last = polled;
+}
+
+InputTimeline::InputTimeline() : held({ { 0, 0 }, { 0, 0 }, false, false }), lastPressTime(-1.0) {}
+
+PlayerInput InputTimeline::consume(InputEventQueue& queue, double stepStart, double stepEnd) {
+    PlayerInput input = held;
+    input.dash = false;
+    input.fireLead = 0.0f;
+    lastPressTime = -1.0;
+    bool pressed = false;
+
+    for (const InputEvent* event = queue.peek(); event && event->time <= stepEnd; event = queue.peek()) {
+        switch (event->type) {
+            case InputEvent::Type::FirePressed:
+                held.fire = true;
+                if (!input.fire) { // Not already held from the step before, or pressed earlier in this one
+                    input.fire = true;
+                    input.aim = held.aim;
+                    input.fireLead = (float)std::min(std::max(stepEnd - event->time, 0.0), stepEnd - stepStart);
+                    lastPressTime = event->time;
+                    pressed = true;
+                }
+                break;
+            case InputEvent::Type::FireReleased:
+                held.fire = false; // A press earlier in the step still fires
+                break;
+            case InputEvent::Type::Aim:
+                held.aim = event->value;
+                if (!pressed) input.aim = held.aim;
+                break;
+            case InputEvent::Type::Move:
+                held.move = event->value;
+                input.move = held.move;
+                break;
+            case InputEvent::Type::Dash:
+                input.dash = true;
+                break;
+        }
+        InputEvent done;
+        queue.pop(done);
+    }
+    return input;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "raylib.h"
+#include "SpscQueue.h"
+#include "World.h" // PlayerInput
+#include <cstdint>
+
+// One change of the player's controls, stamped with when it was seen
+struct InputEvent {
+    enum class Type : uint8_t {
+        FirePressed,
+        FireReleased,
+        Aim,  // value: the new aim point
+        Move, // value: the new movement direction
+        Dash
+    };
+    Type type;
+    double time;   // Seconds on the poller's clock (GetTime)
+    Vector2 value;
+};
+
+// Enough for several frames of a mouse moving every millisecond
+using InputEventQueue = SpscQueue<InputEvent, 1024>;
+
+// Producer side: compares each poll of the devices with the last one and queues what changed,
+// stamped with the poll's time. Polling more often than once a frame is what makes the stamps
+// finer than a frame.
+class InputRecorder {
+public:
+    explicit InputRecorder(InputEventQueue& queue);
+
+    // 'polled' is the devices' state at 'time'; its dash flag means "pressed since the last poll"
+    void record(double time, const PlayerInput& polled);
+
+    int getDropped() const { return dropped; } // Events lost to a full queue (nothing consuming)
+
+private:
+    InputEventQueue& queue;
+    PlayerInput last;
+    int dropped;
+
+    void push(InputEvent::Type type, double time, Vector2 value);
+};
+
+// Consumer side: folds the queued events into the PlayerInput of one World::step covering
+// (stepStart, stepEnd] on the poller's clock. Events after stepEnd stay queued for the next step.
+// - fire is set if the button was held at any point in the step, so a click shorter than a step
+//   still shoots; a press within the step sets fireLead, so the shot is timed at the press
+// - aim is where the player aimed at that press (a flick that fires and moves on hits where it
+//   fired), otherwise the latest aim
+// - move is the latest direction; dash is set if it was pressed during the step
+class InputTimeline {
+public:
+    InputTimeline();
+
+    PlayerInput consume(InputEventQueue& queue, double stepStart, double stepEnd);
+
+    // The first press consumed by the last consume(), or a negative time if there was none
+    double getLastPressTime() const { return lastPressTime; }
+
+private:
+    PlayerInput held; // State as of the last consumed event
+    double lastPressTime;
+};
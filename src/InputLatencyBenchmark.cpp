@@ -0,0 +1,190 @@
+// InputLatencyBenchmark.cpp
+// Click-to-muzzle-flash check on a virtual clock. A fixed-seed stream of clicks (mostly 60-150 ms
+// presses, a quarter of them quick 8-25 ms taps, 400-800 ms apart so the pistol is always ready)
+// is fed into two copies of the same World, frame by frame, with frames paced to the target rate
+// and a random amount of work each (some frames overrunning):
+//   before: the controls are polled once per frame, right before it starts (raylib's own pacing),
+//           and the step fires if the button is down at that moment
+//   after:  the controls are polled after EndDrawing and then every millisecond while waiting for
+//           the next frame; InputRecorder queues the changes and InputTimeline folds them into
+//           each step, timing the shot at the press
+// Reports, for each, the clicks that never fired, how far each shot's time is from its press, and
+// the time from the press to the end of the frame that drew its muzzle flash (compared over the
+// clicks both fired). Exits 1 if the event queue loses a click any poll saw, times a shot before
+// its press or later than the frame's work plus a poll interval, or shows any flash later than
+// polling once per frame would. (A tap that begins and ends while a frame is being worked on is
+// seen by no poll; the report counts those separately.)
+//
+// Usage: input_bench [fps=60] [clicks=600] [seed=1]
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "InputEvents.h"
+#include "Rng.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const double POLL_SECONDS = 0.001; // As main.cpp's INPUT_POLL_SECONDS
+
+struct Click {
+    double press;
+    double release;
+};
+
+struct Frame {
+    double start;
+    double workEnd; // When EndDrawing presents it
+};
+
+// Per click; negative where the click never fired
+struct Result {
+    int fired = 0;
+    std::vector<double> timingMs; // Shot time minus press time
+    std::vector<double> flashMs;  // Press to the end of the frame that drew the flash
+};
+
+static bool IsDown(const std::vector<Click>& clicks, double t) {
+    auto next = std::upper_bound(clicks.begin(), clicks.end(), t, [](double time, const Click& c) { return time < c.press; });
+    return next != clicks.begin() && t < (next - 1)->release;
+}
+
+static void MakeWorld(World& world, uint64_t seed) {
+    world.start(CreatePistol(), seed);
+    world.waveDirector.setConfig({ 0.0f, 0.0f, 0, 0 }); // Nobody spawns: only the shots matter
+}
+
+// Runs the frames through 'world'; 'inputFor' returns frame k's PlayerInput
+template <typename InputFor>
+static Result Run(World& world, const std::vector<Frame>& frames, const std::vector<Click>& clicks, InputFor inputFor) {
+    Result result;
+    result.timingMs.assign(clicks.size(), -1.0);
+    result.flashMs.assign(clicks.size(), -1.0);
+    size_t nextClick = 0; // The oldest click that hasn't fired
+    for (size_t k = 1; k < frames.size(); ++k) {
+        const Frame& frame = frames[k];
+        PlayerInput input = inputFor(k);
+        float lastFireTime = world.player.weapon.lastFireTime;
+        world.player.health = world.player.maxHealth;
+        world.step((float)(frame.start - frames[k - 1].start), input);
+        if (world.player.weapon.lastFireTime == lastFireTime) continue;
+
+        // Shots land on the newest press at or before the step's end; older presses that never fired were lost
+        while (nextClick + 1 < clicks.size() && clicks[nextClick + 1].press <= frame.start) nextClick++;
+        if (nextClick >= clicks.size() || clicks[nextClick].press > frame.start) continue;
+        double shotTime = frame.start - (double)(world.time - world.player.weapon.lastFireTime);
+        result.timingMs[nextClick] = (shotTime - clicks[nextClick].press) * 1000.0;
+        result.flashMs[nextClick] = (frame.workEnd - clicks[nextClick].press) * 1000.0;
+        result.fired++;
+        nextClick++;
+    }
+    return result;
+}
+
+// Over the clicks that 'mask' fired (all of 'values' when null)
+static double Percentile(const std::vector<double>& all, double p, const Result* mask = nullptr) {
+    std::vector<double> values;
+    for (size_t i = 0; i < all.size(); ++i) {
+        if (all[i] >= -0.5 && (!mask || mask->flashMs[i] >= 0.0)) values.push_back(all[i]);
+    }
+    if (values.empty()) return 0.0;
+    size_t index = (size_t)(p * (double)(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+static void Print(const char* name, const Result& r, const Result& other, int clicks) {
+    printf("  %-7s %4d/%d clicks fired; shot - press p50 %5.2f ms p90 %5.2f ms max %5.2f ms; "
+           "click to flash (clicks both fired) p50 %5.1f ms p99 %5.1f ms\n",
+           name, r.fired, clicks, Percentile(r.timingMs, 0.5), Percentile(r.timingMs, 0.9), Percentile(r.timingMs, 1.0),
+           Percentile(r.flashMs, 0.5, &other), Percentile(r.flashMs, 0.99, &other));
+}
+
+int main(int argc, char** argv) {
+    int fps = argc > 1 ? atoi(argv[1]) : 60;
+    int clickCount = argc > 2 ? atoi(argv[2]) : 600;
+    uint64_t seed = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1;
+    if (fps < 10) fps = 10;
+    if (clickCount < 10) clickCount = 10;
+
+    SetTraceLogLevel(LOG_WARNING);
+    Rng rng(seed);
+    double period = 1.0 / fps;
+
+    std::vector<Click> clicks;
+    double t = 0.5;
+    for (int i = 0; i < clickCount; ++i) {
+        bool tap = rng.range(0, 3) == 0;
+        double hold = tap ? rng.range(8, 25) / 1000.0 : rng.range(60, 150) / 1000.0;
+        clicks.push_back({ t, t + hold });
+        t += rng.range(400, 800) / 1000.0;
+    }
+
+    // Frames: 25-80% of the period in work, one in twenty overrunning it by up to 2x
+    std::vector<Frame> frames;
+    double maxWork = 0.0;
+    for (double start = 0.0; start < t + 1.0;) {
+        double work = rng.range(0, 19) == 0 ? period * rng.range(120, 200) / 100.0 : period * rng.range(25, 80) / 100.0;
+        maxWork = std::max(maxWork, work);
+        frames.push_back({ start, start + work });
+        start = std::max(start + period, start + work);
+    }
+
+    World before(1200.0f, 800.0f);
+    MakeWorld(before, seed);
+    Result old = Run(before, frames, clicks, [&](size_t k) {
+        PlayerInput input = { { 0, 0 }, { before.width, before.height / 2 }, IsDown(clicks, frames[k].start), false };
+        return input;
+    });
+
+    World after(1200.0f, 800.0f);
+    MakeWorld(after, seed);
+    InputEventQueue queue;
+    InputRecorder recorder(queue);
+    InputTimeline timeline;
+    long long polls = 0;
+    std::vector<bool> seen(clicks.size(), false); // By any poll
+    Result queued = Run(after, frames, clicks, [&](size_t k) {
+        // EndDrawing of the last frame, then every millisecond until this one starts
+        for (double poll = frames[k - 1].workEnd;; poll = std::min(poll + POLL_SECONDS, frames[k].start)) {
+            bool down = IsDown(clicks, poll);
+            if (down) {
+                auto click = std::upper_bound(clicks.begin(), clicks.end(), poll, [](double time, const Click& c) { return time < c.press; }) - 1;
+                seen[click - clicks.begin()] = true;
+            }
+            recorder.record(poll, { { 0, 0 }, { after.width, after.height / 2 }, down, false });
+            polls++;
+            if (poll >= frames[k].start) break;
+        }
+        return timeline.consume(queue, frames[k - 1].start, frames[k].start);
+    });
+
+    printf("Input: %d clicks (a quarter of them 8-25 ms taps) at %d FPS, %zu frames, seed %llu\n", clickCount, fps,
+           frames.size(), (unsigned long long)seed);
+    Print("before", old, queued, clickCount);
+    Print("after", queued, old, clickCount);
+    int unseen = (int)std::count(seen.begin(), seen.end(), false);
+    printf("  %.1f polls per frame, %d events dropped, %d taps fell entirely within a frame's work\n",
+           (double)polls / (frames.size() - 1), recorder.getDropped(), unseen);
+
+    int lost = 0, later = 0;
+    double earliest = 0.0, latest = 0.0;
+    for (int i = 0; i < clickCount; ++i) {
+        if (seen[i] && queued.flashMs[i] < 0.0) lost++;
+        if (queued.flashMs[i] < 0.0) continue;
+        earliest = std::min(earliest, queued.timingMs[i]);
+        latest = std::max(latest, queued.timingMs[i]);
+        if (old.flashMs[i] >= 0.0 && queued.flashMs[i] > old.flashMs[i] + 0.01) later++;
+    }
+    double bound = (maxWork + POLL_SECONDS) * 1000.0 + 0.1; // Plus the float sim clock's rounding
+    bool timed = earliest >= -0.1 && latest <= bound;
+    if (lost > 0 || recorder.getDropped() > 0 || !timed || later > 0) {
+        printf("FAILED: %d polled clicks lost, shots %.2f..%.2f ms from their press (bound %.2f), %d flashes later than before\n",
+               lost, earliest, latest, bound, later);
+        return 1;
+    }
+    printf("  Every polled click fired, each within %.2f ms of its press; no flash later than before\n", latest);
+    return 0;
+}
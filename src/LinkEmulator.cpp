@@ -0,0 +1,46 @@
+#include "LinkEmulator.h"
+#include "NetProtocol.h" // NET_MAX_PACKET_BYTES
+#include <algorithm>
+#include <utility> // For std::move
+
+LinkEmulator::LinkEmulator(const Config& config)
+    : config(config), server({ 0, 0 }), client({ 0, 0 }), hasClient(false), rng(config.seed) {}
+
+bool LinkEmulator::open(const NetAddress& serverAddress) {
+    server = serverAddress;
+    hasClient = false;
+    inFlight.clear();
+    return socket.open(0);
+}
+
+void LinkEmulator::poll(double now) {
+    uint8_t packet[NET_MAX_PACKET_BYTES];
+    NetAddress from;
+    size_t size;
+    while ((size = socket.receive(from, packet, sizeof(packet))) > 0) {
+        bool toServer = from != server;
+        if (toServer) {
+            client = from;
+            hasClient = true;
+        }
+        if (rng.range(0, 9999) < (int)(config.loss * 10000.0f)) {
+            stats.dropped++;
+            continue;
+        }
+        float spread = config.jitter * rng.range(-1000, 1000) / 1000.0f;
+        Datagram datagram = { now + std::max(config.latency + spread, 0.0f), toServer,
+                              std::vector<uint8_t>(packet, packet + size) };
+        auto at = std::upper_bound(inFlight.begin(), inFlight.end(), datagram.due,
+                                   [](double due, const Datagram& d) { return due < d.due; });
+        inFlight.insert(at, std::move(datagram));
+    }
+
+    size_t delivered = 0;
+    while (delivered < inFlight.size() && inFlight[delivered].due <= now) {
+        const Datagram& datagram = inFlight[delivered++];
+        if (!datagram.toServer && !hasClient) continue;
+        socket.send(datagram.toServer ? server : client, datagram.data.data(), datagram.data.size());
+        stats.forwarded++;
+    }
+    inFlight.erase(inFlight.begin(), inFlight.begin() + delivered);
+}
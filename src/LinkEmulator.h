@@ -0,0 +1,51 @@
+#pragma once
+#include "UdpSocket.h"
+#include "Rng.h"
+#include <cstdint>
+#include <vector>
+
+// A bad network path for loopback tests: a UDP relay between one client and a server that holds
+// each datagram for the configured latency plus jitter and drops a share of them, independently in
+// both directions. The client connects to the relay's port instead of the server's. Time is the
+// caller's: poll() takes the clock, so a test can run a simulated link faster than real time.
+class LinkEmulator {
+public:
+    struct Config {
+        float latency = 0.0f; // One-way delay, seconds
+        float jitter = 0.0f;  // Each datagram's delay varies uniformly by up to this either way (so they can reorder)
+        float loss = 0.0f;    // Share of datagrams dropped, 0..1
+        uint64_t seed = 1;
+    };
+
+    struct Stats {
+        uint64_t forwarded = 0;
+        uint64_t dropped = 0;
+    };
+
+    explicit LinkEmulator(const Config& config);
+
+    // Opens the relay on any free port, forwarding to 'server'
+    bool open(const NetAddress& server);
+    uint16_t getPort() const { return socket.getLocalPort(); }
+
+    // Takes in everything either side sent, timestamped 'now' (seconds), and delivers what is due
+    void poll(double now);
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    struct Datagram {
+        double due;
+        bool toServer;
+        std::vector<uint8_t> data;
+    };
+
+    Config config;
+    UdpSocket socket;
+    NetAddress server;
+    NetAddress client; // Whoever last sent from anywhere but the server
+    bool hasClient;
+    Rng rng;
+    std::vector<Datagram> inFlight; // Sorted by due time
+    Stats stats;
+};
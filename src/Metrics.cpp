@@ -0,0 +1,211 @@
+#include "Metrics.h"
+#include "raylib.h" // TraceLog
+#include <algorithm>
+#include <cstdarg>
+#include <ctime>
+#include <utility> // For std::move
+
+void MetricCounter::raiseTo(uint64_t total) {
+    uint64_t seen = value.load(std::memory_order_relaxed);
+    while (total > seen && !value.compare_exchange_weak(seen, total, std::memory_order_relaxed)) {}
+}
+
+LatencyHistogram::LatencyHistogram() : shards(new Shard[SHARDS]) {
+    for (int s = 0; s < SHARDS; ++s) {
+        shards[s].sumNs.store(0, std::memory_order_relaxed);
+        shards[s].maxNs.store(0, std::memory_order_relaxed);
+        for (int i = 0; i < BUCKETS; ++i) shards[s].counts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+int LatencyHistogram::NextShard() {
+    static std::atomic<int> next(0);
+    return next.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+}
+
+uint64_t LatencyHistogram::getBucketCount(int bucket) const {
+    uint64_t count = 0;
+    for (int s = 0; s < SHARDS; ++s) count += shards[s].counts[bucket].load(std::memory_order_relaxed);
+    return count;
+}
+
+uint64_t LatencyHistogram::getCount() const {
+    uint64_t count = 0;
+    for (int i = 0; i < BUCKETS; ++i) count += getBucketCount(i);
+    return count;
+}
+
+uint64_t LatencyHistogram::getSumNs() const {
+    uint64_t sum = 0;
+    for (int s = 0; s < SHARDS; ++s) sum += shards[s].sumNs.load(std::memory_order_relaxed);
+    return sum;
+}
+
+uint64_t LatencyHistogram::getMaxNs() const {
+    uint64_t max = 0;
+    for (int s = 0; s < SHARDS; ++s) max = std::max(max, shards[s].maxNs.load(std::memory_order_relaxed));
+    return max;
+}
+
+double LatencyHistogram::getMeanNs() const {
+    uint64_t n = getCount();
+    return n > 0 ? (double)getSumNs() / (double)n : 0.0;
+}
+
+double LatencyHistogram::percentileNs(double p) const {
+    uint64_t n = getCount();
+    if (n == 0) return 0.0;
+    uint64_t rank = (uint64_t)(p * (double)(n - 1)) + 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; ++i) {
+        seen += getBucketCount(i);
+        if (seen >= rank) return BucketMidpoint(i);
+    }
+    return (double)getMaxNs(); // Buckets read while other threads were still recording
+}
+
+double LatencyHistogram::BucketMidpoint(int bucket) {
+    if (bucket < SUB_COUNT) return bucket;
+    int shift = bucket / SUB_COUNT - 1;
+    double low = (double)((uint64_t)(bucket % SUB_COUNT + SUB_COUNT) << shift);
+    return low + (double)(1ull << shift) / 2.0;
+}
+
+MetricsRegistry::Entry& MetricsRegistry::find(const char* name, const char* help, Type type) {
+    for (Entry& entry : entries) {
+        if (entry.name == name && entry.type == type) return entry;
+    }
+    entries.emplace_back();
+    Entry& entry = entries.back();
+    entry.name = name;
+    entry.help = help;
+    entry.type = type;
+    return entry;
+}
+
+MetricCounter& MetricsRegistry::counter(const char* name, const char* help) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry& entry = find(name, help, Type::Counter);
+    if (!entry.counter) entry.counter.reset(new MetricCounter());
+    return *entry.counter;
+}
+
+MetricGauge& MetricsRegistry::gauge(const char* name, const char* help) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry& entry = find(name, help, Type::Gauge);
+    if (!entry.gauge) entry.gauge.reset(new MetricGauge());
+    return *entry.gauge;
+}
+
+LatencyHistogram& MetricsRegistry::histogram(const char* name, const char* help) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry& entry = find(name, help, Type::Histogram);
+    if (!entry.histogram) entry.histogram.reset(new LatencyHistogram());
+    return *entry.histogram;
+}
+
+static void AppendLine(std::string& out, const char* format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (length > 0) out.append(line, length < (int)sizeof(line) ? length : (int)sizeof(line) - 1);
+}
+
+// Exported bucket bounds: every power of two from 2^10 ns (~1 us) to 2^33 ns (~8.6 s). The first
+// histogram bucket at or above 2^k ns is (k - SUB_BITS + 1) * SUB_COUNT, so each bound's cumulative
+// count is exact.
+static const int FIRST_BOUND_POWER = 10;
+static const int LAST_BOUND_POWER = 33;
+
+void MetricsRegistry::writePrometheus(std::string& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const Entry& entry : entries) {
+        const char* name = entry.name.c_str();
+        AppendLine(out, "# HELP %s %s\n", name, entry.help.c_str());
+        switch (entry.type) {
+            case Type::Counter:
+                AppendLine(out, "# TYPE %s counter\n%s %llu\n", name, name, (unsigned long long)entry.counter->get());
+                break;
+            case Type::Gauge:
+                AppendLine(out, "# TYPE %s gauge\n%s %.17g\n", name, name, entry.gauge->get());
+                break;
+            case Type::Histogram: {
+                const LatencyHistogram& h = *entry.histogram;
+                AppendLine(out, "# TYPE %s histogram\n", name);
+                // One pass over the buckets; the count is their sum, so it agrees with the +Inf bucket
+                // even while other threads record
+                uint64_t cumulative = 0;
+                int bucket = 0;
+                for (int power = FIRST_BOUND_POWER; power <= LAST_BOUND_POWER; ++power) {
+                    int end = (power - LatencyHistogram::SUB_BITS + 1) * LatencyHistogram::SUB_COUNT;
+                    for (; bucket < end; ++bucket) cumulative += h.getBucketCount(bucket);
+                    AppendLine(out, "%s_bucket{le=\"%.10g\"} %llu\n", name, (double)(1ull << power) * 1e-9,
+                               (unsigned long long)cumulative);
+                }
+                for (; bucket < LatencyHistogram::BUCKETS; ++bucket) cumulative += h.getBucketCount(bucket);
+                AppendLine(out, "%s_bucket{le=\"+Inf\"} %llu\n", name, (unsigned long long)cumulative);
+                AppendLine(out, "%s_sum %.9g\n%s_count %llu\n", name, (double)h.getSumNs() * 1e-9, name,
+                           (unsigned long long)cumulative);
+                AppendLine(out, "# TYPE %s_max gauge\n%s_max %.9g\n", name, name, (double)h.getMaxNs() * 1e-9);
+                break;
+            }
+        }
+    }
+}
+
+MetricsFileWriter::MetricsFileWriter(const MetricsRegistry& registry, std::string path, double intervalSeconds, size_t maxBytes)
+    : registry(registry), path(std::move(path)), interval(intervalSeconds), maxBytes(maxBytes), nextWrite(0.0),
+      file(nullptr), fileBytes(0), failed(false) {}
+
+MetricsFileWriter::~MetricsFileWriter() {
+    if (file) std::fclose(file);
+}
+
+void MetricsFileWriter::poll(double now) {
+    if (now < nextWrite) return;
+    write(now);
+}
+
+bool MetricsFileWriter::write(double now) {
+    nextWrite = now + interval;
+
+    bool rotate = file && fileBytes >= maxBytes;
+    if (rotate) {
+        std::fclose(file);
+        file = nullptr;
+        std::string previous = path + ".1";
+        std::remove(previous.c_str()); // rename() won't replace an existing file everywhere
+        std::rename(path.c_str(), previous.c_str());
+    }
+    if (!file) {
+        file = std::fopen(path.c_str(), rotate ? "w" : "a"); // A restart continues the file it left
+        if (!file) {
+            if (!failed) TraceLog(LOG_WARNING, "METRICS: Can't write %s", path.c_str());
+            failed = true;
+            return false;
+        }
+        std::fseek(file, 0, SEEK_END);
+        fileBytes = (size_t)std::ftell(file);
+    }
+
+    text.clear();
+    AppendLine(text, "# snapshot unix %lld uptime %.3f\n", (long long)std::time(nullptr), now);
+    registry.writePrometheus(text);
+    text += '\n';
+    size_t written = std::fwrite(text.data(), 1, text.size(), file);
+    std::fflush(file);
+    fileBytes += written;
+    return written == text.size();
+}
+
+WorldMetrics::WorldMetrics(MetricsRegistry& registry)
+    : stepTime(registry.histogram("zh_world_step_seconds", "World::step duration")),
+      steps(registry.counter("zh_world_steps_total", "World steps run")),
+      zombies(registry.gauge("zh_zombies", "Live zombies")),
+      bullets(registry.gauge("zh_bullets", "Player bullets in flight")),
+      enemyProjectiles(registry.gauge("zh_enemy_projectiles", "Enemy projectiles in flight")),
+      arenaBytes(registry.gauge("zh_floor_arena_bytes", "Floor arena footprint")),
+      arenaAllocations(registry.gauge("zh_floor_arena_allocations", "Floor arena allocations since the floor began")),
+      heapAllocations(registry.counter("zh_heap_allocations_total", "Global operator new calls")) {}
@@ -0,0 +1,169 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Monotonic count (ticks run, packets, allocations). Relaxed atomics: safe to bump from any thread.
+class MetricCounter {
+public:
+    void add(uint64_t n = 1) { value.fetch_add(n, std::memory_order_relaxed); }
+    // For counters that mirror a monotonic total kept elsewhere (e.g. the heap allocation hook)
+    void raiseTo(uint64_t total);
+    uint64_t get() const { return value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value{ 0 };
+};
+
+// Last-written value (live zombies, sessions, arena bytes)
+class MetricGauge {
+public:
+    void set(double v) { value.store(v, std::memory_order_relaxed); }
+    double get() const { return value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<double> value{ 0.0 };
+};
+
+// Log-linear latency histogram in nanoseconds: exact below 32 ns, then 32 buckets per power of two
+// (~3% wide) up to 2^64 ns, so percentiles over millions of samples need neither sorting nor storing
+// them. Recording is lock-free: every bucket is an atomic counter, and each thread records into one
+// of SHARDS copies of the buckets (picked once per thread), so worker threads recording at the same
+// time don't fight over the same cache lines. Readers sum the shards; each bucket is read exactly,
+// though not all of them at the same instant while recording goes on.
+class LatencyHistogram {
+public:
+    static const int SUB_BITS = 5;
+    static const int SUB_COUNT = 1 << SUB_BITS;
+    static const int BUCKETS = 64 * SUB_COUNT;
+    static const int SHARDS = 8;
+
+    LatencyHistogram();
+
+    void record(uint64_t ns) {
+        Shard& shard = shards[ThreadShard()];
+        shard.counts[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+        shard.sumNs.fetch_add(ns, std::memory_order_relaxed);
+        uint64_t seen = shard.maxNs.load(std::memory_order_relaxed);
+        while (ns > seen && !shard.maxNs.compare_exchange_weak(seen, ns, std::memory_order_relaxed)) {}
+    }
+
+    uint64_t getCount() const;
+    uint64_t getSumNs() const;
+    uint64_t getMaxNs() const;
+    uint64_t getBucketCount(int bucket) const;
+    double getMeanNs() const;
+    // Midpoint of the bucket holding the p-th sample (p in [0, 1]); 0 when empty
+    double percentileNs(double p) const;
+
+    static int BucketOf(uint64_t ns) {
+        if (ns < (uint64_t)SUB_COUNT) return (int)ns;
+#if defined(__GNUC__) || defined(__clang__)
+        int msb = 63 - __builtin_clzll(ns);
+#else
+        int msb = 0;
+        while ((ns >> (msb + 1)) != 0) msb++;
+#endif
+        int shift = msb - SUB_BITS;
+        return (shift + 1) * SUB_COUNT + (int)((ns >> shift) - SUB_COUNT);
+    }
+    static double BucketMidpoint(int bucket);
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> sumNs;
+        std::atomic<uint64_t> maxNs;
+        std::atomic<uint64_t> counts[BUCKETS];
+    };
+
+    std::unique_ptr<Shard[]> shards;
+
+    // This thread's shard: threads are dealt out round-robin the first time they record
+    static int ThreadShard() {
+        static thread_local int shard = NextShard();
+        return shard;
+    }
+    static int NextShard();
+};
+
+// Named metrics of one process. Registering takes a lock and is meant for startup; the returned
+// references stay valid for the registry's lifetime, and updating through them is lock-free.
+// Registering a name again returns the existing metric. Names follow Prometheus conventions
+// (snake_case, a zh_ prefix, _total on counters, _seconds on histograms).
+class MetricsRegistry {
+public:
+    MetricCounter& counter(const char* name, const char* help);
+    MetricGauge& gauge(const char* name, const char* help);
+    // Recorded in nanoseconds, exported in seconds
+    LatencyHistogram& histogram(const char* name, const char* help);
+
+    // Appends every metric in the Prometheus text exposition format (version 0.0.4). Histograms
+    // are exported with cumulative buckets at each power of two from ~1 us to ~8.6 s, plus a
+    // <name>_max gauge.
+    void writePrometheus(std::string& out) const;
+
+private:
+    enum class Type { Counter, Gauge, Histogram };
+    struct Entry {
+        std::string name;
+        std::string help;
+        Type type;
+        std::unique_ptr<MetricCounter> counter;
+        std::unique_ptr<MetricGauge> gauge;
+        std::unique_ptr<LatencyHistogram> histogram;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<Entry> entries;
+
+    Entry& find(const char* name, const char* help, Type type);
+};
+
+// Rolling metrics file: every 'intervalSeconds' a timestamped snapshot of the registry in
+// Prometheus text format is appended to 'path'. When the file grows past 'maxBytes' it is renamed
+// to <path>.1 (replacing the previous one) and a fresh file begins, so at most about twice
+// 'maxBytes' is ever on disk.
+class MetricsFileWriter {
+public:
+    MetricsFileWriter(const MetricsRegistry& registry, std::string path, double intervalSeconds, size_t maxBytes);
+    ~MetricsFileWriter();
+
+    MetricsFileWriter(const MetricsFileWriter&) = delete;
+    MetricsFileWriter& operator=(const MetricsFileWriter&) = delete;
+
+    // Writes a snapshot when one is due; 'now' is any monotonic clock in seconds
+    void poll(double now);
+    // Writes a snapshot immediately. Returns false (and logs once) if the file can't be written.
+    bool write(double now);
+
+private:
+    const MetricsRegistry& registry;
+    std::string path;
+    double interval;
+    size_t maxBytes;
+    double nextWrite;
+    std::FILE* file;
+    size_t fileBytes;
+    bool failed;
+    std::string text; // Reused snapshot buffer
+};
+
+// The standard metric set of anything that steps Worlds (the game, the server), registered under
+// fixed names so the game's and the server's dashboards read the same series
+struct WorldMetrics {
+    LatencyHistogram& stepTime;
+    MetricCounter& steps;
+    MetricGauge& zombies;
+    MetricGauge& bullets;
+    MetricGauge& enemyProjectiles;
+    MetricGauge& arenaBytes;
+    MetricGauge& arenaAllocations;
+    MetricCounter& heapAllocations;
+
+    explicit WorldMetrics(MetricsRegistry& registry);
+};
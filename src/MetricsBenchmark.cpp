@@ -0,0 +1,152 @@
+// MetricsBenchmark.cpp
+// Telemetry benchmark and check. Records a fixed-seed stream of tick-like latencies (mostly tens
+// of microseconds with a long tail) into one LatencyHistogram: first from one thread, reporting the
+// cost per record, then from T worker threads at once while another thread keeps exporting the
+// registry in Prometheus text format. Reports the combined record rate and the export cost.
+// Exits 1 if the concurrent histogram and counter totals differ in any bucket from the same
+// samples recorded on one thread, if an export ever sees the count go backwards, or if p50/p99
+// are off by more than one bucket width (~3%) from the exact percentiles of the samples.
+//
+// Usage: metrics_bench [threads=4] [recordsPerThread=2000000] [seed=1]
+
+#include "Metrics.h"
+#include "Rng.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Tick-like latencies: 20-80 us, one in a hundred 0.2-5 ms, one in ten thousand up to 50 ms
+static std::vector<uint64_t> MakeSamples(uint64_t seed, int count) {
+    Rng rng(seed);
+    std::vector<uint64_t> samples(count);
+    for (uint64_t& ns : samples) {
+        int roll = rng.range(0, 9999);
+        if (roll == 0) ns = (uint64_t)rng.range(5000, 50000) * 1000;
+        else if (roll < 100) ns = (uint64_t)rng.range(200, 5000) * 1000;
+        else ns = (uint64_t)rng.range(20000, 80000);
+    }
+    return samples;
+}
+
+// The value of the last "<name> <value>" line in Prometheus text, or -1
+static long long ReadSample(const std::string& text, const char* name) {
+    std::string prefix = std::string("\n") + name + " ";
+    size_t at = text.rfind(prefix);
+    return at == std::string::npos ? -1 : atoll(text.c_str() + at + prefix.size());
+}
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? atoi(argv[1]) : 4;
+    int perThread = argc > 2 ? atoi(argv[2]) : 2000000;
+    uint64_t seed = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1;
+    if (threads < 1) threads = 1;
+    if (perThread < 1000) perThread = 1000;
+
+    std::vector<std::vector<uint64_t>> samples(threads);
+    for (int t = 0; t < threads; ++t) samples[t] = MakeSamples(seed + t, perThread);
+
+    // --- One thread: the reference, and the uncontended cost ---
+    LatencyHistogram reference;
+    auto start = Clock::now();
+    for (int t = 0; t < threads; ++t) {
+        for (uint64_t ns : samples[t]) reference.record(ns);
+    }
+    double singleNs = ElapsedNs(start) / ((double)threads * perThread);
+
+    // --- T threads into one registry histogram, exported concurrently ---
+    uint64_t expected = (uint64_t)threads * perThread;
+    MetricsRegistry registry;
+    WorldMetrics world(registry);
+    LatencyHistogram& shared = world.stepTime;
+    MetricCounter& recorded = world.steps;
+    std::atomic<int> running(threads);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            while (!go.load()) {}
+            for (uint64_t ns : samples[t]) shared.record(ns);
+            recorded.add(samples[t].size()); // One shared counter bumped per record would measure only its cache line
+            running--;
+        });
+    }
+
+    std::string text;
+    int exports = 0, regressions = 0;
+    long long lastCount = 0;
+    double exportNs = 0.0;
+    auto wallStart = Clock::now();
+    go = true;
+    while (running.load() > 0) {
+        text.clear();
+        auto exportStart = Clock::now();
+        registry.writePrometheus(text);
+        exportNs += ElapsedNs(exportStart);
+        exports++;
+        long long count = ReadSample(text, "zh_world_step_seconds_count");
+        if (count < lastCount) regressions++;
+        lastCount = count;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1)); // A far more eager scraper than any real one
+    }
+    for (std::thread& worker : workers) worker.join();
+    double wallNs = ElapsedNs(wallStart);
+
+    // --- Checks ---
+    int bucketMismatches = 0;
+    for (int i = 0; i < LatencyHistogram::BUCKETS; ++i) {
+        if (shared.getBucketCount(i) != reference.getBucketCount(i)) bucketMismatches++;
+    }
+    bool totalsMatch = shared.getCount() == expected && recorded.get() == expected &&
+                       shared.getSumNs() == reference.getSumNs() && shared.getMaxNs() == reference.getMaxNs();
+
+    text.clear();
+    registry.writePrometheus(text);
+    bool exportMatches = ReadSample(text, "zh_world_step_seconds_count") == (long long)expected &&
+                         ReadSample(text, "zh_world_steps_total") == (long long)expected;
+
+    std::vector<uint64_t> all;
+    all.reserve(expected);
+    for (const std::vector<uint64_t>& s : samples) all.insert(all.end(), s.begin(), s.end());
+    double worstError = 0.0;
+    const double percentiles[2] = { 0.50, 0.99 };
+    printf("Metrics: %d threads x %d records, seed %llu\n", threads, perThread, (unsigned long long)seed);
+    for (double p : percentiles) {
+        size_t index = (size_t)(p * (double)(all.size() - 1));
+        std::nth_element(all.begin(), all.begin() + index, all.end());
+        double exact = (double)all[index];
+        double estimate = shared.percentileNs(p);
+        double error = std::fabs(estimate - exact) / exact;
+        worstError = std::max(worstError, error);
+        printf("  p%-4.0f        %10.2f us histogram vs %10.2f us exact (%.2f%% off)\n", p * 100.0, estimate / 1000.0,
+               exact / 1000.0, error * 100.0);
+    }
+
+    printf("  Record:      %6.2f ns on one thread; %d threads at once: %.1f M records/s, %.2f ns of wall time per record\n",
+           singleNs, threads, expected / wallNs * 1000.0, wallNs / expected);
+    printf("  Export:      %6.1f us per Prometheus snapshot (%zu bytes), %d taken during the run\n",
+           exports > 0 ? exportNs / exports / 1000.0 : 0.0, text.size(), exports);
+
+    bool percentilesOk = worstError <= 1.0 / LatencyHistogram::SUB_COUNT;
+    if (bucketMismatches > 0 || !totalsMatch || !exportMatches || regressions > 0 || !percentilesOk) {
+        printf("FAILED: %d buckets differ from the single-thread reference, totals %s, export %s, "
+               "%d exports saw the count go backwards, worst percentile error %.2f%%\n",
+               bucketMismatches, totalsMatch ? "match" : "differ", exportMatches ? "matches" : "differs", regressions,
+               worstError * 100.0);
+        return 1;
+    }
+    printf("  Concurrent records match the single-thread reference in every bucket; percentiles within %.1f%%\n",
+           100.0 / LatencyHistogram::SUB_COUNT);
+    return 0;
+}
@@ -0,0 +1,195 @@
+#include "MetricsEndpoint.h"
+#include "Metrics.h"
+#include "raylib.h" // TraceLog
+#include <cstring>
+#include <cstdio>
+#include <utility> // For std::move
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI  // Keeps wingdi.h from clashing with raylib names (Rectangle, ...)
+#define NOUSER
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef int socklen_t;
+#define CLOSE_SOCKET closesocket
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define CLOSE_SOCKET ::close
+#endif
+
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL; // A scraper hanging up mid-response must not raise SIGPIPE
+#else
+static const int SEND_FLAGS = 0;
+#endif
+
+static void SetNonBlocking(intptr_t fd) {
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    ioctlsocket((SOCKET)fd, FIONBIO, &nonBlocking);
+#else
+    fcntl((int)fd, F_SETFL, fcntl((int)fd, F_GETFL, 0) | O_NONBLOCK);
+#endif
+}
+
+// After a failed recv/send: true if the socket just had nothing to give or take right now
+static bool WouldBlock() {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+MetricsEndpoint::MetricsEndpoint(const MetricsRegistry& registry)
+    : registry(registry), listener(-1), localPort(0), scrapes(0) {
+#ifdef _WIN32
+    static bool winsockStarted = false;
+    if (!winsockStarted) {
+        WSADATA data;
+        winsockStarted = WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }
+#endif
+}
+
+MetricsEndpoint::~MetricsEndpoint() {
+    close();
+}
+
+bool MetricsEndpoint::open(uint16_t port) {
+    close();
+    intptr_t fd = (intptr_t)socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0) {
+        TraceLog(LOG_WARNING, "METRICS: Failed to create TCP socket");
+        return false;
+    }
+    int reuse = 1;
+    setsockopt((int)fd, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse)); // Quick restarts
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK); // Local scrapers only
+    addr.sin_port = htons(port);
+    if (bind((int)fd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen((int)fd, MAX_CONNECTIONS) != 0) {
+        TraceLog(LOG_WARNING, "METRICS: Failed to listen on TCP port %d", (int)port);
+        CLOSE_SOCKET((int)fd);
+        return false;
+    }
+    SetNonBlocking(fd);
+
+    socklen_t length = sizeof(addr);
+    getsockname((int)fd, (sockaddr*)&addr, &length);
+    localPort = ntohs(addr.sin_port);
+    listener = fd;
+    TraceLog(LOG_INFO, "METRICS: Serving http://127.0.0.1:%d/metrics", (int)localPort);
+    return true;
+}
+
+void MetricsEndpoint::close() {
+    for (Connection& connection : connections) CLOSE_SOCKET((int)connection.handle);
+    connections.clear();
+    if (listener >= 0) {
+        CLOSE_SOCKET((int)listener);
+        listener = -1;
+        localPort = 0;
+    }
+}
+
+void MetricsEndpoint::poll() {
+    if (listener < 0) return;
+
+    // Connections beyond the cap wait in the listen backlog until a slot frees up
+    while ((int)connections.size() < MAX_CONNECTIONS) {
+        intptr_t fd = (intptr_t)accept((int)listener, nullptr, nullptr);
+        if (fd < 0) break; // Nothing pending
+        SetNonBlocking(fd);
+#ifdef SO_NOSIGPIPE
+        int noSignal = 1;
+        setsockopt((int)fd, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#endif
+        connections.push_back({ fd, std::string(), std::string(), 0, 0 });
+    }
+
+    for (size_t i = 0; i < connections.size();) {
+        if (service(connections[i])) {
+            ++i;
+            continue;
+        }
+        CLOSE_SOCKET((int)connections[i].handle);
+        connections[i] = std::move(connections.back());
+        connections.pop_back();
+    }
+}
+
+bool MetricsEndpoint::service(Connection& connection) {
+    bool progressed = false;
+
+    // Read until the end of the request head; the body (if any) is ignored
+    if (connection.response.empty()) {
+        char buffer[1024];
+        for (;;) {
+            int received = (int)recv((int)connection.handle, buffer, sizeof(buffer), 0);
+            if (received == 0) return false; // Hung up before asking
+            if (received < 0) {
+                if (!WouldBlock()) return false;
+                break;
+            }
+            progressed = true;
+            connection.request.append(buffer, received);
+            if (connection.request.find("\r\n\r\n") != std::string::npos) {
+                respond(connection);
+                break;
+            }
+            if (connection.request.size() > (size_t)MAX_REQUEST_BYTES) return false;
+        }
+    }
+
+    while (!connection.response.empty() && connection.sent < connection.response.size()) {
+        int sent = (int)send((int)connection.handle, connection.response.data() + connection.sent,
+                             (int)(connection.response.size() - connection.sent), SEND_FLAGS);
+        if (sent < 0) {
+            if (!WouldBlock()) return false;
+            break;
+        }
+        progressed = true;
+        connection.sent += (size_t)sent;
+    }
+    if (!connection.response.empty() && connection.sent == connection.response.size()) return false; // Done
+
+    connection.idlePolls = progressed ? 0 : connection.idlePolls + 1;
+    return connection.idlePolls < IDLE_POLLS;
+}
+
+void MetricsEndpoint::respond(Connection& connection) {
+    const std::string& request = connection.request;
+    static const char PATH[] = "GET /metrics";
+    static const size_t PATH_LENGTH = sizeof(PATH) - 1;
+    bool isMetrics = request.size() > PATH_LENGTH && request.compare(0, PATH_LENGTH, PATH) == 0 &&
+                     (request[PATH_LENGTH] == ' ' || request[PATH_LENGTH] == '?');
+
+    const char* status = "404 Not Found";
+    body.clear();
+    if (isMetrics) {
+        status = "200 OK";
+        registry.writePrometheus(body);
+        scrapes++;
+    } else {
+        body = "Metrics are served at /metrics\n";
+    }
+
+    char head[192];
+    int length = snprintf(head, sizeof(head),
+                          "HTTP/1.1 %s\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                          "Content-Length: %zu\r\nConnection: close\r\n\r\n",
+                          status, body.size());
+    connection.response.assign(head, length);
+    connection.response += body;
+    connection.sent = 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class MetricsRegistry;
+
+// Minimal HTTP endpoint serving a registry in Prometheus text format on 127.0.0.1 (native builds
+// only; not part of the web build). Non-blocking like UdpSocket: poll() from the game or server
+// loop accepts pending connections, reads what has arrived and writes what the socket takes, so a
+// slow or silent scraper never stalls a tick. GET /metrics answers 200, any other path 404; every
+// connection is closed after its one response.
+class MetricsEndpoint {
+public:
+    explicit MetricsEndpoint(const MetricsRegistry& registry);
+    ~MetricsEndpoint();
+
+    MetricsEndpoint(const MetricsEndpoint&) = delete;
+    MetricsEndpoint& operator=(const MetricsEndpoint&) = delete;
+
+    // Listens on 127.0.0.1:'port' (0 = any free port). Returns false and logs on failure.
+    bool open(uint16_t port);
+    void close();
+    bool isOpen() const { return listener >= 0; }
+
+    void poll();
+
+    uint16_t getLocalPort() const { return localPort; }
+    uint64_t getScrapes() const { return scrapes; }
+
+private:
+    static const int MAX_CONNECTIONS = 8;
+    static const int MAX_REQUEST_BYTES = 4096;
+    static const int IDLE_POLLS = 600; // Dropped after this many polls without progress (~10 s at 60 Hz)
+
+    struct Connection {
+        intptr_t handle;
+        std::string request;
+        std::string response;
+        size_t sent;
+        int idlePolls;
+    };
+
+    const MetricsRegistry& registry;
+    intptr_t listener; // SOCKET on Windows, file descriptor elsewhere; -1 when closed
+    uint16_t localPort;
+    uint64_t scrapes;
+    std::vector<Connection> connections;
+    std::string body; // Reused snapshot buffer
+
+    // False once the connection is finished (answered, failed or idle too long)
+    bool service(Connection& connection);
+    void respond(Connection& connection);
+};
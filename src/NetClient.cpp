@@ -0,0 +1,106 @@
+#include "NetClient.h"
+#include <algorithm>
+
+const int NetClient::CONNECT_RESEND_TICKS = 30;
+
+NetClient::NetClient()
+    : server({ 0, 0 }), status(Status::DISCONNECTED), weapon(WeaponType::Pistol), seed(0),
+      sessionId(0), serverTickRate(0), inputSequence(0), connectTimer(0), stateCount(0), state(), walls(), recentInputs() {}
+
+bool NetClient::connect(const NetAddress& serverAddress, WeaponType selectedWeapon, uint64_t gameSeed) {
+    if (!socket.isOpen() && !socket.open(0)) return false;
+    server = serverAddress;
+    weapon = selectedWeapon;
+    seed = gameSeed;
+    sessionId = 0;
+    inputSequence = 0;
+    stateCount = 0;
+    walls.revision = 0;
+    status = Status::CONNECTING;
+    sendConnect();
+    return true;
+}
+
+void NetClient::disconnect() {
+    if (status == Status::CONNECTED) {
+        uint8_t packet[16];
+        ByteWriter writer(packet, sizeof(packet));
+        WriteNetHeader(writer, NetMessage::DISCONNECT);
+        writer.u32(sessionId);
+        socket.send(server, packet, writer.getSize());
+    }
+    status = Status::DISCONNECTED;
+    socket.close();
+}
+
+void NetClient::sendConnect() {
+    uint8_t packet[16];
+    ByteWriter writer(packet, sizeof(packet));
+    WriteNetHeader(writer, NetMessage::CONNECT);
+    writer.u8((uint8_t)weapon);
+    writer.u64(seed);
+    socket.send(server, packet, writer.getSize());
+    connectTimer = CONNECT_RESEND_TICKS;
+}
+
+uint32_t NetClient::sendInput(const PlayerInput& input) {
+    if (status != Status::CONNECTED) return 0;
+    inputSequence++;
+    recentInputs[inputSequence % NET_INPUT_REDUNDANCY] = input;
+
+    // This input and the ones before it, oldest first
+    int count = (int)std::min<uint32_t>(inputSequence, NET_INPUT_REDUNDANCY);
+    PlayerInput inputs[NET_INPUT_REDUNDANCY];
+    for (int i = 0; i < count; ++i) inputs[i] = recentInputs[(inputSequence - (count - 1 - i)) % NET_INPUT_REDUNDANCY];
+
+    uint8_t packet[128];
+    ByteWriter writer(packet, sizeof(packet));
+    WriteNetInput(writer, sessionId, walls.revision, inputSequence, inputs, count);
+    socket.send(server, packet, writer.getSize());
+    return inputSequence;
+}
+
+bool NetClient::poll() {
+    if (status == Status::DISCONNECTED) return false;
+    if (status == Status::CONNECTING && --connectTimer <= 0) sendConnect();
+
+    bool updated = false;
+    received.clear();
+    uint8_t packet[NET_MAX_PACKET_BYTES];
+    NetAddress from;
+    size_t size;
+    while ((size = socket.receive(from, packet, sizeof(packet))) > 0) {
+        if (from != server) continue;
+        ByteReader reader(packet, size);
+        NetMessage type;
+        if (!ReadNetHeader(reader, type)) continue;
+
+        if (type == NetMessage::ACCEPT && status == Status::CONNECTING) {
+            uint32_t id = reader.u32();
+            uint16_t tickRate = reader.u16();
+            if (reader.overflowed()) continue;
+            sessionId = id;
+            serverTickRate = tickRate;
+            status = Status::CONNECTED;
+        } else if (type == NetMessage::STATE && status == Status::CONNECTED) {
+            NetWorldState incoming;
+            ReadNetState(reader, incoming);
+            if (reader.overflowed() || incoming.sessionId != sessionId) continue;
+            if (stateCount > 0 && incoming.tick <= state.tick) continue; // Reordered datagram
+            state = incoming;
+            received.push_back(incoming);
+            stateCount++;
+            updated = true;
+        } else if (type == NetMessage::WALLS && status == Status::CONNECTED) {
+            NetWalls incoming;
+            ReadNetWalls(reader, incoming);
+            if (reader.overflowed() || incoming.sessionId != sessionId) continue;
+            // Revisions only go up (wrapping past 0); an older one arriving late is ignored
+            if (walls.revision != 0 && (int16_t)(incoming.revision - walls.revision) <= 0) continue;
+            walls = incoming;
+        } else if (type == NetMessage::DISCONNECT && reader.u32() == sessionId) {
+            status = Status::DISCONNECTED;
+        }
+    }
+    return updated;
+}
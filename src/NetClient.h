@@ -0,0 +1,65 @@
+#pragma once
+#include "UdpSocket.h"
+#include "NetProtocol.h"
+#include "World.h"
+#include <cstdint>
+#include <vector>
+
+// Client side of the protocol: connects to a GameServer, streams PlayerInput frames (each
+// datagram repeating the few before it) and keeps the newest STATE and the floor's walls it has
+// received. Everything is polled; nothing blocks.
+class NetClient {
+public:
+    enum class Status {
+        DISCONNECTED,
+        CONNECTING, // CONNECT sent, resent every CONNECT_RESEND_TICKS polls until ACCEPT arrives
+        CONNECTED
+    };
+
+    static const int CONNECT_RESEND_TICKS;
+
+    NetClient();
+
+    // Opens a local socket on any port and starts connecting; 'seed' 0 lets the server pick one
+    bool connect(const NetAddress& server, WeaponType weapon, uint64_t seed);
+    void disconnect();
+
+    // Sends one input frame (only while connected); each frame gets the next sequence number,
+    // which is returned (0 when not connected)
+    uint32_t sendInput(const PlayerInput& input);
+
+    // Drains the socket. Returns true if a newer STATE arrived since the last call.
+    bool poll();
+
+    // Every newer STATE the last poll() received, oldest first (the last one is getState())
+    const std::vector<NetWorldState>& getReceivedStates() const { return received; }
+
+    Status getStatus() const { return status; }
+    uint32_t getSessionId() const { return sessionId; }
+    int getServerTickRate() const { return serverTickRate; }
+    uint32_t getInputSequence() const { return inputSequence; }
+    const NetWorldState& getState() const { return state; }
+    bool hasState() const { return stateCount > 0; }
+    uint64_t getStateCount() const { return stateCount; }
+    // The current floor's walls as of getWallRevision() (0 until the first WALLS arrives)
+    const NetWalls& getWalls() const { return walls; }
+    uint16_t getWallRevision() const { return walls.revision; }
+
+private:
+    UdpSocket socket;
+    NetAddress server;
+    Status status;
+    WeaponType weapon;
+    uint64_t seed;
+    uint32_t sessionId;
+    int serverTickRate;
+    uint32_t inputSequence;
+    int connectTimer;
+    uint64_t stateCount;
+    NetWorldState state;
+    std::vector<NetWorldState> received;
+    NetWalls walls;
+    PlayerInput recentInputs[NET_INPUT_REDUNDANCY]; // By sequence modulo NET_INPUT_REDUNDANCY
+
+    void sendConnect();
+};
@@ -0,0 +1,182 @@
+#include "NetProtocol.h"
+#include "Snapshot.h" // QuantizePosition
+#include "raymath.h"
+#include <algorithm>
+
+void WriteNetHeader(ByteWriter& writer, NetMessage type) {
+    writer.u16(NET_PROTOCOL_MAGIC);
+    writer.u8((uint8_t)type);
+}
+
+bool ReadNetHeader(ByteReader& reader, NetMessage& type) {
+    uint16_t magic = reader.u16();
+    type = (NetMessage)reader.u8();
+    return !reader.overflowed() && magic == NET_PROTOCOL_MAGIC;
+}
+
+void WriteNetInput(ByteWriter& writer, uint32_t sessionId, uint16_t wallRevision, uint32_t sequence,
+                   const PlayerInput* inputs, int count) {
+    WriteNetHeader(writer, NetMessage::INPUT);
+    writer.u32(sessionId);
+    writer.u16(wallRevision);
+    writer.u32(sequence);
+    writer.u8((uint8_t)count);
+    for (int i = 0; i < count; ++i) {
+        const PlayerInput& input = inputs[i];
+        writer.f32(input.move.x);
+        writer.f32(input.move.y);
+        writer.f32(input.aim.x);
+        writer.f32(input.aim.y);
+        writer.u8((input.fire ? 1 : 0) | (input.dash ? 2 : 0));
+    }
+}
+
+int ReadNetInput(ByteReader& reader, uint32_t& sessionId, uint16_t& wallRevision, uint32_t& sequence, PlayerInput* inputs) {
+    sessionId = reader.u32();
+    wallRevision = reader.u16();
+    sequence = reader.u32();
+    int count = std::min<int>(reader.u8(), NET_INPUT_REDUNDANCY);
+    for (int i = 0; i < count; ++i) {
+        PlayerInput& input = inputs[i];
+        input.move.x = reader.f32();
+        input.move.y = reader.f32();
+        input.aim.x = reader.f32();
+        input.aim.y = reader.f32();
+        uint8_t flags = reader.u8();
+        input.fire = (flags & 1) != 0;
+        input.dash = (flags & 2) != 0;
+        input.fireLead = 0.0f;
+    }
+    return count;
+}
+
+void WriteNetState(ByteWriter& writer, uint32_t sessionId, uint32_t lastInputSequence, uint16_t wallRevision,
+                   const World& world) {
+    const Player& player = world.player;
+    const ZombieList& zombies = world.floor.zombies;
+
+    WriteNetHeader(writer, NetMessage::STATE);
+    writer.u32(sessionId);
+    writer.u32((uint32_t)world.ticks);
+    writer.u32(lastInputSequence);
+    writer.u16(wallRevision);
+    writer.f32(world.time);
+    writer.u8((uint8_t)world.status);
+    writer.u8((uint8_t)world.currentFloor);
+    writer.u16((uint16_t)world.zombiesKilled);
+    writer.f32(player.pos.x);
+    writer.f32(player.pos.y);
+    writer.f32(player.facing.x);
+    writer.f32(player.facing.y);
+    writer.f32(player.health);
+    writer.u8((player.isDashing ? 1 : 0) | (player.weapon.triggerHeld ? 2 : 0));
+    writer.f32(player.dashTimer);
+    writer.f32(player.dashDirection.x);
+    writer.f32(player.dashDirection.y);
+    writer.f32(player.weapon.lastFireTime);
+    writer.u16((uint16_t)std::min<size_t>(player.bullets.size(), 0xFFFF));
+    writer.u16((uint16_t)std::min<size_t>(zombies.size(), 0xFFFF));
+
+    // Pick the zombies nearest the player when there are more than fit in one datagram
+    int sent = std::min((int)zombies.size(), NET_MAX_STATE_ZOMBIES);
+    int nearest[NET_MAX_STATE_ZOMBIES];
+    float nearestDistSq[NET_MAX_STATE_ZOMBIES];
+    int filled = 0;
+    for (int i = 0; i < (int)zombies.size(); ++i) {
+        float distSq = Vector2DistanceSqr(zombies[i].pos, player.pos);
+        if (filled < sent) {
+            nearest[filled] = i;
+            nearestDistSq[filled] = distSq;
+            filled++;
+        } else {
+            int farthest = (int)(std::max_element(nearestDistSq, nearestDistSq + filled) - nearestDistSq);
+            if (distSq < nearestDistSq[farthest]) {
+                nearest[farthest] = i;
+                nearestDistSq[farthest] = distSq;
+            }
+        }
+    }
+
+    // Nearest first (ties in list order), so a client reading only the first few gets the closest
+    int order[NET_MAX_STATE_ZOMBIES];
+    for (int k = 0; k < sent; ++k) order[k] = k;
+    std::sort(order, order + sent, [&](int a, int b) {
+        return nearestDistSq[a] != nearestDistSq[b] ? nearestDistSq[a] < nearestDistSq[b] : nearest[a] < nearest[b];
+    });
+
+    writer.u16((uint16_t)sent);
+    for (int k = 0; k < sent; ++k) {
+        const Zombie& zombie = zombies[nearest[order[k]]];
+        writer.u16((uint16_t)zombie.id);
+        writer.u16(QuantizePosition(zombie.pos.x));
+        writer.u16(QuantizePosition(zombie.pos.y));
+        writer.u8((uint8_t)zombie.size);
+        writer.u8((uint8_t)zombie.currentState);
+        writer.u8((uint8_t)(255.0f * std::max(0, zombie.health) / zombie.maxHealth));
+    }
+}
+
+void ReadNetState(ByteReader& reader, NetWorldState& state) {
+    state.sessionId = reader.u32();
+    state.tick = reader.u32();
+    state.lastInputSequence = reader.u32();
+    state.wallRevision = reader.u16();
+    state.time = reader.f32();
+    state.status = reader.u8();
+    state.currentFloor = reader.u8();
+    state.zombiesKilled = reader.u16();
+    state.playerPos.x = reader.f32();
+    state.playerPos.y = reader.f32();
+    state.playerFacing.x = reader.f32();
+    state.playerFacing.y = reader.f32();
+    state.playerHealth = reader.f32();
+    uint8_t flags = reader.u8();
+    state.playerDashing = (flags & 1) != 0;
+    state.triggerHeld = (flags & 2) != 0;
+    state.playerDashTimer = reader.f32();
+    state.playerDashDirection.x = reader.f32();
+    state.playerDashDirection.y = reader.f32();
+    state.fireTime = reader.f32();
+    state.bulletCount = reader.u16();
+    state.zombieCount = reader.u16();
+    state.zombiesSent = std::min<uint16_t>(reader.u16(), NET_MAX_STATE_ZOMBIES);
+    for (int k = 0; k < state.zombiesSent; ++k) {
+        NetZombieState& zombie = state.zombies[k];
+        zombie.id = reader.u16();
+        zombie.pos.x = DequantizePosition(reader.u16());
+        zombie.pos.y = DequantizePosition(reader.u16());
+        zombie.size = reader.u8();
+        zombie.state = reader.u8();
+        zombie.healthFraction = reader.u8() / 255.0f;
+    }
+}
+
+void WriteNetWalls(ByteWriter& writer, uint32_t sessionId, uint16_t revision, const World& world) {
+    const WallList& walls = world.floor.walls;
+    int count = std::min((int)walls.size(), NET_MAX_WALLS);
+    WriteNetHeader(writer, NetMessage::WALLS);
+    writer.u32(sessionId);
+    writer.u16(revision);
+    writer.u8((uint8_t)world.currentFloor);
+    writer.u8((uint8_t)count);
+    for (int i = 0; i < count; ++i) {
+        writer.f32(walls[i].x);
+        writer.f32(walls[i].y);
+        writer.f32(walls[i].width);
+        writer.f32(walls[i].height);
+    }
+}
+
+void ReadNetWalls(ByteReader& reader, NetWalls& walls) {
+    walls.sessionId = reader.u32();
+    walls.revision = reader.u16();
+    walls.floor = reader.u8();
+    walls.count = std::min<uint8_t>(reader.u8(), NET_MAX_WALLS);
+    for (int i = 0; i < walls.count; ++i) {
+        Rectangle& wall = walls.walls[i];
+        wall.x = reader.f32();
+        wall.y = reader.f32();
+        wall.width = reader.f32();
+        wall.height = reader.f32();
+    }
+}
@@ -0,0 +1,155 @@
+#pragma once
+#include "raylib.h"
+#include "World.h"
+#include <cstdint>
+#include <cstring>
+
+// Wire format shared by GameServer and NetClient. Every datagram starts with a two-byte magic
+// and a message type; fields are little-endian and packed back to back (see ByteWriter).
+//
+//   CONNECT     client -> server  weapon, seed (0 = server picks)
+//   ACCEPT      server -> client  session id, tick rate
+//   INPUT       client -> server  session id, walls revision held, newest input sequence and the
+//                                 last NET_INPUT_REDUNDANCY PlayerInputs, oldest first (a lost
+//                                 datagram's inputs arrive with the next one)
+//   STATE       server -> client  session id, tick, last applied input sequence, world summary,
+//                                 the player (with everything prediction replays from) and up to
+//                                 MAX_STATE_ZOMBIES zombies
+//   DISCONNECT  either direction  session id
+//   WALLS       server -> client  session id, walls revision, floor, the floor's walls; sent with
+//                                 STATE until an INPUT reports the client holds that revision
+
+enum class NetMessage : uint8_t {
+    CONNECT = 1,
+    ACCEPT,
+    INPUT,
+    STATE,
+    DISCONNECT,
+    WALLS
+};
+
+const uint16_t NET_PROTOCOL_MAGIC = 0x5A48;  // "ZH"
+const int NET_MAX_PACKET_BYTES = 1200;       // Stays under a typical path MTU, so datagrams are never fragmented
+const int NET_MAX_STATE_ZOMBIES = 100;       // Zombies per STATE datagram (the rest are only counted)
+const uint16_t NET_DEFAULT_PORT = 27015;
+const int NET_INPUT_REDUNDANCY = 4;          // Inputs per INPUT datagram: the newest and the three before it
+const int NET_MAX_WALLS = 64;                // Walls per WALLS datagram (a floor starts with 14; breaks add pieces)
+
+// Appends fixed-size little-endian fields to a caller-provided buffer; overflow sets a flag instead of writing
+class ByteWriter {
+public:
+    ByteWriter(uint8_t* data, size_t capacity) : data(data), capacity(capacity), size(0), overflow(false) {}
+
+    void u8(uint8_t v) { raw(&v, 1); }
+    void u16(uint16_t v) { uint8_t b[2] = { (uint8_t)v, (uint8_t)(v >> 8) }; raw(b, 2); }
+    void u32(uint32_t v) { uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) }; raw(b, 4); }
+    void u64(uint64_t v) { u32((uint32_t)v); u32((uint32_t)(v >> 32)); }
+    void f32(float v) { uint32_t bits; memcpy(&bits, &v, 4); u32(bits); }
+
+    size_t getSize() const { return size; }
+    bool overflowed() const { return overflow; }
+
+private:
+    uint8_t* data;
+    size_t capacity;
+    size_t size;
+    bool overflow;
+
+    void raw(const uint8_t* bytes, size_t count) {
+        if (size + count > capacity) { overflow = true; return; }
+        memcpy(data + size, bytes, count);
+        size += count;
+    }
+};
+
+// Reads what ByteWriter wrote; reading past the end yields zeros and sets a flag
+class ByteReader {
+public:
+    ByteReader(const uint8_t* data, size_t size) : data(data), size(size), offset(0), overflow(false) {}
+
+    uint8_t u8() { uint8_t b[1] = { 0 }; raw(b, 1); return b[0]; }
+    uint16_t u16() { uint8_t b[2] = { 0 }; raw(b, 2); return (uint16_t)(b[0] | (b[1] << 8)); }
+    uint32_t u32() { uint8_t b[4] = { 0 }; raw(b, 4); return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24); }
+    uint64_t u64() { uint64_t lo = u32(); return lo | ((uint64_t)u32() << 32); }
+    float f32() { uint32_t bits = u32(); float v; memcpy(&v, &bits, 4); return v; }
+
+    bool overflowed() const { return overflow; }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+    bool overflow;
+
+    void raw(uint8_t* bytes, size_t count) {
+        if (offset + count > size) { overflow = true; offset = size; return; }
+        memcpy(bytes, data + offset, count);
+        offset += count;
+    }
+};
+
+struct NetZombieState {
+    // Low 16 bits of Zombie::id, which matches a zombie across states for interpolation. They wrap
+    // after 65536 spawns, and ids restart on every floor, so an id alone may name a different zombie
+    // from one state to the next: receivers also require the same size (each archetype has its
+    // own) and a position no further than a zombie can move in between (see ZombieInterpolator)
+    uint16_t id;
+    Vector2 pos; // Travels quantized like a Snapshot's: 1/16 px over [-512, 3584), so the spawn ring fits
+    float size;
+    uint8_t state; // Zombie::ZombieState
+    float healthFraction;
+};
+
+// Decoded STATE message
+struct NetWorldState {
+    uint32_t sessionId;
+    uint32_t tick;
+    uint32_t lastInputSequence; // Input the server applied in the step this state was taken after
+    uint16_t wallRevision;      // Of the walls this state was taken with (see WALLS)
+    float time;                 // World::time
+    uint8_t status;             // World::Status
+    uint8_t currentFloor;
+    uint16_t zombiesKilled;
+    Vector2 playerPos;
+    Vector2 playerFacing;
+    float playerHealth;
+    bool playerDashing;
+    float playerDashTimer;
+    Vector2 playerDashDirection;
+    float fireTime;   // Weapon::lastFireTime
+    bool triggerHeld; // Weapon::triggerHeld
+    uint16_t bulletCount;
+    uint16_t zombieCount;  // Alive on the server
+    uint16_t zombiesSent;  // Entries filled in 'zombies'
+    NetZombieState zombies[NET_MAX_STATE_ZOMBIES]; // Nearest the player first
+};
+
+// Decoded WALLS message
+struct NetWalls {
+    uint32_t sessionId;
+    uint16_t revision;
+    uint8_t floor;
+    uint8_t count;
+    Rectangle walls[NET_MAX_WALLS];
+};
+
+// Writes the header; returns false if 'reader' does not start with one (the type is stored in 'type')
+void WriteNetHeader(ByteWriter& writer, NetMessage type);
+bool ReadNetHeader(ByteReader& reader, NetMessage& type);
+
+// 'inputs' holds 'count' (1..NET_INPUT_REDUNDANCY) inputs, oldest first; the last one is 'sequence'.
+// PlayerInput::fireLead does not travel: the server times shots by its own steps.
+void WriteNetInput(ByteWriter& writer, uint32_t sessionId, uint16_t wallRevision, uint32_t sequence,
+                   const PlayerInput* inputs, int count);
+// Fills 'inputs' (NET_INPUT_REDUNDANCY entries) and returns how many were read
+int ReadNetInput(ByteReader& reader, uint32_t& sessionId, uint16_t& wallRevision, uint32_t& sequence, PlayerInput* inputs);
+
+// Summarizes 'world' into a STATE message. Of more than NET_MAX_STATE_ZOMBIES zombies only the
+// closest to the player are sent; they are written nearest first, ties in the server's list order.
+void WriteNetState(ByteWriter& writer, uint32_t sessionId, uint32_t lastInputSequence, uint16_t wallRevision,
+                   const World& world);
+void ReadNetState(ByteReader& reader, NetWorldState& state);
+
+// The current floor's walls (the first NET_MAX_WALLS of them) as revision 'revision'
+void WriteNetWalls(ByteWriter& writer, uint32_t sessionId, uint16_t revision, const World& world);
+void ReadNetWalls(ByteReader& reader, NetWalls& walls);
@@ -0,0 +1,325 @@
+// NetcodeBenchmark.cpp
+// Client-side prediction over a bad link. For each link profile a GameServer and one NetClient
+// run in-process over 127.0.0.1, with a LinkEmulator relay between them adding one-way latency,
+// jitter and loss, all on a simulated clock in 1 ms steps (the server ticks at 60 Hz, the client
+// frames half a tick later). A scripted player runs, turns, dashes through the walls' maze and
+// fires the minigun; the client predicts each input at once (PlayerPredictor), reconciles with
+// every STATE, and draws the zombies through a ZombieInterpolator.
+// Reports, per profile: how often a state disagreed with the prediction (corrections per second
+// and per 100 states) and by how much, the re-simulation that cost (steps replayed, CPU per
+// correction and per second of play) next to predicting new inputs, the server's input queue
+// running dry or overflowing, how many frames drew interpolated zombies, and how late the player
+// would see their own input without prediction.
+// Then checks the interpolator against reused wire ids: two states where an id names a different
+// zombie (another size, or too far to have walked there), or two zombies at once; and that zombies
+// still out on the spawn ring, past every edge of the world, cross the wire where they stand, nearest
+// the player first.
+// Exits 1 if a client fails to connect or receive states, a clean link (the first profile) needs
+// more than startup corrections, a link whose jitter fits in the interpolation delay draws fewer
+// than 90% of frames interpolated, a reused id is interpolated from the wrong zombie, or an
+// off-screen zombie arrives more than a quantization step from where it was sent or out of order.
+//
+// Usage: net_bench [seconds=20] [seed=1]
+
+#include "raylib.h"
+#include "GameServer.h"
+#include "NetClient.h"
+#include "LinkEmulator.h"
+#include "ClientPrediction.h"
+#include "WeaponTypes.h"
+#include "ZombieTypes.h"
+#include "raymath.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const float WORLD_WIDTH = 1200.0f; // GameServer's session worlds
+static const float WORLD_HEIGHT = 800.0f;
+static const int SEND_TIME_SLOTS = 1024;  // Send times of recent inputs, by sequence
+
+struct Profile {
+    const char* name;
+    LinkEmulator::Config link;
+};
+
+struct RunResult {
+    bool connected = false;
+    double playedSeconds = 0.0; // Until the run ended or the player died
+    PlayerPredictor::Stats prediction;
+    ZombieInterpolator::Stats interpolation;
+    GameServer::Stats server = {};
+    LinkEmulator::Stats link;
+    uint64_t states = 0;
+    double inputDelaySum = 0.0; // Input sent to the first state showing it
+    uint64_t inputDelays = 0;
+    uint64_t startupCorrections = 0; // In the first second
+};
+
+// Runs about the arena: a new heading every half second (turning back towards the middle when
+// near an edge), a dash every two seconds, always firing at the nearest zombie drawn
+static PlayerInput Autopilot(const PlayerPredictor& predictor, const std::vector<NetZombieState>& zombies, uint64_t frame,
+                             Rng& rng, Vector2& heading) {
+    Vector2 pos = predictor.getPlayer().pos;
+    if (frame % 30 == 0) {
+        heading = { (float)rng.range(-100, 100), (float)rng.range(-100, 100) };
+        Vector2 toCenter = Vector2Subtract({ WORLD_WIDTH / 2, WORLD_HEIGHT / 2 }, pos);
+        if (Vector2Length(toCenter) > 250.0f) heading = Vector2Add(heading, Vector2Scale(Vector2Normalize(toCenter), 120.0f));
+    }
+    PlayerInput input = { heading, Vector2Add(pos, predictor.getPlayer().facing), true, frame % 120 == 60 };
+    float nearest = 1e30f;
+    for (const NetZombieState& zombie : zombies) {
+        float distSq = Vector2DistanceSqr(zombie.pos, pos);
+        if (distSq < nearest) {
+            nearest = distSq;
+            input.aim = zombie.pos;
+        }
+    }
+    return input;
+}
+
+struct WireZombie {
+    uint16_t id;
+    Vector2 pos;
+    float size;
+};
+
+// Interpolates halfway between two hand-made states; returns the position drawn for the later
+// state's zombie 'index'
+static Vector2 InterpolateHalfway(const std::vector<WireZombie>& earlier, const std::vector<WireZombie>& later, int index) {
+    float tick = 1.0f / 60.0f;
+    ZombieInterpolator interpolator(tick);
+    static NetWorldState state; // Large: kept off the stack
+    const std::vector<WireZombie>* lists[2] = { &earlier, &later };
+    for (int s = 0; s < 2; ++s) {
+        state = {};
+        state.tick = 10 + 2 * s;
+        state.zombiesSent = (uint16_t)lists[s]->size();
+        for (size_t k = 0; k < lists[s]->size(); ++k) {
+            const WireZombie& z = (*lists[s])[k];
+            state.zombies[k] = { z.id, z.pos, z.size, 0, 1.0f };
+        }
+        interpolator.push(state, state.tick * (double)tick);
+    }
+    std::vector<NetZombieState> zombies;
+    interpolator.sample(11 * (double)tick + ZombieInterpolator::INTERPOLATION_DELAY, zombies);
+    for (const NetZombieState& zombie : zombies) {
+        if (zombie.id == later[index].id && zombie.size == later[index].size) return zombie.pos;
+    }
+    return { -1, -1 };
+}
+
+static bool CheckIdReuse() {
+    struct Case {
+        const char* name;
+        std::vector<WireZombie> earlier, later;
+        Vector2 expected;
+    };
+    const Case cases[] = {
+        { "same zombie", { { 7, { 100, 100 }, 15 } }, { { 7, { 104, 100 }, 15 } }, { 102, 100 } },
+        { "id reused far away", { { 7, { 100, 100 }, 15 } }, { { 7, { 900, 500 }, 15 } }, { 900, 500 } },
+        { "id reused by another kind", { { 7, { 100, 100 }, 15 } }, { { 7, { 104, 100 }, 25 } }, { 104, 100 } },
+        { "two zombies, one id", { { 7, { 100, 100 }, 15 }, { 7, { 880, 500 }, 25 } }, { { 7, { 884, 500 }, 25 } }, { 882, 500 } },
+    };
+    bool ok = true;
+    for (const Case& c : cases) {
+        Vector2 drawn = InterpolateHalfway(c.earlier, c.later, 0);
+        if (Vector2Distance(drawn, c.expected) > 0.01f) {
+            printf("FAILED: %s: drawn at (%.1f, %.1f), expected (%.1f, %.1f)\n", c.name, drawn.x, drawn.y, c.expected.x,
+                   c.expected.y);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// One STATE round trip of zombies on the spawn ring and just inside each edge
+static bool CheckOffscreenPositions() {
+    const Vector2 positions[] = { { -50.0f, -50.0f }, { -12.5f, 400.0f }, { 600.0f, -0.75f },
+                                  { WORLD_WIDTH + 50.0f, WORLD_HEIGHT + 50.0f }, { 0.0f, 0.0f }, { WORLD_WIDTH, 20.0f } };
+    const int count = (int)(sizeof(positions) / sizeof(positions[0]));
+    World world(WORLD_WIDTH, WORLD_HEIGHT);
+    world.start(CreatePistol(), 1);
+    world.floor.zombies.clear();
+    for (int i = 0; i < count; ++i) {
+        world.floor.zombies.push_back(MakeZombie(ZombieKind::Fast, positions[i]));
+        world.floor.zombies.back().id = (uint32_t)(i + 1);
+    }
+
+    uint8_t packet[NET_MAX_PACKET_BYTES];
+    ByteWriter writer(packet, sizeof(packet));
+    WriteNetState(writer, 1, 0, 0, world);
+    ByteReader reader(packet, writer.getSize());
+    NetMessage type;
+    static NetWorldState state; // Large: kept off the stack
+    bool ok = !writer.overflowed() && ReadNetHeader(reader, type) && type == NetMessage::STATE;
+    if (ok) ReadNetState(reader, state);
+    if (!ok || reader.overflowed() || state.zombiesSent != count) {
+        printf("FAILED: the off-screen zombies' STATE did not round-trip\n");
+        return false;
+    }
+    for (int k = 0; k < state.zombiesSent; ++k) {
+        const NetZombieState& zombie = state.zombies[k];
+        if (k > 0 && Vector2DistanceSqr(zombie.pos, state.playerPos) < Vector2DistanceSqr(state.zombies[k - 1].pos, state.playerPos)) {
+            printf("FAILED: STATE zombie %d is nearer the player than the one before it\n", k);
+            ok = false;
+        }
+        Vector2 sent = positions[zombie.id - 1];
+        if (std::fabs(zombie.pos.x - sent.x) > 1.0f / 32.0f || std::fabs(zombie.pos.y - sent.y) > 1.0f / 32.0f) {
+            printf("FAILED: a zombie sent at (%.2f, %.2f) arrived at (%.2f, %.2f)\n", sent.x, sent.y, zombie.pos.x, zombie.pos.y);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+static RunResult Run(const Profile& profile, float seconds, uint64_t seed) {
+    RunResult result;
+    GameServer::Config serverConfig = GameServer::DefaultConfig();
+    serverConfig.port = 0;
+    GameServer server(serverConfig);
+    if (!server.start()) return result;
+    NetAddress serverAddress, relayAddress;
+    UdpSocket::ParseAddress("127.0.0.1", server.getPort(), serverAddress);
+    LinkEmulator link(profile.link);
+    if (!link.open(serverAddress)) return result;
+    UdpSocket::ParseAddress("127.0.0.1", link.getPort(), relayAddress);
+
+    NetClient client;
+    if (!client.connect(relayAddress, WeaponType::Minigun, seed)) return result;
+
+    float tick = server.getTickSeconds();
+    PlayerPredictor predictor(WORLD_WIDTH, WORLD_HEIGHT, tick);
+    ZombieInterpolator interpolator(tick);
+    std::vector<NetZombieState> zombies;
+    std::vector<double> sendTimes(SEND_TIME_SLOTS, 0.0);
+    uint32_t shownSequence = 0;
+    uint16_t wallRevision = 0;
+    bool started = false;
+    Rng rng(seed);
+    Vector2 heading = { 1, 0 };
+
+    double nextServerTick = 0.0, nextClientFrame = 0.5 * tick;
+    uint64_t frame = 0;
+    for (int ms = 0; ms <= (int)(seconds * 1000.0f); ++ms) {
+        double now = ms / 1000.0;
+        if (now >= nextServerTick) {
+            server.tick();
+            nextServerTick += tick;
+        }
+        if (now >= nextClientFrame) {
+            nextClientFrame += tick;
+            client.poll();
+            if (client.getStatus() != NetClient::Status::CONNECTED) {
+                link.poll(now);
+                continue;
+            }
+            if (!started) {
+                predictor.start(CreateMinigun());
+                started = true;
+            }
+            if (client.getWallRevision() != wallRevision) {
+                wallRevision = client.getWallRevision();
+                predictor.setWalls(client.getWalls());
+            }
+            for (const NetWorldState& state : client.getReceivedStates()) {
+                interpolator.push(state, now);
+                uint64_t correctionsBefore = predictor.getStats().corrections;
+                predictor.reconcile(state);
+                if (now < 1.0) result.startupCorrections += predictor.getStats().corrections - correctionsBefore;
+                if (state.lastInputSequence > shownSequence) {
+                    shownSequence = state.lastInputSequence;
+                    result.inputDelaySum += now - sendTimes[shownSequence % SEND_TIME_SLOTS];
+                    result.inputDelays++;
+                }
+                result.states++;
+            }
+            if (client.getState().status != (uint8_t)World::Status::PLAYING) break;
+
+            interpolator.sample(now, zombies);
+            PlayerInput input = Autopilot(predictor, zombies, frame++, rng, heading);
+            uint32_t sequence = client.sendInput(input);
+            sendTimes[sequence % SEND_TIME_SLOTS] = now;
+            predictor.predict(sequence, input);
+            predictor.smooth(tick);
+            result.playedSeconds = now;
+        }
+        link.poll(now);
+    }
+
+    result.connected = started;
+    result.prediction = predictor.getStats();
+    result.interpolation = interpolator.getStats();
+    result.server = server.takeStats();
+    result.link = link.getStats();
+    client.disconnect();
+    server.stop();
+    return result;
+}
+
+int main(int argc, char** argv) {
+    float seconds = argc > 1 ? (float)atof(argv[1]) : 20.0f;
+    uint64_t seed = argc > 2 ? strtoull(argv[2], nullptr, 10) : 1;
+    if (seconds < 3.0f) seconds = 3.0f;
+
+    SetTraceLogLevel(LOG_WARNING);
+    // name, { one-way latency, jitter, loss, seed }
+    const Profile profiles[] = {
+        { "clean", { 0.0f, 0.0f, 0.0f, seed } },
+        { "lan", { 0.002f, 0.001f, 0.0f, seed } },
+        { "broadband", { 0.025f, 0.005f, 0.005f, seed } },
+        { "wifi", { 0.040f, 0.015f, 0.02f, seed } },
+        { "mobile", { 0.080f, 0.030f, 0.05f, seed } },
+        { "congested", { 0.120f, 0.060f, 0.10f, seed } },
+    };
+
+    printf("Client prediction over a lossy loopback link: %.0f s per profile, seed %llu, interpolation delay %.0f ms\n",
+           seconds, (unsigned long long)seed, ZombieInterpolator::INTERPOLATION_DELAY * 1000.0f);
+    printf("  %-10s %7s %6s %5s | %7s %7s %7s %8s %8s | %8s %8s %9s %9s | %6s %6s | %6s %6s | %9s\n", "link", "rtt", "jitter",
+           "loss", "states", "corr/s", "/100st", "mean px", "max px", "replayed", "us/corr", "replay/s", "predict/s",
+           "starve", "drop", "interp", "held", "no-pred");
+
+    GameServer::Config serverConfig = GameServer::DefaultConfig();
+    float stateSeconds = (float)serverConfig.stateInterval / serverConfig.tickRate;
+    bool ok = true;
+    for (const Profile& profile : profiles) {
+        RunResult r = Run(profile, seconds, seed);
+        const PlayerPredictor::Stats& p = r.prediction;
+        double played = r.playedSeconds > 0.0 ? r.playedSeconds : 1.0;
+        double corrections = p.corrections > 0 ? (double)p.corrections : 1.0;
+        uint64_t frames = r.interpolation.interpolated + r.interpolation.held + r.interpolation.early;
+        double interpolated = frames > 0 ? 100.0 * r.interpolation.interpolated / frames : 0.0;
+        printf("  %-10s %4.0f ms %3.0f ms %4.1f%% | %7llu %7.2f %7.2f %8.2f %8.2f | %8.1f %8.2f %6.1f us %6.1f us | %6llu %6llu "
+               "| %5.1f%% %5.1f%% | %6.1f ms\n",
+               profile.name, 2000.0f * profile.link.latency, 1000.0f * profile.link.jitter, 100.0f * profile.link.loss,
+               (unsigned long long)r.states, p.corrections / played, 100.0 * p.corrections / (r.states > 0 ? r.states : 1),
+               p.errorSum / corrections, p.maxError, p.replayedSteps / corrections, p.replayUs / corrections,
+               p.replayUs / played, p.predictUs / played, (unsigned long long)r.server.inputsMissing,
+               (unsigned long long)r.server.inputsDropped, interpolated,
+               frames > 0 ? 100.0 * r.interpolation.held / frames : 0.0,
+               r.inputDelays > 0 ? 1000.0 * r.inputDelaySum / r.inputDelays : 0.0);
+        if (r.playedSeconds < seconds - 0.5) printf("    (the player died after %.1f s)\n", r.playedSeconds);
+
+        if (!r.connected || r.states == 0 || p.predictedSteps == 0) {
+            printf("FAILED: %s: the client %s\n", profile.name, r.connected ? "received no states" : "never connected");
+            ok = false;
+        }
+        if (&profile == &profiles[0] && p.corrections > r.startupCorrections) {
+            printf("FAILED: %s: %llu corrections after the first second on a clean link\n", profile.name,
+                   (unsigned long long)(p.corrections - r.startupCorrections));
+            ok = false;
+        }
+        bool jitterFits = 2.0f * profile.link.jitter + stateSeconds <= ZombieInterpolator::INTERPOLATION_DELAY;
+        if (jitterFits && interpolated < 90.0) {
+            printf("FAILED: %s: only %.1f%% of frames interpolated\n", profile.name, interpolated);
+            ok = false;
+        }
+    }
+    if (!CheckIdReuse()) ok = false;
+    if (!CheckOffscreenPositions()) ok = false;
+    if (!ok) return 1;
+    printf("  Re-simulation replays only the player: a correction costs microseconds at any latency\n");
+    printf("  Reused zombie ids are never interpolated from another zombie\n");
+    printf("  Zombies on the spawn ring arrive where they stand\n");
+    return 0;
+}
@@ -0,0 +1,197 @@
+#include "OccupancyGrid.h"
+#include "CellLists.h"
+#include <algorithm>
+#include <cmath>
+
+const float OccupancyGrid::DEFAULT_CELL_SIZE = 8.0f;
+
+OccupancyGrid::OccupancyGrid(std::pmr::memory_resource* resource)
+    : walls(nullptr), bounds({ 0, 0, 0, 0 }), cellSize(DEFAULT_CELL_SIZE), cols(0), rows(0),
+      cells(resource), cellStart(resource), cellWalls(resource) {}
+
+void OccupancyGrid::build(const WallList& wallList, float worldWidth, float worldHeight, float newCellSize) {
+    walls = &wallList;
+    cellSize = newCellSize;
+
+    // Walls may hang over the world's edge (they are placed by their top-left corner)
+    float minX = 0.0f, minY = 0.0f, maxX = worldWidth, maxY = worldHeight;
+    for (const Rectangle& wall : wallList) {
+        if (wall.x < minX) minX = wall.x;
+        if (wall.y < minY) minY = wall.y;
+        if (wall.x + wall.width > maxX) maxX = wall.x + wall.width;
+        if (wall.y + wall.height > maxY) maxY = wall.y + wall.height;
+    }
+    cols = (int)ceilf((maxX - minX) / cellSize);
+    rows = (int)ceilf((maxY - minY) / cellSize);
+    if (cols < 1) cols = 1;
+    if (rows < 1) rows = 1;
+    bounds = { minX, minY, cols * cellSize, rows * cellSize };
+
+    int cellCount = cols * rows;
+    cells.assign(cellCount, 0);
+    cellStart.assign(cellCount + 1, 0);
+
+    // Conservative rasterization: every cell the rectangle overlaps, even partially. Pass 1 marks
+    // and counts (shifted by one for the prefix sum), pass 2 scatters the wall indices.
+    auto forEachCell = [&](const Rectangle& wall, auto&& fn) {
+        int minCol, minRow, maxCol, maxRow;
+        if (!cellRange(wall, minCol, minRow, maxCol, maxRow)) return;
+        for (int row = minRow; row <= maxRow; ++row)
+            for (int col = minCol; col <= maxCol; ++col)
+                fn(row * cols + col);
+    };
+    for (const Rectangle& wall : wallList) {
+        forEachCell(wall, [&](int cell) {
+            cells[cell] = 1;
+            cellStart[cell + 1]++;
+        });
+    }
+    for (int i = 0; i < cellCount; ++i) cellStart[i + 1] += cellStart[i];
+
+    cellWalls.assign(cellStart[cellCount], 0);
+    std::vector<int> cursor(cellStart.begin(), cellStart.end() - 1); // Scratch, so it stays off the arena
+    for (int w = 0; w < (int)wallList.size(); ++w) {
+        forEachCell(wallList[w], [&](int cell) { cellWalls[cursor[cell]++] = w; });
+    }
+}
+
+void OccupancyGrid::updateRegion(Rectangle area) {
+    int minCol, minRow, maxCol, maxRow;
+    if (!walls || !cellRange(area, minCol, minRow, maxCol, maxRow)) return;
+    RelistCells(cellStart, cellWalls, cols, minCol, minRow, maxCol, maxRow, (int)walls->size(),
+                [&](int wall, int& wallMinCol, int& wallMinRow, int& wallMaxCol, int& wallMaxRow) {
+                    return cellRange((*walls)[wall], wallMinCol, wallMinRow, wallMaxCol, wallMaxRow);
+                });
+    for (int row = minRow; row <= maxRow; ++row) {
+        for (int col = minCol; col <= maxCol; ++col) {
+            int cell = row * cols + col;
+            cells[cell] = cellStart[cell + 1] > cellStart[cell] ? 1 : 0;
+        }
+    }
+}
+
+bool OccupancyGrid::cellRange(Rectangle area, int& minCol, int& minRow, int& maxCol, int& maxRow) const {
+    if (cols == 0 || rows == 0) return false;
+    minCol = (int)floorf((area.x - bounds.x) / cellSize);
+    minRow = (int)floorf((area.y - bounds.y) / cellSize);
+    maxCol = (int)floorf((area.x + area.width - bounds.x) / cellSize);
+    maxRow = (int)floorf((area.y + area.height - bounds.y) / cellSize);
+    if (maxCol < 0 || maxRow < 0 || minCol >= cols || minRow >= rows) return false;
+    if (minCol < 0) minCol = 0;
+    if (minRow < 0) minRow = 0;
+    if (maxCol >= cols) maxCol = cols - 1;
+    if (maxRow >= rows) maxRow = rows - 1;
+    return true;
+}
+
+void OccupancyGrid::release() {
+    std::pmr::vector<uint8_t>(cells.get_allocator()).swap(cells);
+    std::pmr::vector<int>(cellStart.get_allocator()).swap(cellStart);
+    std::pmr::vector<int>(cellWalls.get_allocator()).swap(cellWalls);
+    walls = nullptr;
+    cols = rows = 0;
+}
+
+bool OccupancyGrid::containsPoint(Vector2 point) const {
+    if (!CheckCollisionPointRec(point, bounds)) return false;
+    int col = std::min((int)((point.x - bounds.x) / cellSize), cols - 1);
+    int row = std::min((int)((point.y - bounds.y) / cellSize), rows - 1);
+    int cell = row * cols + col;
+    if (!cells[cell]) return false;
+    for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+        if (CheckCollisionPointRec(point, (*walls)[cellWalls[i]])) return true;
+    }
+    return false;
+}
+
+// Slab test of the segment from + t*delta (t in [0, 1]) against 'rect'; returns the entry t or -1
+static float SegmentEntry(Vector2 from, Vector2 delta, const Rectangle& rect) {
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    const float origin[2] = { from.x, from.y };
+    const float dir[2] = { delta.x, delta.y };
+    const float low[2] = { rect.x, rect.y };
+    const float high[2] = { rect.x + rect.width, rect.y + rect.height };
+    for (int axis = 0; axis < 2; ++axis) {
+        if (dir[axis] == 0.0f) {
+            if (origin[axis] < low[axis] || origin[axis] > high[axis]) return -1.0f;
+            continue;
+        }
+        float inv = 1.0f / dir[axis];
+        float t0 = (low[axis] - origin[axis]) * inv;
+        float t1 = (high[axis] - origin[axis]) * inv;
+        if (t0 > t1) { float t = t0; t0 = t1; t1 = t; }
+        if (t0 > tMin) tMin = t0;
+        if (t1 < tMax) tMax = t1;
+        if (tMin > tMax) return -1.0f;
+    }
+    return tMin;
+}
+
+void OccupancyGrid::refineCell(int col, int row, Vector2 from, Vector2 delta, RayHit& hit) const {
+    int cell = row * cols + col;
+    for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+        int wall = cellWalls[i];
+        float t = SegmentEntry(from, delta, (*walls)[wall]);
+        if (t >= 0.0f && t < hit.fraction) {
+            hit.fraction = t;
+            hit.wall = wall;
+        }
+    }
+}
+
+RayHit OccupancyGrid::castSegment(const RaySegment& segment) const {
+    RayHit hit = { 1.0f, -1 };
+    if (cols == 0 || !walls || walls->empty()) return hit;
+
+    Vector2 from = segment.from;
+    Vector2 delta = { segment.to.x - from.x, segment.to.y - from.y };
+
+    // Clip to the grid; nothing outside it can be hit
+    float tEnter = SegmentEntry(from, delta, bounds);
+    if (tEnter < 0.0f) return hit;
+    // Exit parameter: the same slab test run from the far end
+    float fromEnd = SegmentEntry(segment.to, { -delta.x, -delta.y }, bounds);
+    float tExit = fromEnd > 0.0f ? 1.0f - fromEnd : 1.0f;
+
+    // The walk runs relative to the grid's corner; refinement stays in world coordinates
+    Vector2 local = { from.x - bounds.x, from.y - bounds.y };
+    Vector2 start = { local.x + delta.x * tEnter, local.y + delta.y * tEnter };
+    int col = (int)floorf(start.x / cellSize);
+    int row = (int)floorf(start.y / cellSize);
+    if (col >= cols) col = cols - 1;
+    if (row >= rows) row = rows - 1;
+    if (col < 0) col = 0;
+    if (row < 0) row = 0;
+
+    // Amanatides-Woo: t to the next vertical / horizontal cell boundary, and t per whole cell
+    int stepX = delta.x > 0 ? 1 : (delta.x < 0 ? -1 : 0);
+    int stepY = delta.y > 0 ? 1 : (delta.y < 0 ? -1 : 0);
+    float tDeltaX = stepX != 0 ? cellSize / fabsf(delta.x) : INFINITY;
+    float tDeltaY = stepY != 0 ? cellSize / fabsf(delta.y) : INFINITY;
+    float tMaxX = stepX > 0 ? ((col + 1) * cellSize - local.x) / delta.x
+                : stepX < 0 ? (col * cellSize - local.x) / delta.x : INFINITY;
+    float tMaxY = stepY > 0 ? ((row + 1) * cellSize - local.y) / delta.y
+                : stepY < 0 ? (row * cellSize - local.y) / delta.y : INFINITY;
+
+    while (true) {
+        if (cells[row * cols + col]) refineCell(col, row, from, delta, hit);
+        // A hit before the current cell's far side can't be beaten by any later cell
+        float tLeave = tMaxX < tMaxY ? tMaxX : tMaxY;
+        if (hit.wall >= 0 && hit.fraction <= tLeave) break;
+        if (tLeave > tExit) break;
+        if (tMaxX < tMaxY) {
+            col += stepX;
+            tMaxX += tDeltaX;
+        } else {
+            row += stepY;
+            tMaxY += tDeltaY;
+        }
+        if (col < 0 || col >= cols || row < 0 || row >= rows) break;
+    }
+    return hit;
+}
+
+void OccupancyGrid::castSegments(const RaySegment* segments, int count, RayHit* results) const {
+    for (int i = 0; i < count; ++i) results[i] = castSegment(segments[i]);
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "raylib.h"
+#include "FloorArena.h"
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+// A segment to test, from 'from' towards 'to'
+struct RaySegment {
+    Vector2 from;
+    Vector2 to;
+};
+
+struct RayHit {
+    float fraction; // Along the segment where it first touches a wall; 1 when the segment is clear
+    int wall;       // Index into the floor's walls, or -1
+};
+
+// The floor's walls rasterized into a fine occupancy bitmap (one byte per cell, non-zero where any
+// wall overlaps the cell), built right after the walls are generated and patched when walls break.
+// Rays walk the bitmap cell by cell with the Amanatides-Woo DDA, so a ray costs a constant amount
+// per cell it crosses no matter how many walls the floor has. Occupied cells also list their walls (compressed like WallIndex),
+// and only those are tested against the exact rectangles, so hits are exact, not cell-quantized.
+// The grid spans the world plus any wall overhanging it; segments are clipped to that area, so
+// rays from the off-screen spawn ring work too. Storage comes from the floor arena.
+class OccupancyGrid {
+public:
+    static const float DEFAULT_CELL_SIZE;
+
+    explicit OccupancyGrid(std::pmr::memory_resource* resource);
+
+    void build(const WallList& walls, float worldWidth, float worldHeight, float cellSize = DEFAULT_CELL_SIZE);
+
+    // Re-rasterizes the cells overlapping 'area' after walls inside it broke, as WallIndex::updateRegion.
+    // Walls only shrink or vanish when they break, so the grid's extent never has to grow.
+    void updateRegion(Rectangle area);
+
+    // Empties the grid and hands its storage back before the arena is rewound
+    void release();
+
+    RayHit castSegment(const RaySegment& segment) const;
+
+    // Casts 'count' segments; results[i] belongs to segments[i]
+    void castSegments(const RaySegment* segments, int count, RayHit* results) const;
+
+    // True when no wall touches the segment between 'from' and 'to'
+    bool lineOfSight(Vector2 from, Vector2 to) const { return castSegment({ from, to }).wall < 0; }
+
+    // True when 'point' lies inside a wall. Most points land in empty cells and are answered by
+    // the bitmap alone; occupied cells test their listed walls exactly.
+    bool containsPoint(Vector2 point) const;
+
+    bool isOccupied(int col, int row) const { return cells[row * cols + col] != 0; }
+    int getCols() const { return cols; }
+    int getRows() const { return rows; }
+    float getCellSize() const { return cellSize; }
+
+private:
+    const WallList* walls;
+    Rectangle bounds; // Area covered by the grid, in world coordinates
+    float cellSize;
+    int cols;
+    int rows;
+    std::pmr::vector<uint8_t> cells;  // Occupancy bitmap, cols*rows
+    std::pmr::vector<int> cellStart;  // cols*rows + 1 offsets into cellWalls
+    std::pmr::vector<int> cellWalls;  // Wall indices, grouped by cell
+
+    // Clamps the cells touched by 'area' to the grid; false if it lies entirely outside
+    bool cellRange(Rectangle area, int& minCol, int& minRow, int& maxCol, int& maxRow) const;
+
+    // Exact first hit of the segment with walls overlapping one occupied cell, improving 'hit'
+    void refineCell(int col, int row, Vector2 from, Vector2 delta, RayHit& hit) const;
+};
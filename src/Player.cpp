@@ -1,6 +1,8 @@
 #include "Player.h"
 #include <algorithm> // For std::remove_if
+#include <cmath>
 #include "raymath.h"
+#include "Renderer.h"
 #include "CollisionUtils.h" // Assuming CollisionUtils.h exists and has CollidesWithWallCircle
 #include <utility> // For std::move
 
@@ -12,6 +14,7 @@
 // --- Static Constant Definitions ---
 const float Player::INVULNERABILITY_DURATION = 0.5f;
 const float Player::MUZZLE_FLASH_DURATION = 0.05f;
+const float Player::TRACER_DURATION = 0.15f;
 const float Player::DASH_DURATION = 0.15f; // Short burst
 const float Player::DASH_SPEED_MULTIPLIER = 5.0f; // 5x normal speed during dash
 const float Player::REGEN_COOLDOWN = 3.0f; // 3 seconds after last damage to start regen
@@ -37,45 +40,75 @@ Player::Player(Vector2 startPos, Vector2 startFacing, float size, int health, We
 
 // --- Public Update & Draw ---
 
-void Player::update(float deltaTime, std::vector<Zombie>& zombies, const std::vector<Rectangle>& walls) {
+// Parameter along 'from' + t * 'delta' (t in 0..1) where a circle of 'radius' around 'from' first
+// touches one of 'reach' around 'center', or a negative value if it never does within the segment
+static float SweptHitTime(Vector2 from, Vector2 delta, Vector2 center, float reach) {
+    float fx = from.x - center.x;
+    float fy = from.y - center.y;
+    float c = fx * fx + fy * fy - reach * reach;
+    if (c <= 0.0f) return 0.0f; // Already touching at the start
+    float a = delta.x * delta.x + delta.y * delta.y;
+    float b = fx * delta.x + fy * delta.y;
+    if (a == 0.0f || b >= 0.0f) return -1.0f; // Not moving, or moving away
+    float discriminant = b * b - a * c;
+    if (discriminant < 0.0f) return -1.0f;
+    float t = (-b - sqrtf(discriminant)) / a;
+    return t <= 1.0f ? t : -1.0f;
+}
+
+void Player::update(float deltaTime, ZombieList& zombies, const ZombieGrid& zombieGrid, const WallList& walls, Vector2 worldSize) {
     // Update all timers for various effects
     updateInvulnerability(deltaTime);
     updateMuzzleFlash(deltaTime);
+    updateTracers(deltaTime);
     updateDamageFlash(deltaTime); // New: for hit flash
     updateDash(deltaTime);       // New: handles dash movement and state
     updateHealthRegen(deltaTime); // New: handles passive health regeneration
 
-    // Handle zombie-player collision and damage
-    // Player::takeDamage handles invulnerability
-    for (auto& zombie : zombies) {
-        float dist = Vector2Distance(pos, zombie.getPos());
-        if (dist < size + zombie.getSize()) {
-            takeDamage(20.0f * deltaTime); // Zombie deals damage over time
-        }
-    }
+    // Contact damage from touching zombies is applied by World::step from its contact query
 
     // Update bullets (existing logic)
     for (size_t i = 0; i < bullets.size(); ++i) {
         Bullet& bullet = bullets[i];
         if (!bullet.active) continue;
 
+        // This step's path, from where the bullet left the muzzle if it was fired during the step
+        Vector2 from = Vector2Add(bullet.pos, Vector2Scale(bullet.velocity, bullet.launchDelay));
+        bullet.launchDelay = 0.0f;
         bullet.update(deltaTime);
+        bool explosive = bullet.blastRadius > 0;
+        if (explosive) {
+            bullet.fuse -= deltaTime;
+            if (bullet.fuse <= 0) bullet.active = false;
+        }
 
-        // Bullet-zombie collision
-        for (auto& zombie : zombies) {
-            if (!bullet.active) break;
-            float dist = Vector2Distance(bullet.pos, zombie.getPos());
-            if (dist < bullet.radius + zombie.getSize()) {
-                zombie.takeDamage(bullet.damage);
+        // Bullet-zombie collision: the first body along the path, not just one overlapping where the
+        // bullet ends up, so fast rounds and slow ticks don't tunnel (explosive rounds hurt through
+        // their blast only). Equally early hits go to the zombie first in the list.
+        if (bullet.active) {
+            Vector2 delta = Vector2Subtract(bullet.pos, from);
+            int hitIndex = -1;
+            float hitTime = 2.0f;
+            auto test = [&](int index, const Zombie& zombie) {
+                float t = SweptHitTime(from, delta, zombie.pos, bullet.radius + zombie.size);
+                if (t < 0.0f || t > hitTime || (t == hitTime && index > hitIndex)) return;
+                hitTime = t;
+                hitIndex = index;
+            };
+            zombieGrid.forEachNearSegment(from, bullet.pos, bullet.radius + zombieGrid.getMaxZombieSize(), test);
+            for (int z = zombieGrid.getIndexedCount(); z < (int)zombies.size(); ++z) test(z, zombies[z]);
+            if (hitIndex >= 0) {
+                if (!explosive) zombies[hitIndex].takeDamage(bullet.damage);
+                bullet.pos = Vector2Add(from, Vector2Scale(delta, hitTime)); // Where it struck, for the blast
                 bullet.active = false;
-                break;
             }
         }
 
-        // Bullet-wall collision
+        // Bullet-wall collision (explosive rounds damage walls through their blast)
         if (bullet.active) {
-            for (const auto& wall : walls) {
-                if (CheckCollisionPointRec(bullet.pos, wall)) {
+            for (int w = 0; w < (int)walls.size(); ++w) {
+                if (CheckCollisionPointRec(bullet.pos, walls[w])) {
+                    if (!explosive) wallHits.push_back({ w, bullet.pos, bullet.damage });
                     bullet.active = false;
                     break;
                 }
@@ -85,9 +118,11 @@ void Player::update(float deltaTime, std::vector<Zombie>& zombies, const std::ve
         // Boundary check
         if (bullet.active && (
             bullet.pos.x < 0 || bullet.pos.y < 0 ||
-            bullet.pos.x > GetScreenWidth() || bullet.pos.y > GetScreenHeight())) {
+            bullet.pos.x > worldSize.x || bullet.pos.y > worldSize.y)) {
             bullet.active = false;
         }
+
+        if (explosive && !bullet.active) detonations.push_back({ bullet.pos, bullet.blastRadius, bullet.damage });
     }
 
     // Remove inactive bullets efficiently
@@ -99,40 +134,46 @@ void Player::update(float deltaTime, std::vector<Zombie>& zombies, const std::ve
 }
 
 
-void Player::draw() const {
+void Player::draw(Renderer& renderer) const {
     // Player visual feedback: Flashing when invulnerable OR hit
     bool isFlashing = (invulnerabilityTimer > 0 && (int)(GetTime() * 10) % 2 == 0) ||
                       (damageTakenFlashTimer > 0 && (int)(GetTime() * 20) % 2 == 0); // Faster flash for hit
 
     if (!isFlashing) { // Only draw stickman if not in a "blink" phase
-        drawStickman(); 
+        drawStickman(renderer);
     }
     
-    weapon.draw(pos, facing); // Draw the weapon held by the player
-    drawMuzzleFlash();       // Draw muzzle flash if active
+    weapon.draw(renderer, pos, facing); // Draw the weapon held by the player
+    drawMuzzleFlash(renderer);     // Draw muzzle flash if active
+    drawTracers(renderer);
 
     // Draw health bar above player (can be hidden if HUD is primary)
-    drawHealthBar();
+    drawHealthBar(renderer);
 
-    // Draw bullets
-    for (const auto& bullet : bullets) {
-        if (bullet.active) bullet.draw();
-    }
+    // Bullets are drawn separately as one batch by BulletRenderer
 }
 
 
-void Player::shoot(float currentTime) {
-    if (weapon.canFire(currentTime)) {
-        weapon.playFireSound();
-        // Bullet originates slightly ahead of the player in the facing direction
-        Vector2 bulletOrigin = Vector2Add(pos, Vector2Scale(Vector2Normalize(facing), size * 0.8f));
-        Vector2 bulletVel = Vector2Normalize(facing);
-        bulletVel.x *= weapon.bulletSpeed;
-        bulletVel.y *= weapon.bulletSpeed;
+void Player::shoot(float age, float deltaTime) {
+    weapon.playFireSound();
+    muzzleFlashTimer = MUZZLE_FLASH_DURATION; // Activate muzzle flash
+    if (weapon.hitscan) return;
 
-        bullets.emplace_back(bulletOrigin, bulletVel, weapon.damage);
-        muzzleFlashTimer = MUZZLE_FLASH_DURATION; // Activate muzzle flash
-    }
+    // update() moves the bullet a whole step and only then tests it, so starting it back by the
+    // part of the step before the shot puts it exactly where its own flight time takes it
+    Vector2 bulletVel = Vector2Normalize(facing);
+    bulletVel.x *= weapon.bulletSpeed;
+    bulletVel.y *= weapon.bulletSpeed;
+    Vector2 bulletOrigin = Vector2Add(getMuzzlePosition(), Vector2Scale(bulletVel, age - deltaTime));
+
+    bullets.emplace_back(bulletOrigin, bulletVel, weapon.damage);
+    bullets.back().blastRadius = weapon.blastRadius;
+    bullets.back().fuse = weapon.fuse + (deltaTime - age);
+    bullets.back().launchDelay = deltaTime - age;
+}
+
+Vector2 Player::getMuzzlePosition() const {
+    return Vector2Add(pos, Vector2Scale(Vector2Normalize(facing), size * 0.8f));
 }
 
 void Player::takeDamage(float amount) {
@@ -171,6 +212,12 @@ void Player::updateMuzzleFlash(float deltaTime) {
     }
 }
 
+void Player::updateTracers(float deltaTime) {
+    for (Tracer& tracer : tracers) tracer.timer -= deltaTime;
+    tracers.erase(std::remove_if(tracers.begin(), tracers.end(),
+        [](const Tracer& t) { return t.timer <= 0; }), tracers.end());
+}
+
 void Player::updateDamageFlash(float deltaTime) {
     if (damageTakenFlashTimer > 0) {
         damageTakenFlashTimer -= deltaTime;
@@ -221,7 +268,7 @@ void Player::updateHealthRegen(float deltaTime) {
 
 // --- Private Helper Functions (for Drawing) ---
 
-void Player::drawStickman() const {
+void Player::drawStickman(Renderer& renderer) const {
     Color skinColor = LIGHTGRAY;
     Color bodyColor = GRAY;
     Color armLegColor = GRAY;
@@ -230,16 +277,16 @@ void Player::drawStickman() const {
     // Head
     float headRadius = size * 0.5f;
     Vector2 headCenter = { pos.x, pos.y - size * 0.8f };
-    DrawCircleV(headCenter, headRadius, skinColor);
+    renderer.drawCircle(headCenter, headRadius, skinColor);
 
     // Body (Thicker line for a more defined torso)
     Vector2 bodyTop = { pos.x, pos.y - size * 0.4f };
     Vector2 bodyBottom = { pos.x, pos.y + size * 0.3f };
-    DrawLineEx(bodyTop, bodyBottom, size * 0.8f, bodyColor);
+    renderer.drawLine(bodyTop, bodyBottom, size * 0.8f, bodyColor);
 
     // Player color tint if just took damage (visual feedback)
     if (damageTakenFlashTimer > 0) {
-        DrawCircleV(pos, size * 1.5f, ColorAlpha(RED, damageTakenFlashTimer / DAMAGE_FLASH_DURATION * 0.5f)); // Red tint
+        renderer.drawCircle(pos, size * 1.5f, ColorAlpha(RED, damageTakenFlashTimer / DAMAGE_FLASH_DURATION * 0.5f)); // Red tint
     }
     
     // Slight bobbing animation when not dashing
@@ -255,34 +302,34 @@ void Player::drawStickman() const {
     // Arms - Dynamic based on facing direction
     Vector2 rightHandOffset = Vector2Scale(Vector2Normalize(facing), size * 1.2f);
     Vector2 rightHand = Vector2Add(shoulder, rightHandOffset);
-    DrawLineEx(shoulder, rightHand, limbThickness, armLegColor);
+    renderer.drawLine(shoulder, rightHand, limbThickness, armLegColor);
 
     Vector2 leftHand;
     Vector2 perpFacing = { -facing.y, facing.x };
     leftHand = Vector2Add(shoulder, Vector2Scale(perpFacing, size * 0.8f));
-    DrawLineEx(shoulder, leftHand, limbThickness, armLegColor);
+    renderer.drawLine(shoulder, leftHand, limbThickness, armLegColor);
 
     // Legs - Simple fixed spread, creating a standing or slightly walking pose
     float legSpread = size * 0.4f;
     Vector2 leftFoot = { hip.x - legSpread, hip.y + size * 0.7f + bobOffset };
     Vector2 rightFoot = { hip.x + legSpread, hip.y + size * 0.7f + bobOffset };
 
-    DrawLineEx(hip, leftFoot, limbThickness, armLegColor);
-    DrawLineEx(hip, rightFoot, limbThickness, armLegColor);
+    renderer.drawLine(hip, leftFoot, limbThickness, armLegColor);
+    renderer.drawLine(hip, rightFoot, limbThickness, armLegColor);
 }
 
-void Player::drawHealthBar() const {
+void Player::drawHealthBar(Renderer& renderer) const {
     float barWidth = size * 2.0f;
     float barHeight = 6;
     float hpPercent = CLAMP(health / maxHealth, 0.0f, 1.0f);
     Vector2 barPos = { pos.x - barWidth / 2, pos.y - size * 1.8f };
 
-    DrawRectangle(barPos.x, barPos.y, barWidth, barHeight, DARKGRAY);
-    DrawRectangle(barPos.x, barPos.y, barWidth * hpPercent, barHeight, GREEN);
-    DrawRectangleLines(barPos.x, barPos.y, barWidth, barHeight, BLACK);
+    renderer.drawRectangle({ barPos.x, barPos.y, barWidth, barHeight }, DARKGRAY);
+    renderer.drawRectangle({ barPos.x, barPos.y, barWidth * hpPercent, barHeight }, GREEN);
+    renderer.drawRectangleLines({ barPos.x, barPos.y, barWidth, barHeight }, 1, BLACK);
 }
 
-void Player::drawMuzzleFlash() const {
+void Player::drawMuzzleFlash(Renderer& renderer) const {
     if (muzzleFlashTimer > 0) {
         // Muzzle position slightly ahead of the player's weapon's end
         Vector2 muzzlePos = Vector2Add(pos, Vector2Scale(Vector2Normalize(facing), size * 2.0f));
@@ -293,12 +340,21 @@ void Player::drawMuzzleFlash() const {
         Color flashColor = ColorAlpha(YELLOW, flashAlpha);
 
         // Draw a central glow and few lines
-        DrawCircleV(muzzlePos, flashRadius, flashColor);
-        DrawLineEx(Vector2Add(muzzlePos, Vector2Scale(Vector2Normalize(facing), -flashRadius * 0.5f)),
+        renderer.drawCircle(muzzlePos, flashRadius, flashColor);
+        renderer.drawLine(Vector2Add(muzzlePos, Vector2Scale(Vector2Normalize(facing), -flashRadius * 0.5f)),
                    Vector2Add(muzzlePos, Vector2Scale(Vector2Normalize(facing), flashRadius * 1.5f)), 2, flashColor);
         // Perpendicular lines for star effect
         Vector2 perpFacing = { -facing.y, facing.x };
-        DrawLineEx(Vector2Add(muzzlePos, Vector2Scale(perpFacing, -flashRadius * 0.5f)),
+        renderer.drawLine(Vector2Add(muzzlePos, Vector2Scale(perpFacing, -flashRadius * 0.5f)),
                    Vector2Add(muzzlePos, Vector2Scale(perpFacing, flashRadius * 0.5f)), 2, flashColor);
     }
 }
+
+void Player::drawTracers(Renderer& renderer) const {
+    for (const Tracer& tracer : tracers) {
+        float alpha = tracer.timer / TRACER_DURATION; // Fades from 1.0 to 0.0
+        renderer.drawLine(tracer.from, tracer.to, 6, ColorAlpha(SKYBLUE, alpha * 0.35f)); // Glow
+        renderer.drawLine(tracer.from, tracer.to, 2, ColorAlpha(WHITE, alpha));          // Core
+        renderer.drawCircle(tracer.to, 4.0f + (1.0f - alpha) * 6.0f, ColorAlpha(SKYBLUE, alpha * 0.6f)); // Impact
+    }
+}
@@ -4,8 +4,32 @@
 #include "Weapon.h"
 #include "Bullet.h"
 #include "Zombie.h" // Add this to use Zombie class
+#include "ZombieGrid.h"
 #include "raymath.h" // Needed for Vector2 operations in the header
 
+class Renderer;
+
+// Visual trail of a hitscan shot; the shot itself was resolved when it was fired
+struct Tracer {
+    Vector2 from;
+    Vector2 to;
+    float timer; // Counts down from Player::TRACER_DURATION
+};
+
+// A blast to resolve against the zombies (World::detonate)
+struct Explosion {
+    Vector2 center;
+    float radius;
+    int damage; // At the center; less towards the rim
+};
+
+// Damage to one of the floor's walls, applied by World::step after everything that tick has fired
+struct WallHit {
+    int wall;      // Index into the floor's walls
+    Vector2 point; // Where it struck; a wall that breaks is breached here
+    int damage;
+};
+
 class Player {
 public:
     Vector2 pos;
@@ -16,6 +40,9 @@ public:
 
     Weapon weapon;
     std::vector<Bullet> bullets;
+    std::vector<Tracer> tracers; // Visual only: not part of checksums or checkpoints
+    std::vector<Explosion> detonations; // Explosive rounds that went off in update(); World::step resolves and clears them
+    std::vector<WallHit> wallHits;      // Bullets stopped by walls in update(); likewise
 
     // --- New Features & State Variables (All public as requested) ---
     float invulnerabilityTimer; // Time player is invulnerable after taking damage
@@ -34,6 +61,7 @@ public:
     // --- Constants (static const float for class-wide constants) ---
     static const float INVULNERABILITY_DURATION;
     static const float MUZZLE_FLASH_DURATION;
+    static const float TRACER_DURATION;
     static const float DASH_DURATION;
     static const float DASH_SPEED_MULTIPLIER;
     static const float REGEN_COOLDOWN; // Time before regen starts after damage
@@ -43,9 +71,20 @@ public:
 
     Player(Vector2 startPos, Vector2 startFacing, float size, int health, Weapon && weapon);
 
-    void update(float deltaTime, std::vector<Zombie>& zombies, const std::vector<Rectangle>& walls);
-    void draw() const; // Made const correctly
-    void shoot(float currentTime);
+    // 'worldSize' bounds the play area: bullets leaving it are dropped. Bullets hit the first zombie
+    // along the path they fly this step, found through 'zombieGrid' (an index of 'zombies' whose
+    // positions are current; zombies appended since it was built are tested directly).
+    void update(float deltaTime, ZombieList& zombies, const ZombieGrid& zombieGrid, const WallList& walls, Vector2 worldSize);
+    void draw(Renderer& renderer) const; // Made const correctly
+    // Fires one shot that left the gun 'age' seconds before the end of the current step of
+    // 'deltaTime' (the weapon's timing is decided by Weapon::pullTrigger). Projectile weapons spawn
+    // their bullet here, set back along its path so that update() leaves it 'age' seconds of flight
+    // past the muzzle; a hitscan shot is left to the caller (World), which resolves it along a ray
+    // and adds the tracer.
+    void shoot(float age, float deltaTime);
+
+    // Where bullets leave the gun: slightly ahead of the player in the facing direction
+    Vector2 getMuzzlePosition() const;
 
     // New: centralized damage taking function
     void takeDamage(float amount);
@@ -57,13 +96,15 @@ private:
     // --- Private Helper Functions (for internal logic and drawing details) ---
     void updateInvulnerability(float deltaTime);
     void updateMuzzleFlash(float deltaTime);
+    void updateTracers(float deltaTime);
     void updateDamageFlash(float deltaTime);
     void updateDash(float deltaTime); // Handles dash movement and timer
     void updateHealthRegen(float deltaTime); // Handles health regeneration
 
     // Drawing helpers
-    void drawStickman() const;
-    void drawHealthBar() const; // The health bar above player, not the HUD one
-    void drawMuzzleFlash() const;
-    void drawDashTrail() const; // Optional: For visual flair during dash
+    void drawStickman(Renderer& renderer) const;
+    void drawHealthBar(Renderer& renderer) const; // The health bar above player, not the HUD one
+    void drawMuzzleFlash(Renderer& renderer) const;
+    void drawTracers(Renderer& renderer) const;
+    void drawDashTrail(Renderer& renderer) const; // Optional: For visual flair during dash
 };
\ No newline at end of file
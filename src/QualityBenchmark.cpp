@@ -0,0 +1,237 @@
+// QualityBenchmark.cpp
+// Quality governor check. Runs the governor over synthetic frame-time traces, where each tier
+// makes frames cheaper by a fixed amount, and checks that:
+//   - a sustained overload steps down to the first tier that fits the budget and stays there,
+//   - a load sitting right on a tier boundary is held off by the upgrade backoff instead of
+//     flipping tiers every few seconds,
+//   - the tiers come back once the load goes away,
+//   - short hitches (single slow frames, a few in a row) never change the tier.
+// Then reports what each tier saves: primitives and vertices per zombie (live and dying, through
+// NullRenderer), the floor and walls drawn with and without shading, and the World::step cost of
+// a horde with far zombies updated every tick and every other tick. Exits 1 if a trace check
+// fails or a lower tier draws more than the one above it.
+//
+// Usage: quality_bench [zombies=5000] [frames=600] [seed=1]
+
+#include "raylib.h"
+#include "QualityGovernor.h"
+#include "Renderer.h"
+#include "FloorLayer.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "ZombieTypes.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+struct TraceResult {
+    QualityTier finalTier;
+    int changes;
+    float lastChangeAt; // Seconds into the trace
+    float overBudgetSeconds;
+};
+
+// Feeds 'seconds' of frames costing costMs[tier] (plus 'hitchMs' on frames where hitch(t) says so)
+// to the governor; frames never finish faster than vsync
+template <typename Hitch>
+static TraceResult RunTrace(QualityGovernor& governor, const float (&costMs)[QUALITY_TIER_COUNT], float seconds, Hitch hitch) {
+    TraceResult result = { governor.getTier(), 0, 0.0f, 0.0f };
+    float t = 0.0f;
+    int frame = 0;
+    while (t < seconds) {
+        float ms = costMs[(int)governor.getTier()] + hitch(frame);
+        float dt = std::max(ms, governor.getBudgetMs()) / 1000.0f;
+        if (ms > governor.getBudgetMs()) result.overBudgetSeconds += dt;
+        if (governor.update(ms, dt)) {
+            result.changes++;
+            result.lastChangeAt = t;
+        }
+        t += dt;
+        frame++;
+    }
+    result.finalTier = governor.getTier();
+    return result;
+}
+
+static float NoHitch(int) { return 0.0f; }
+
+static bool Check(bool ok, const char* what) {
+    printf("  %-58s %s\n", what, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// Per-zombie draw cost of every archetype in its costliest look, alive or dying
+static NullRenderer::FrameCounts ZombieCost(NullRenderer& renderer, const std::vector<Zombie>& zombies, ZombieDetail detail) {
+    ZombieBatches batches;
+    batches.build(zombies.data(), (int)zombies.size());
+    renderer.beginFrame();
+    batches.draw(renderer, zombies.data(), detail);
+    return renderer.getCounts();
+}
+
+static std::vector<Zombie> MakeZombies(int count, bool dying) {
+    std::vector<Zombie> zombies;
+    zombies.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        zombies.push_back(MakeZombie((ZombieKind)(i % ZOMBIE_KIND_COUNT), { (float)(i % 40) * 30.0f, (float)(i / 40) * 30.0f }));
+        Zombie& zombie = zombies.back();
+        if (dying) {
+            zombie.currentState = Zombie::ZombieState::DYING;
+            zombie.explosionRadius = Zombie::ZOMBIE_EXPLOSION_MAX_RADIUS / 2;
+            zombie.explosionAlpha = 0.5f;
+        } else if (zombie.kind == ZombieKind::Exploder) {
+            zombie.action = Zombie::Action::FUSE;
+            zombie.actionTimer = ExploderZombie::FUSE_TIME / 2;
+        }
+    }
+    return zombies;
+}
+
+// Mean World::step cost over 'frames' steps of a horde with the given far-zombie stride
+static double StepCost(int zombieCount, int frames, uint64_t seed, int stride, int& zombiesOut, int& farOut) {
+    World world(1200.0f, 800.0f);
+    world.start(CreatePistol(), seed);
+    world.setHordeMode(true);
+    world.waveDirector.setConfig(WaveConfig::Horde(zombieCount));
+    world.floor.zombies.reserve(zombieCount);
+
+    PlayerInput input = { { 0, 0 }, { world.width, world.height / 2 }, false, false };
+    for (int i = 0; i < 2400 && (int)world.floor.zombies.size() < zombieCount; ++i) {
+        world.player.health = world.player.maxHealth;
+        world.step(TICK_SECONDS, input);
+    }
+
+    world.farZombieUpdateStride = stride;
+    double totalMs = 0.0;
+    long long far = 0;
+    for (int f = 0; f < frames; ++f) {
+        world.player.health = world.player.maxHealth;
+        for (const Zombie& zombie : world.floor.zombies) {
+            if (Vector2DistanceSqr(zombie.pos, world.player.pos) > FAR_UPDATE_DISTANCE * FAR_UPDATE_DISTANCE) far++;
+        }
+        auto start = Clock::now();
+        world.step(TICK_SECONDS, input);
+        totalMs += ElapsedMs(start);
+    }
+    zombiesOut = (int)world.floor.zombies.size();
+    farOut = (int)(far / frames);
+    return totalMs / frames;
+}
+
+int main(int argc, char** argv) {
+    int zombieCount = argc > 1 ? atoi(argv[1]) : 5000;
+    int frames = argc > 2 ? atoi(argv[2]) : 600;
+    uint64_t seed = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1;
+    if (zombieCount < 1) zombieCount = 1;
+    if (frames < 1) frames = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+    bool ok = true;
+
+    // --- Governor traces ---
+    printf("Governor (budget %.1f ms):\n", QualityGovernor().getBudgetMs());
+    {
+        // A horde twice the budget at full quality; LOW is the first tier that fits
+        QualityGovernor governor;
+        const float cost[QUALITY_TIER_COUNT] = { 30.0f, 22.0f, 14.0f, 11.0f };
+        TraceResult r = RunTrace(governor, cost, 60.0f, NoHitch);
+        printf("  Overload:  settled on %s after %.1f s, %d changes, %.1f s over budget in 60 s\n",
+               QualityTierName(r.finalTier), r.lastChangeAt, r.changes, r.overBudgetSeconds);
+        ok &= Check(r.finalTier == QualityTier::Low && r.changes == 2 && r.lastChangeAt < 3.0f,
+                    "overload steps down to the first tier that fits, once");
+    }
+    {
+        // FULL is just over the budget, REDUCED comfortably under: without the backoff it would
+        // flip every few seconds forever
+        QualityGovernor governor;
+        const float cost[QUALITY_TIER_COUNT] = { 18.0f, 10.0f, 9.0f, 8.0f };
+        TraceResult r = RunTrace(governor, cost, 600.0f, NoHitch);
+        int unbounded = (int)(600.0f / (QualityGovernor::Config().upgradeHold + QualityGovernor::Config().downgradeHold)) * 2;
+        printf("  Boundary:  %d changes in 10 min (%d without backoff), upgrade hold now %.0f s, %.1f s over budget\n",
+               r.changes, unbounded, governor.getUpgradeHold(), r.overBudgetSeconds);
+        ok &= Check(r.changes <= 32 && governor.getUpgradeHold() >= QualityGovernor::Config().maxUpgradeHold,
+                    "a load on a tier boundary backs off to the cheaper tier");
+    }
+    {
+        // The horde dies down: everything fits again
+        QualityGovernor governor;
+        const float heavy[QUALITY_TIER_COUNT] = { 40.0f, 35.0f, 30.0f, 25.0f };
+        const float light[QUALITY_TIER_COUNT] = { 8.0f, 7.0f, 6.0f, 5.0f };
+        RunTrace(governor, heavy, 10.0f, NoHitch);
+        QualityTier worst = governor.getTier();
+        TraceResult r = RunTrace(governor, light, 30.0f, NoHitch);
+        printf("  Recovery:  %s under load, back to %s %.1f s after it ended\n", QualityTierName(worst),
+               QualityTierName(r.finalTier), r.lastChangeAt);
+        ok &= Check(worst == QualityTier::Minimal && r.finalTier == QualityTier::Full, "tiers come back when the load goes");
+    }
+    {
+        // Cheap frames with a 100 ms hitch every 2 s and three in a row every 10 s
+        QualityGovernor governor;
+        const float cost[QUALITY_TIER_COUNT] = { 8.0f, 7.0f, 6.0f, 5.0f };
+        TraceResult r = RunTrace(governor, cost, 120.0f, [](int frame) {
+            if (frame % 600 < 3) return 100.0f;
+            return frame % 120 == 0 ? 100.0f : 0.0f;
+        });
+        printf("  Hitches:   %d changes in 2 min\n", r.changes);
+        ok &= Check(r.changes == 0, "hitches never change the tier");
+    }
+
+    // --- Draw cost per tier ---
+    NullRenderer renderer;
+    std::vector<Zombie> live = MakeZombies(1000, false);
+    std::vector<Zombie> dying = MakeZombies(1000, true);
+    const ZombieDetail details[3] = { ZombieDetail::Full, ZombieDetail::Reduced, ZombieDetail::Silhouette };
+    const char* detailNames[3] = { "full", "reduced", "silhouette" };
+    printf("Zombie draw cost per zombie (primitives / vertices):\n");
+    int lastLive = 1 << 30, lastDying = 1 << 30;
+    bool cheaper = true;
+    for (int d = 0; d < 3; ++d) {
+        NullRenderer::FrameCounts a = ZombieCost(renderer, live, details[d]);
+        NullRenderer::FrameCounts b = ZombieCost(renderer, dying, details[d]);
+        printf("  %-11s live %6.2f / %7.1f   dying %6.2f / %7.1f\n", detailNames[d], (float)a.primitives / live.size(),
+               (float)a.vertices / live.size(), (float)b.primitives / dying.size(), (float)b.vertices / dying.size());
+        cheaper &= d == 0 || (a.vertices < lastLive && b.vertices < lastDying);
+        lastLive = a.vertices;
+        lastDying = b.vertices;
+    }
+
+    World world(1200.0f, 800.0f);
+    world.start(CreatePistol(), seed);
+    FloorLayer floorLayer(1200, 800); // Immediate mode: NullRenderer has no GPU
+    int shaded = 0, flat = 0;
+    for (int pass = 0; pass < 2; ++pass) {
+        floorLayer.setShading(pass == 0);
+        renderer.beginFrame();
+        floorLayer.draw(renderer);
+        floorLayer.drawWalls(renderer, world.floor);
+        (pass == 0 ? shaded : flat) = renderer.getCounts().primitives;
+    }
+    printf("Floor and %d walls: %d primitives shaded, %d without shadows and vignette (baked once per change on GPU)\n",
+           (int)world.floor.walls.size(), shaded, flat);
+    ok &= Check(cheaper && flat < shaded, "every lower tier draws less than the one above");
+
+    // --- Far-zombie update stride ---
+    int zombies1 = 0, far1 = 0, zombies2 = 0, far2 = 0;
+    double every = StepCost(zombieCount, frames, seed, 1, zombies1, far1);
+    double half = StepCost(zombieCount, frames, seed, 2, zombies2, far2);
+    printf("World::step, %d zombies (%d beyond %.0f px), %d frames:\n", zombies1, far1, FAR_UPDATE_DISTANCE, frames);
+    printf("  Every tick:       %7.3f ms\n", every);
+    printf("  Far every other:  %7.3f ms (%.0f%%)\n", half, every > 0.0 ? half / every * 100.0 : 0.0);
+
+    if (!ok) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "QualityGovernor.h"
+#include <algorithm>
+
+const char* QualityTierName(QualityTier tier) {
+    switch (tier) {
+        case QualityTier::Full: return "FULL";
+        case QualityTier::Reduced: return "REDUCED";
+        case QualityTier::Low: return "LOW";
+        case QualityTier::Minimal: return "MINIMAL";
+    }
+    return "?";
+}
+
+QualitySettings QualitySettings::ForTier(QualityTier tier) {
+    switch (tier) {
+        case QualityTier::Full: return { ZombieDetail::Full, true, true, 1 };
+        case QualityTier::Reduced: return { ZombieDetail::Reduced, false, true, 1 };
+        case QualityTier::Low: return { ZombieDetail::Silhouette, false, false, 1 };
+        case QualityTier::Minimal: return { ZombieDetail::Silhouette, false, false, 2 };
+    }
+    return { ZombieDetail::Full, true, true, 1 };
+}
+
+QualityGovernor::QualityGovernor(const Config& config)
+    : config(config), tier(QualityTier::Full), locked(false), smoothedMs(0.0f), overSeconds(0.0f),
+      underSeconds(0.0f), upgradeHold(config.upgradeHold), sinceUpgrade(0.0f), onProbation(false), changes(0) {}
+
+void QualityGovernor::lock(QualityTier lockedTier) {
+    locked = true;
+    tier = lockedTier;
+    overSeconds = underSeconds = 0.0f;
+    onProbation = false;
+}
+
+void QualityGovernor::unlock() {
+    locked = false;
+}
+
+void QualityGovernor::setTier(QualityTier newTier) {
+    tier = newTier;
+    overSeconds = underSeconds = 0.0f; // The average has to show the new tier's cost before the next step
+    changes++;
+}
+
+bool QualityGovernor::update(float frameMs, float deltaSeconds) {
+    // A hitch (loading, a dragged window) counts as a bad frame, not as several seconds of them
+    float sample = std::min(frameMs, 4.0f * config.budgetMs);
+    deltaSeconds = std::min(deltaSeconds, 4.0f * config.budgetMs / 1000.0f);
+    smoothedMs += config.smoothing * (sample - smoothedMs); // From 0, so a slow first frame isn't the whole average
+    if (locked) return false;
+
+    if (onProbation) {
+        sinceUpgrade += deltaSeconds;
+        if (sinceUpgrade >= config.probation) {
+            upgradeHold = std::max(upgradeHold * 0.5f, config.upgradeHold); // It held: restore faster next time
+            onProbation = false;
+        }
+    }
+
+    if (smoothedMs > config.budgetMs * config.downgradeAbove) {
+        overSeconds += deltaSeconds;
+        underSeconds = 0.0f;
+    } else if (smoothedMs < config.budgetMs * config.upgradeBelow) {
+        underSeconds += deltaSeconds;
+        overSeconds = 0.0f;
+    } else {
+        overSeconds = underSeconds = 0.0f;
+    }
+
+    if (overSeconds >= config.downgradeHold && tier != QualityTier::Minimal) {
+        if (onProbation) upgradeHold = std::min(upgradeHold * 2.0f, config.maxUpgradeHold); // Restored too soon
+        onProbation = false;
+        setTier((QualityTier)((int)tier + 1));
+        return true;
+    }
+    if (underSeconds >= upgradeHold && tier != QualityTier::Full) {
+        onProbation = true;
+        sinceUpgrade = 0.0f;
+        setTier((QualityTier)((int)tier - 1));
+        return true;
+    }
+    return false;
+}
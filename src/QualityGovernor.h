@@ -0,0 +1,76 @@
+#pragma once
+#include "Zombie.h" // ZombieDetail
+#include <cstdint>
+
+// Rendering and simulation quality, from everything on down to what still holds 60 FPS under a
+// full horde on a low-end laptop or in a mobile browser
+enum class QualityTier : uint8_t {
+    Full,
+    Reduced, // Lighter death bursts and blast flashes
+    Low,     // Zombie silhouettes; no wall shadows or floor vignette
+    Minimal  // Low, and far zombies update every other tick
+};
+constexpr int QUALITY_TIER_COUNT = 4;
+
+const char* QualityTierName(QualityTier tier);
+
+// What a tier turns on; the game applies these every frame
+struct QualitySettings {
+    ZombieDetail zombieDetail;
+    bool explosionDetail;       // Blast flashes with their hot core; otherwise one fading disc
+    bool floorShading;          // FloorLayer::setShading
+    int farZombieUpdateStride;  // World::farZombieUpdateStride
+
+    static QualitySettings ForTier(QualityTier tier);
+};
+
+// Steps the quality tier down when a smoothed frame time stays over the budget, and back up when
+// it has stayed well under for a while. The gap between the two thresholds and the hold times
+// keep it from flickering between tiers; on top of that, a tier that gets dropped again soon
+// after being restored doubles the time it takes to try restoring it next (up to maxUpgradeHold),
+// so a load that sits right on a tier boundary settles on the cheaper tier instead of cycling.
+class QualityGovernor {
+public:
+    struct Config {
+        float budgetMs = 1000.0f / 60.0f;
+        float smoothing = 0.05f;      // Weight of each new sample in the moving average (~20 frames)
+        float downgradeAbove = 1.0f;  // Fraction of the budget the average must exceed ...
+        float downgradeHold = 0.5f;   // ... for this many seconds to drop a tier
+        float upgradeBelow = 0.7f;    // Fraction of the budget the average must stay under ...
+        float upgradeHold = 3.0f;     // ... for this many seconds to restore a tier (the starting backoff)
+        float maxUpgradeHold = 48.0f;
+        float probation = 5.0f;       // A restored tier that lasts this long resets the backoff one step
+    };
+
+    QualityGovernor() : QualityGovernor(Config()) {}
+    explicit QualityGovernor(const Config& config);
+
+    // Feeds one frame: its cost in ms and the time it covered in seconds. Returns true if the tier changed.
+    bool update(float frameMs, float deltaSeconds);
+
+    // Pins a tier (the overlay's manual override); update() keeps averaging but stops changing it
+    void lock(QualityTier tier);
+    void unlock();
+    bool isLocked() const { return locked; }
+
+    QualityTier getTier() const { return tier; }
+    QualitySettings getSettings() const { return QualitySettings::ForTier(tier); }
+    float getSmoothedMs() const { return smoothedMs; }
+    float getBudgetMs() const { return config.budgetMs; }
+    float getUpgradeHold() const { return upgradeHold; } // Current backoff
+    int getChanges() const { return changes; }           // Tier changes made by update()
+
+private:
+    Config config;
+    QualityTier tier;
+    bool locked;
+    float smoothedMs;
+    float overSeconds;    // How long the average has been over the downgrade threshold
+    float underSeconds;   // ... and under the upgrade threshold
+    float upgradeHold;
+    float sinceUpgrade;   // Seconds since the last upgrade, while it is on probation
+    bool onProbation;
+    int changes;
+
+    void setTier(QualityTier newTier);
+};
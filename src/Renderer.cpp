@@ -0,0 +1,174 @@
+#include "Renderer.h"
+
+// --- RaylibRenderer ---
+
+void RaylibRenderer::clearBackground(Color color) {
+    ClearBackground(color);
+}
+
+void RaylibRenderer::drawLine(Vector2 start, Vector2 end, float thick, Color color) {
+    // Hairlines go through GL lines, thicker ones are expanded to quads by raylib
+    if (thick <= 1.0f) DrawLineV(start, end, color);
+    else DrawLineEx(start, end, thick, color);
+}
+
+void RaylibRenderer::drawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    DrawTriangle(v1, v2, v3, color);
+}
+
+void RaylibRenderer::drawCircle(Vector2 center, float radius, Color color) {
+    DrawCircleV(center, radius, color);
+}
+
+void RaylibRenderer::drawCircleLines(Vector2 center, float radius, Color color) {
+    DrawCircleLines((int)center.x, (int)center.y, radius, color);
+}
+
+void RaylibRenderer::drawEllipse(Vector2 center, float radiusH, float radiusV, Color color) {
+    DrawEllipse((int)center.x, (int)center.y, radiusH, radiusV, color);
+}
+
+void RaylibRenderer::drawRectangle(Rectangle rec, Color color) {
+    DrawRectangleRec(rec, color);
+}
+
+void RaylibRenderer::drawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color) {
+    DrawRectanglePro(rec, origin, rotation, color);
+}
+
+void RaylibRenderer::drawRectangleLines(Rectangle rec, float lineThick, Color color) {
+    DrawRectangleLinesEx(rec, lineThick, color);
+}
+
+void RaylibRenderer::drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) {
+    DrawRectangleRounded(rec, roundness, segments, color);
+}
+
+void RaylibRenderer::drawRectangleRoundedLines(Rectangle rec, float roundness, int segments, Color color) {
+    DrawRectangleRoundedLines(rec, roundness, segments, color);
+}
+
+void RaylibRenderer::drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// --- NullRenderer ---
+// Vertex costs mirror raylib 5's default tessellation (quads draw mode, 36-segment circles)
+
+static const int CIRCLE_SEGMENTS = 36;
+
+const int NullRenderer::DESKTOP_BATCH_QUADS = 8192; // RL_DEFAULT_BATCH_BUFFER_ELEMENTS
+const int NullRenderer::WEB_BATCH_QUADS = 2048;
+const int NullRenderer::BATCH_DRAW_CALLS = 256;     // RL_DEFAULT_BATCH_DRAWCALLS
+
+NullRenderer::NullRenderer(int batchQuads) : batchQuads(batchQuads) {
+    beginFrame();
+}
+
+void NullRenderer::beginFrame() {
+    counts.primitives = 0;
+    counts.vertices = 0;
+    counts.drawCalls = 0;
+    counts.batchFlushes = 0;
+    for (int i = 0; i < PRIMITIVE_KIND_COUNT; ++i) counts.byKind[i] = 0;
+    // The previous frame's EndDrawing flushed the batch
+    callOpen = false;
+    callMode = DrawMode::QUADS;
+    callTexture = SHAPES_TEXTURE;
+    batchVertices = 0;
+    batchCalls = 0;
+}
+
+void NullRenderer::record(PrimitiveKind kind, int vertices, DrawMode mode, unsigned int texture) {
+    counts.primitives++;
+    counts.vertices += vertices;
+    counts.byKind[kind]++;
+    if (kind == CLEAR) return; // A glClear, not part of the batch
+
+    // A full vertex buffer is drawn and emptied; the next primitive starts a call in a fresh batch
+    if (batchVertices + vertices > batchQuads * 4) {
+        if (callOpen) counts.batchFlushes++;
+        callOpen = false;
+        batchVertices = 0;
+        batchCalls = 0;
+    }
+    if (!callOpen || mode != callMode || texture != callTexture) {
+        if (batchCalls == BATCH_DRAW_CALLS) { // Out of call slots: flushed the same way
+            counts.batchFlushes++;
+            batchVertices = 0;
+            batchCalls = 0;
+        }
+        callOpen = true;
+        callMode = mode;
+        callTexture = texture;
+        batchCalls++;
+        counts.drawCalls++;
+    }
+    batchVertices += vertices;
+}
+
+const char* NullRenderer::getKindName(PrimitiveKind kind) {
+    switch (kind) {
+        case CLEAR: return "clear";
+        case LINE: return "line";
+        case TRIANGLE: return "triangle";
+        case CIRCLE: return "circle";
+        case CIRCLE_LINES: return "circle_lines";
+        case ELLIPSE: return "ellipse";
+        case RECTANGLE: return "rectangle";
+        case RECTANGLE_LINES: return "rectangle_lines";
+        case RECTANGLE_ROUNDED: return "rectangle_rounded";
+        case RECTANGLE_ROUNDED_LINES: return "rectangle_rounded_lines";
+        case TEXTURE_QUAD: return "texture_quad";
+        default: return "unknown";
+    }
+}
+
+void NullRenderer::clearBackground(Color /*color*/) {
+    record(CLEAR, 0);
+}
+
+void NullRenderer::drawLine(Vector2 /*start*/, Vector2 /*end*/, float thick, Color /*color*/) {
+    if (thick <= 1.0f) record(LINE, 2, DrawMode::LINES); // GL line pair
+    else record(LINE, 6, DrawMode::TRIANGLES);           // Two triangles
+}
+
+void NullRenderer::drawTriangle(Vector2 /*v1*/, Vector2 /*v2*/, Vector2 /*v3*/, Color /*color*/) {
+    record(TRIANGLE, 4); // Emitted as a degenerate quad
+}
+
+void NullRenderer::drawCircle(Vector2 /*center*/, float /*radius*/, Color /*color*/) {
+    record(CIRCLE, (CIRCLE_SEGMENTS / 2) * 4); // Two sectors per quad
+}
+
+void NullRenderer::drawCircleLines(Vector2 /*center*/, float /*radius*/, Color /*color*/) {
+    record(CIRCLE_LINES, CIRCLE_SEGMENTS * 2, DrawMode::LINES);
+}
+
+void NullRenderer::drawEllipse(Vector2 /*center*/, float /*radiusH*/, float /*radiusV*/, Color /*color*/) {
+    record(ELLIPSE, CIRCLE_SEGMENTS * 3, DrawMode::TRIANGLES); // Triangle fan expanded to a list
+}
+
+void NullRenderer::drawRectangle(Rectangle /*rec*/, Color /*color*/) {
+    record(RECTANGLE, 4);
+}
+
+void NullRenderer::drawRectanglePro(Rectangle /*rec*/, Vector2 /*origin*/, float /*rotation*/, Color /*color*/) {
+    record(RECTANGLE, 4);
+}
+
+void NullRenderer::drawRectangleLines(Rectangle /*rec*/, float /*lineThick*/, Color /*color*/) {
+    record(RECTANGLE_LINES, 4 * 4); // Four thin rectangles
+}
+
+void NullRenderer::drawRectangleRounded(Rectangle /*rec*/, float /*roundness*/, int segments, Color /*color*/) {
+    record(RECTANGLE_ROUNDED, (4 * segments + 5) * 4); // Corner fans + center/side quads
+}
+
+void NullRenderer::drawRectangleRoundedLines(Rectangle /*rec*/, float /*roundness*/, int segments, Color /*color*/) {
+    record(RECTANGLE_ROUNDED_LINES, (4 * segments + 4) * 2, DrawMode::LINES); // Corner arcs + straight sides as lines
+}
+
+void NullRenderer::drawTexturePro(Texture2D texture, Rectangle /*source*/, Rectangle /*dest*/, Vector2 /*origin*/, float /*rotation*/, Color /*tint*/) {
+    record(TEXTURE_QUAD, 4, DrawMode::QUADS, texture.id);
+}
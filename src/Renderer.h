@@ -0,0 +1,122 @@
+#pragma once
+#include "raylib.h"
+
+// Thin render-command interface used by every gameplay draw function
+// (Zombie, Player, Weapon, BulletRenderer, HudLayer, walls/floor).
+// RaylibRenderer forwards to raylib; NullRenderer draws nothing and only
+// counts primitives/vertices, so draw workload can be measured headless.
+class Renderer {
+public:
+    virtual ~Renderer() = default;
+
+    virtual void clearBackground(Color color) = 0;
+
+    virtual void drawLine(Vector2 start, Vector2 end, float thick, Color color) = 0;
+    virtual void drawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) = 0;
+    virtual void drawCircle(Vector2 center, float radius, Color color) = 0;
+    virtual void drawCircleLines(Vector2 center, float radius, Color color) = 0;
+    virtual void drawEllipse(Vector2 center, float radiusH, float radiusV, Color color) = 0;
+    virtual void drawRectangle(Rectangle rec, Color color) = 0;
+    virtual void drawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color) = 0;
+    virtual void drawRectangleLines(Rectangle rec, float lineThick, Color color) = 0;
+    virtual void drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) = 0;
+    virtual void drawRectangleRoundedLines(Rectangle rec, float roundness, int segments, Color color) = 0;
+    virtual void drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) = 0;
+
+    // False for backends without a GL context: callers skip texture baking (render targets, atlases)
+    virtual bool usesGpu() const = 0;
+};
+
+// Immediate-mode raylib backend used by the game
+class RaylibRenderer : public Renderer {
+public:
+    void clearBackground(Color color) override;
+
+    void drawLine(Vector2 start, Vector2 end, float thick, Color color) override;
+    void drawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) override;
+    void drawCircle(Vector2 center, float radius, Color color) override;
+    void drawCircleLines(Vector2 center, float radius, Color color) override;
+    void drawEllipse(Vector2 center, float radiusH, float radiusV, Color color) override;
+    void drawRectangle(Rectangle rec, Color color) override;
+    void drawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color) override;
+    void drawRectangleLines(Rectangle rec, float lineThick, Color color) override;
+    void drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override;
+    void drawRectangleRoundedLines(Rectangle rec, float roundness, int segments, Color color) override;
+    void drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+
+    bool usesGpu() const override { return true; }
+};
+
+// Headless backend: counts primitives and the vertices raylib would have emitted for them, and
+// estimates the draw calls raylib's batch would have split them into: a new call whenever the draw
+// mode (quads, triangles, lines) or texture changes, and a flush whenever the batch's vertex buffer
+// ('batchQuads' quads) or its BATCH_DRAW_CALLS call slots run out
+class NullRenderer : public Renderer {
+public:
+    enum PrimitiveKind {
+        CLEAR,
+        LINE,
+        TRIANGLE,
+        CIRCLE,
+        CIRCLE_LINES,
+        ELLIPSE,
+        RECTANGLE,
+        RECTANGLE_LINES,
+        RECTANGLE_ROUNDED,
+        RECTANGLE_ROUNDED_LINES,
+        TEXTURE_QUAD,
+        PRIMITIVE_KIND_COUNT
+    };
+
+    struct FrameCounts {
+        int primitives;
+        int vertices;
+        int drawCalls;
+        int batchFlushes; // Draw calls forced by a full batch rather than a state change
+        int byKind[PRIMITIVE_KIND_COUNT];
+    };
+
+    // raylib 5's default render batch: quads per vertex buffer on desktop GL and on OpenGL ES/WebGL
+    static const int DESKTOP_BATCH_QUADS;
+    static const int WEB_BATCH_QUADS;
+    static const int BATCH_DRAW_CALLS;
+
+    explicit NullRenderer(int batchQuads = DESKTOP_BATCH_QUADS);
+
+    // Resets the per-frame counters
+    void beginFrame();
+    const FrameCounts& getCounts() const { return counts; }
+    static const char* getKindName(PrimitiveKind kind);
+
+    void clearBackground(Color color) override;
+
+    void drawLine(Vector2 start, Vector2 end, float thick, Color color) override;
+    void drawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) override;
+    void drawCircle(Vector2 center, float radius, Color color) override;
+    void drawCircleLines(Vector2 center, float radius, Color color) override;
+    void drawEllipse(Vector2 center, float radiusH, float radiusV, Color color) override;
+    void drawRectangle(Rectangle rec, Color color) override;
+    void drawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color) override;
+    void drawRectangleLines(Rectangle rec, float lineThick, Color color) override;
+    void drawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override;
+    void drawRectangleRoundedLines(Rectangle rec, float roundness, int segments, Color color) override;
+    void drawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+
+    bool usesGpu() const override { return false; }
+
+private:
+    enum class DrawMode { LINES, TRIANGLES, QUADS };
+
+    FrameCounts counts;
+    int batchQuads;
+    // The batch as raylib would hold it: the current call's state, and what the batch has used
+    bool callOpen;
+    DrawMode callMode;
+    unsigned int callTexture;
+    int batchVertices;
+    int batchCalls;
+
+    // Shapes are drawn with raylib's default white texture, which no Texture2D passed in can be
+    static const unsigned int SHAPES_TEXTURE = 0xFFFFFFFFu;
+    void record(PrimitiveKind kind, int vertices, DrawMode mode = DrawMode::QUADS, unsigned int texture = SHAPES_TEXTURE);
+};
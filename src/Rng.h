@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+
+// Small deterministic PRNG (SplitMix64) owned by the simulation. Unlike raylib's
+// GetRandomValue (C library rand()), its whole state is one integer, so a run is
+// reproducible from its seed, independent per World, and trivially snapshotted.
+class Rng {
+public:
+    explicit Rng(uint64_t seed = 0x9E3779B97F4A7C15ull) : state(seed) {}
+
+    void seed(uint64_t newSeed) { state = newSeed; }
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Inclusive range, same contract as GetRandomValue
+    int range(int min, int max) {
+        if (min > max) { int t = min; min = max; max = t; }
+        uint64_t span = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+        return min + (int)(next() % span);
+    }
+
+    uint64_t state;
+};
@@ -0,0 +1,167 @@
+// ServerMain.cpp
+// Headless authoritative server: hosts many independent game sessions in one process, stepping
+// every World at a fixed tick and exchanging INPUT/STATE datagrams with the clients over UDP.
+// Prints a report every few seconds: live sessions, server tick cost, per-session step cost,
+// traffic and per-session memory.
+//
+// With --clients N it also runs N scripted clients in the same process, connected over
+// 127.0.0.1 through real sockets, then exits after --seconds: a self-contained loopback test.
+//
+// Telemetry: with --metrics-file the tick/step histograms, traffic, live population and heap
+// allocation counts are appended to a rolling file in Prometheus text format; with --metrics-port
+// they are also served at http://127.0.0.1:<port>/metrics for a local scraper.
+//
+// Usage: zombie_server [--port <port>] [--max-sessions <n>] [--clients <n>] [--seconds <s>]
+//                      [--report-interval <s>] [--metrics-file <path>] [--metrics-port <port>]
+//                      [--metrics-interval <s>]
+
+#include "raylib.h"
+#include "GameServer.h"
+#include "NetClient.h"
+#include "Metrics.h"
+#include "MetricsEndpoint.h"
+#include "HeapCounter.h"
+#include "raymath.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Loopback client input: circle the arena center, aim at the nearest zombie the server sent, keep firing
+static PlayerInput LoopbackAutopilot(const NetClient& client, uint64_t frame, int clientIndex) {
+    PlayerInput input = { { 0, 0 }, { 0, 0 }, true, false };
+    const NetWorldState& state = client.getState();
+
+    static const Vector2 corners[4] = { { -150, -150 }, { 150, -150 }, { 150, 150 }, { -150, 150 } };
+    Vector2 corner = corners[((frame + clientIndex * 23) / 90) % 4];
+    input.move = Vector2Subtract({ 600 + corner.x, 400 + corner.y }, state.playerPos);
+
+    input.aim = Vector2Add(state.playerPos, state.playerFacing);
+    if (state.zombiesSent > 0) input.aim = state.zombies[0].pos; // Sent nearest first
+    input.dash = (frame + clientIndex) % 120 == 0;
+    return input;
+}
+
+static void PrintReport(const GameServer::Stats& stats, double seconds) {
+    double ticks = stats.ticks > 0 ? (double)stats.ticks : 1.0;
+    double steps = stats.sessionSteps > 0 ? (double)stats.sessionSteps : 1.0;
+    int sessions = stats.sessions > 0 ? stats.sessions : 1;
+    printf("[%.0fs] sessions %d | tick mean %.3f ms max %.3f ms | session step mean %.1f us max %.1f us"
+           " | in %.1f KB/s out %.1f KB/s | per session %.1f KB reserved, %.1f KB used\n",
+           seconds, stats.sessions, stats.tickMsTotal / ticks, stats.tickMsMax,
+           stats.sessionStepUsTotal / steps, stats.sessionStepUsMax,
+           stats.bytesIn / 1024.0 / seconds, stats.bytesOut / 1024.0 / seconds,
+           stats.sessionBytesReserved / 1024.0 / sessions, stats.sessionBytesUsed / 1024.0 / sessions);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    GameServer::Config config = GameServer::DefaultConfig();
+    int clientCount = 0;
+    float runSeconds = 0.0f; // 0 = until killed (or 10 s with loopback clients)
+    float reportInterval = 5.0f;
+    const char* metricsFile = nullptr;
+    int metricsPort = -1; // -1 = no endpoint
+    float metricsInterval = 10.0f;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--port") == 0) config.port = (uint16_t)atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--max-sessions") == 0) config.maxSessions = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--clients") == 0) clientCount = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--seconds") == 0) runSeconds = (float)atof(argv[i + 1]);
+        else if (strcmp(argv[i], "--report-interval") == 0) reportInterval = (float)atof(argv[i + 1]);
+        else if (strcmp(argv[i], "--metrics-file") == 0) metricsFile = argv[i + 1];
+        else if (strcmp(argv[i], "--metrics-port") == 0) metricsPort = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--metrics-interval") == 0) metricsInterval = (float)atof(argv[i + 1]);
+    }
+    if (clientCount > 0 && runSeconds <= 0.0f) runSeconds = 10.0f;
+    if (clientCount > config.maxSessions) config.maxSessions = clientCount;
+
+    SetTraceLogLevel(clientCount > 0 ? LOG_WARNING : LOG_INFO);
+
+    GameServer server(config);
+    if (!server.start()) return 1;
+
+    MetricsRegistry metrics;
+    server.attachMetrics(metrics);
+    WorldMetrics worldMetrics(metrics); // The series the server records into; the heap count is ours to fill
+    std::unique_ptr<MetricsFileWriter> metricsWriter;
+    if (metricsFile) metricsWriter.reset(new MetricsFileWriter(metrics, metricsFile, metricsInterval, 4 * 1024 * 1024));
+    MetricsEndpoint metricsEndpoint(metrics);
+    if (metricsPort >= 0 && !metricsEndpoint.open((uint16_t)metricsPort)) return 1;
+
+    std::vector<std::unique_ptr<NetClient>> clients;
+    NetAddress serverAddress;
+    UdpSocket::ParseAddress("127.0.0.1", server.getPort(), serverAddress);
+    for (int i = 0; i < clientCount; ++i) {
+        clients.emplace_back(new NetClient());
+        if (!clients.back()->connect(serverAddress, (WeaponType)(i % WEAPON_TYPE_COUNT), 1000 + i)) return 1;
+    }
+
+    // Fixed-rate loop: tick whenever the wall clock is a whole tick ahead, sleep otherwise
+    using Clock = std::chrono::steady_clock;
+    const auto tickDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(server.getTickSeconds()));
+    auto startTime = Clock::now();
+    auto nextTick = startTime;
+    auto lastReport = startTime;
+    uint64_t frame = 0;
+    GameServer::Stats totals = {};
+    while (runSeconds <= 0.0f || Clock::now() - startTime < std::chrono::duration<double>(runSeconds)) {
+        auto now = Clock::now();
+        if (now < nextTick) {
+            std::this_thread::sleep_for(nextTick - now);
+            continue;
+        }
+        nextTick += tickDuration;
+        if (now - nextTick > 10 * tickDuration) nextTick = now; // Fell far behind: don't try to catch up in a burst
+
+        // Loopback clients send this frame's input before the server drains its socket
+        for (int i = 0; i < clientCount; ++i) {
+            NetClient& client = *clients[i];
+            client.poll();
+            if (client.getStatus() == NetClient::Status::CONNECTED) client.sendInput(LoopbackAutopilot(client, frame, i));
+        }
+        server.tick();
+        frame++;
+
+        worldMetrics.heapAllocations.raiseTo(HeapAllocationCount());
+        if (metricsWriter) metricsWriter->poll(std::chrono::duration<double>(Clock::now() - startTime).count());
+        metricsEndpoint.poll();
+
+        double sinceReport = std::chrono::duration<double>(Clock::now() - lastReport).count();
+        if (sinceReport >= reportInterval) {
+            GameServer::Stats stats = server.takeStats();
+            PrintReport(stats, sinceReport);
+            totals.ticks += stats.ticks;
+            totals.sessionSteps += stats.sessionSteps;
+            lastReport = Clock::now();
+        }
+    }
+
+    if (metricsWriter) metricsWriter->write(std::chrono::duration<double>(Clock::now() - startTime).count()); // Final snapshot
+
+    if (clientCount > 0) {
+        GameServer::Stats stats = server.takeStats();
+        double sinceReport = std::chrono::duration<double>(Clock::now() - lastReport).count();
+        if (stats.ticks > 0) PrintReport(stats, sinceReport > 0.0 ? sinceReport : 1.0);
+        totals.ticks += stats.ticks;
+        totals.sessionSteps += stats.sessionSteps;
+
+        int connected = 0;
+        uint64_t states = 0;
+        for (const auto& client : clients) {
+            if (client->getStatus() == NetClient::Status::CONNECTED) connected++;
+            states += client->getStateCount();
+        }
+        printf("Loopback: %d/%d clients connected, %llu server ticks, %llu session steps, %llu states received\n",
+               connected, clientCount, (unsigned long long)totals.ticks,
+               (unsigned long long)totals.sessionSteps, (unsigned long long)states);
+        for (const auto& client : clients) client->disconnect();
+        server.stop();
+        return connected == clientCount && states > 0 ? 0 : 1;
+    }
+    server.stop();
+    return 0;
+}
@@ -0,0 +1,139 @@
+// SimBenchmark.cpp
+// Standard headless benchmark scenario: a fixed-seed World in horde mode, driven by a scripted
+// autopilot (strafe around a square, aim at the nearest zombie, fire, dash every two seconds) at a fixed
+// 60 Hz step. The player is kept alive so the horde keeps growing towards its cap. Reports
+// per-tick simulation cost and a checksum of the final state; the same run is the training
+// workload for the profile-guided build (see CMakeLists.txt).
+//
+// The autopilot uses only exactly-rounded arithmetic (no sinf/cosf), so builds that share the
+// same raylib agree bit-for-bit: e.g. the baseline, SIMD and threaded Wasm variants under Node.
+//
+// Usage: zombie_bench [ticks] [seed] [--standard] [--verify] [--expect <checksum>]
+//   --standard  normal wave pacing instead of the horde preset
+//   --verify    run the scenario twice and exit 1 if the two final checksums differ
+//   --expect    exit 1 unless the final checksum equals <checksum> (hex, as printed by another build)
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "raymath.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+
+struct RunResult {
+    std::vector<double> tickMs;
+    int peakZombies;
+    uint64_t checksum;
+};
+
+static PlayerInput Autopilot(const World& world) {
+    PlayerInput input = { { 0, 0 }, { 0, 0 }, true, false };
+
+    // Strafe between the corners of a square around the arena center, one corner every 1.5 s
+    static const Vector2 corners[4] = { { -150, -150 }, { 150, -150 }, { 150, 150 }, { -150, 150 } };
+    Vector2 corner = corners[(world.ticks / 90) % 4];
+    Vector2 target = { world.width / 2 + corner.x, world.height / 2 + corner.y };
+    input.move = Vector2Subtract(target, world.player.pos);
+
+    // Aim at the nearest zombie (straight ahead if there is none)
+    input.aim = Vector2Add(world.player.pos, world.player.facing);
+    float nearest = -1.0f;
+    for (const Zombie& zombie : world.floor.zombies) {
+        float distSq = Vector2DistanceSqr(zombie.pos, world.player.pos);
+        if (nearest < 0 || distSq < nearest) {
+            nearest = distSq;
+            input.aim = zombie.pos;
+        }
+    }
+
+    input.dash = world.ticks % 120 == 0;
+    return input;
+}
+
+static RunResult RunScenario(int ticks, uint64_t seed, bool horde) {
+    World world(1200.0f, 800.0f);
+    world.hordeMode = horde;
+    world.start(CreateRifle(), seed);
+
+    RunResult result;
+    result.tickMs.reserve(ticks);
+    result.peakZombies = 0;
+    for (int i = 0; i < ticks; ++i) {
+        PlayerInput input = Autopilot(world);
+        auto start = std::chrono::steady_clock::now();
+        world.step(TICK_SECONDS, input);
+        auto end = std::chrono::steady_clock::now();
+        result.tickMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+
+        world.player.health = world.player.maxHealth; // Keep the autopilot alive so the horde builds up
+        result.peakZombies = std::max(result.peakZombies, (int)world.floor.zombies.size());
+        if (world.status != World::Status::PLAYING) world.start(CreateRifle(), seed + world.ticks); // Floors cleared: go again
+    }
+    result.checksum = world.checksum();
+    return result;
+}
+
+static double Percentile(std::vector<double> samples, double p) {
+    if (samples.empty()) return 0.0;
+    size_t index = (size_t)(p * (samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+int main(int argc, char** argv) {
+    int ticks = 3600;
+    uint64_t seed = 1;
+    bool horde = true;
+    bool verify = false;
+    bool expect = false;
+    uint64_t expectedChecksum = 0;
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--standard") == 0) horde = false;
+        else if (strcmp(argv[i], "--verify") == 0) verify = true;
+        else if (strcmp(argv[i], "--expect") == 0 && i + 1 < argc) {
+            expect = true;
+            expectedChecksum = strtoull(argv[++i], nullptr, 16);
+        }
+        else if (positional++ == 0) ticks = atoi(argv[i]);
+        else seed = strtoull(argv[i], nullptr, 10);
+    }
+    if (ticks < 1) ticks = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    RunResult result = RunScenario(ticks, seed, horde);
+    double total = 0.0;
+    for (double ms : result.tickMs) total += ms;
+
+    printf("Scenario: %s, %d ticks, seed %llu\n", horde ? "horde" : "standard", ticks, (unsigned long long)seed);
+    printf("  Peak zombies:  %d\n", result.peakZombies);
+    printf("  Tick mean:     %.4f ms\n", total / ticks);
+    printf("  Tick p50:      %.4f ms\n", Percentile(result.tickMs, 0.50));
+    printf("  Tick p99:      %.4f ms\n", Percentile(result.tickMs, 0.99));
+    printf("  Total:         %.1f ms\n", total);
+    printf("  Checksum:      %016llx\n", (unsigned long long)result.checksum);
+
+    if (verify) {
+        uint64_t again = RunScenario(ticks, seed, horde).checksum;
+        if (again != result.checksum) {
+            printf("NONDETERMINISTIC: second run ended with checksum %016llx\n", (unsigned long long)again);
+            return 1;
+        }
+        printf("Deterministic: second run matched\n");
+    }
+    if (expect) {
+        if (result.checksum != expectedChecksum) {
+            printf("MISMATCH: expected checksum %016llx\n", (unsigned long long)expectedChecksum);
+            return 1;
+        }
+        printf("Matches the expected checksum\n");
+    }
+    return 0;
+}
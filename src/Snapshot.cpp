@@ -0,0 +1,401 @@
+#include "Snapshot.h"
+#include "World.h"
+#include <algorithm>
+#include <cmath>
+
+static const float POSITION_OFFSET = 512.0f; // Lets spawn-ring positions (just off-screen) stay positive
+static const float POSITION_SCALE = 16.0f;
+static const float VELOCITY_SCALE = 16.0f;
+static const float HEALTH_SCALE = 16.0f;
+static const float ZOMBIE_SIZE_SCALE = 4.0f;
+static const int POSITION_DELTA_BITS = 9; // +-255 units = +-16 px: a Fast zombie's movement over ~8 ticks
+
+bool operator==(const SnapshotPlayer& a, const SnapshotPlayer& b) {
+    return a.x == b.x && a.y == b.y && a.facingX == b.facingX && a.facingY == b.facingY &&
+           a.health == b.health && a.weapon == b.weapon && a.dashing == b.dashing;
+}
+
+bool operator==(const SnapshotZombie& a, const SnapshotZombie& b) {
+    return a.id == b.id && a.x == b.x && a.y == b.y && a.health == b.health &&
+           a.maxHealth == b.maxHealth && a.size == b.size && a.state == b.state && a.kind == b.kind;
+}
+
+bool operator==(const SnapshotBullet& a, const SnapshotBullet& b) {
+    return a.x == b.x && a.y == b.y && a.vx == b.vx && a.vy == b.vy;
+}
+
+bool operator==(const SnapshotWall& a, const SnapshotWall& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+bool operator==(const WorldSnapshot& a, const WorldSnapshot& b) {
+    return a.tick == b.tick && a.status == b.status && a.currentFloor == b.currentFloor &&
+           a.zombiesKilled == b.zombiesKilled && a.player == b.player &&
+           a.walls == b.walls && a.zombies == b.zombies && a.bullets == b.bullets && a.spit == b.spit;
+}
+
+// Rounds to the nearest step and saturates instead of wrapping
+static uint16_t QuantizeUnsigned(float value, float scale) {
+    float q = value * scale + 0.5f;
+    if (!(q > 0.0f)) return 0;
+    if (q >= 65535.0f) return 65535;
+    return (uint16_t)q;
+}
+
+static int16_t QuantizeSigned(float value, float scale) {
+    float q = std::round(value * scale);
+    if (q <= -32767.0f) return -32767;
+    if (q >= 32767.0f) return 32767;
+    return (int16_t)q;
+}
+
+uint16_t QuantizePosition(float coordinate) {
+    return QuantizeUnsigned(coordinate + POSITION_OFFSET, POSITION_SCALE);
+}
+
+float DequantizePosition(uint16_t value) {
+    return value / POSITION_SCALE - POSITION_OFFSET;
+}
+
+void CaptureSnapshot(const World& world, WorldSnapshot& out) {
+    out.tick = (uint32_t)world.ticks;
+    out.status = (uint8_t)world.status;
+    out.currentFloor = (uint8_t)world.currentFloor;
+    out.zombiesKilled = (uint32_t)world.zombiesKilled;
+
+    const Player& player = world.player;
+    out.player.x = QuantizePosition(player.pos.x);
+    out.player.y = QuantizePosition(player.pos.y);
+    out.player.facingX = QuantizeSigned(player.facing.x, 32767.0f);
+    out.player.facingY = QuantizeSigned(player.facing.y, 32767.0f);
+    out.player.health = QuantizeUnsigned(player.health, HEALTH_SCALE);
+    out.player.weapon = (uint8_t)player.weapon.type;
+    out.player.dashing = player.isDashing;
+
+    out.walls.clear();
+    for (const Rectangle& wall : world.floor.walls) {
+        out.walls.push_back({ QuantizeUnsigned(wall.x, 1.0f), QuantizeUnsigned(wall.y, 1.0f),
+                              QuantizeUnsigned(wall.width, 1.0f), QuantizeUnsigned(wall.height, 1.0f) });
+    }
+
+    out.zombies.clear();
+    out.zombies.reserve(world.floor.zombies.size());
+    for (const Zombie& zombie : world.floor.zombies) {
+        SnapshotZombie z;
+        z.id = zombie.id;
+        z.x = QuantizePosition(zombie.pos.x);
+        z.y = QuantizePosition(zombie.pos.y);
+        z.health = (uint16_t)std::min(std::max(zombie.health, 0), 65535);
+        z.maxHealth = (uint16_t)std::min(std::max(zombie.maxHealth, 0), 65535);
+        z.size = (uint8_t)std::min<int>(QuantizeUnsigned(zombie.size, ZOMBIE_SIZE_SCALE), 255);
+        z.state = (uint8_t)zombie.currentState;
+        z.kind = (uint8_t)zombie.kind;
+        out.zombies.push_back(z);
+    }
+    // Spawn order already sorts by id; only zombies added some other way need this
+    auto byId = [](const SnapshotZombie& a, const SnapshotZombie& b) { return a.id < b.id; };
+    if (!std::is_sorted(out.zombies.begin(), out.zombies.end(), byId)) {
+        std::stable_sort(out.zombies.begin(), out.zombies.end(), byId);
+    }
+
+    out.bullets.clear();
+    for (const Bullet& bullet : player.bullets) {
+        if (!bullet.active) continue;
+        out.bullets.push_back({ QuantizePosition(bullet.pos.x), QuantizePosition(bullet.pos.y),
+                                QuantizeSigned(bullet.velocity.x, VELOCITY_SCALE),
+                                QuantizeSigned(bullet.velocity.y, VELOCITY_SCALE) });
+    }
+
+    const EnemyProjectiles& spit = world.enemyProjectiles;
+    out.spit.clear();
+    for (int i = 0; i < spit.getCount(); ++i) {
+        out.spit.push_back({ QuantizePosition(spit.x[i]), QuantizePosition(spit.y[i]),
+                             QuantizeSigned(spit.vx[i], VELOCITY_SCALE), QuantizeSigned(spit.vy[i], VELOCITY_SCALE) });
+    }
+}
+
+// --- Encoding ---
+// A field compared against a baseline is preceded by a "changed" bit; without a baseline every
+// field is written and no bits are spent on flags. The reader mirrors each call exactly.
+
+static bool WriteChanged(BitWriter& writer, bool hasBaseline, bool changed) {
+    if (!hasBaseline) return true;
+    writer.flag(changed);
+    return changed;
+}
+
+static bool ReadChanged(BitReader& reader, bool hasBaseline) {
+    return !hasBaseline || reader.flag();
+}
+
+// Short signed delta from the baseline when both axes fit, absolute otherwise
+static void WritePositionDelta(BitWriter& writer, uint16_t x, uint16_t y, uint16_t baseX, uint16_t baseY) {
+    const int limit = 1 << (POSITION_DELTA_BITS - 1);
+    int dx = (int)x - (int)baseX;
+    int dy = (int)y - (int)baseY;
+    bool small = dx >= -limit && dx < limit && dy >= -limit && dy < limit;
+    writer.flag(small);
+    if (small) {
+        writer.signedBits(dx, POSITION_DELTA_BITS);
+        writer.signedBits(dy, POSITION_DELTA_BITS);
+    } else {
+        writer.bits(x, 16);
+        writer.bits(y, 16);
+    }
+}
+
+static void ReadPositionDelta(BitReader& reader, uint16_t& x, uint16_t& y, uint16_t baseX, uint16_t baseY) {
+    if (reader.flag()) {
+        x = (uint16_t)(baseX + reader.signedBits(POSITION_DELTA_BITS));
+        y = (uint16_t)(baseY + reader.signedBits(POSITION_DELTA_BITS));
+    } else {
+        x = (uint16_t)reader.bits(16);
+        y = (uint16_t)reader.bits(16);
+    }
+}
+
+static void WritePlayer(BitWriter& writer, const SnapshotPlayer& player, const SnapshotPlayer* base) {
+    bool delta = base != nullptr;
+    if (!delta) {
+        writer.bits(player.x, 16);
+        writer.bits(player.y, 16);
+    } else if (WriteChanged(writer, true, player.x != base->x || player.y != base->y)) {
+        WritePositionDelta(writer, player.x, player.y, base->x, base->y);
+    }
+    if (WriteChanged(writer, delta, !delta || player.facingX != base->facingX || player.facingY != base->facingY)) {
+        writer.signedBits(player.facingX, 16);
+        writer.signedBits(player.facingY, 16);
+    }
+    if (WriteChanged(writer, delta, !delta || player.health != base->health)) {
+        writer.bits(player.health, 16);
+    }
+    if (WriteChanged(writer, delta, !delta || player.weapon != base->weapon || player.dashing != base->dashing)) {
+        writer.bits(player.weapon, 3);
+        writer.flag(player.dashing);
+    }
+}
+
+static void ReadPlayer(BitReader& reader, SnapshotPlayer& player, const SnapshotPlayer* base) {
+    bool delta = base != nullptr;
+    if (delta) player = *base;
+    if (!delta) {
+        player.x = (uint16_t)reader.bits(16);
+        player.y = (uint16_t)reader.bits(16);
+    } else if (reader.flag()) {
+        ReadPositionDelta(reader, player.x, player.y, base->x, base->y);
+    }
+    if (ReadChanged(reader, delta)) {
+        player.facingX = (int16_t)reader.signedBits(16);
+        player.facingY = (int16_t)reader.signedBits(16);
+    }
+    if (ReadChanged(reader, delta)) {
+        player.health = (uint16_t)reader.bits(16);
+    }
+    if (ReadChanged(reader, delta)) {
+        player.weapon = (uint8_t)reader.bits(3);
+        player.dashing = reader.flag();
+    }
+}
+
+// A baseline zombie and a current one with the same id are the same zombie; archetype, size and max
+// health never change, so a mismatch there means the id was reused (e.g. a new floor) and it is sent as new
+static bool SameZombie(const SnapshotZombie& a, const SnapshotZombie& b) {
+    return a.kind == b.kind && a.size == b.size && a.maxHealth == b.maxHealth;
+}
+
+static void WriteZombies(BitWriter& writer, const std::vector<SnapshotZombie>& zombies,
+                         const std::vector<SnapshotZombie>* baseZombies) {
+    // Both lists are sorted by id, so matching them is a single merge walk. For every baseline
+    // zombie: one bit for "still here", then one bit for "changed" and the changed fields.
+    size_t j = 0;
+    if (baseZombies) {
+        for (const SnapshotZombie& base : *baseZombies) {
+            while (j < zombies.size() && zombies[j].id < base.id) j++;
+            bool paired = j < zombies.size() && zombies[j].id == base.id;
+            bool kept = paired && SameZombie(zombies[j], base);
+            writer.flag(kept);
+            if (kept) {
+                const SnapshotZombie& zombie = zombies[j];
+                if (WriteChanged(writer, true, !(zombie == base))) {
+                    if (WriteChanged(writer, true, zombie.x != base.x || zombie.y != base.y)) {
+                        WritePositionDelta(writer, zombie.x, zombie.y, base.x, base.y);
+                    }
+                    if (WriteChanged(writer, true, zombie.health != base.health)) writer.varBits(zombie.health);
+                    if (WriteChanged(writer, true, zombie.state != base.state)) writer.bits(zombie.state, 2);
+                }
+            }
+            if (paired) j++;
+        }
+    }
+
+    // Everything not kept above is new: same pairing, seen from the current list
+    auto forEachNew = [&](auto&& fn) {
+        size_t i = 0;
+        for (const SnapshotZombie& zombie : zombies) {
+            bool kept = false;
+            if (baseZombies) {
+                const std::vector<SnapshotZombie>& base = *baseZombies;
+                while (i < base.size() && base[i].id < zombie.id) i++;
+                if (i < base.size() && base[i].id == zombie.id) {
+                    kept = SameZombie(zombie, base[i]);
+                    i++;
+                }
+            }
+            if (!kept) fn(zombie);
+        }
+    };
+    uint32_t newCount = 0;
+    forEachNew([&](const SnapshotZombie&) { newCount++; });
+    writer.varBits(newCount);
+
+    uint32_t previousId = 0;
+    forEachNew([&](const SnapshotZombie& zombie) {
+        writer.varBits(zombie.id - previousId); // Ids ascend, and new ones are mostly consecutive
+        previousId = zombie.id;
+        writer.bits(zombie.x, 16);
+        writer.bits(zombie.y, 16);
+        writer.bits(zombie.size, 8);
+        writer.varBits(zombie.maxHealth);
+        writer.varBits(zombie.health);
+        writer.bits(zombie.state, 2);
+        writer.bits(zombie.kind, 3);
+    });
+}
+
+static void ReadZombies(BitReader& reader, std::vector<SnapshotZombie>& zombies,
+                        const std::vector<SnapshotZombie>* baseZombies) {
+    zombies.clear();
+    if (baseZombies) {
+        for (const SnapshotZombie& base : *baseZombies) {
+            if (!reader.flag()) continue; // Gone
+            SnapshotZombie zombie = base;
+            if (reader.flag()) {
+                if (reader.flag()) ReadPositionDelta(reader, zombie.x, zombie.y, base.x, base.y);
+                if (reader.flag()) zombie.health = (uint16_t)reader.varBits();
+                if (reader.flag()) zombie.state = (uint8_t)reader.bits(2);
+            }
+            zombies.push_back(zombie);
+        }
+    }
+
+    size_t keptCount = zombies.size();
+    uint32_t newCount = reader.varBits();
+    if (reader.overflowed()) return;
+    uint32_t previousId = 0;
+    for (uint32_t k = 0; k < newCount && !reader.overflowed(); ++k) {
+        SnapshotZombie zombie;
+        zombie.id = previousId + reader.varBits();
+        previousId = zombie.id;
+        zombie.x = (uint16_t)reader.bits(16);
+        zombie.y = (uint16_t)reader.bits(16);
+        zombie.size = (uint8_t)reader.bits(8);
+        zombie.maxHealth = (uint16_t)reader.varBits();
+        zombie.health = (uint16_t)reader.varBits();
+        zombie.state = (uint8_t)reader.bits(2);
+        zombie.kind = (uint8_t)reader.bits(3);
+        zombies.push_back(zombie);
+    }
+
+    // New zombies normally all have higher ids than the kept ones; merge when they don't
+    auto byId = [](const SnapshotZombie& a, const SnapshotZombie& b) { return a.id < b.id; };
+    if (keptCount > 0 && keptCount < zombies.size() && zombies[keptCount].id < zombies[keptCount - 1].id) {
+        std::inplace_merge(zombies.begin(), zombies.begin() + keptCount, zombies.end(), byId);
+    }
+}
+
+static void WriteBullets(BitWriter& writer, const std::vector<SnapshotBullet>& bullets) {
+    writer.varBits((uint32_t)bullets.size());
+    for (const SnapshotBullet& bullet : bullets) {
+        writer.bits(bullet.x, 16);
+        writer.bits(bullet.y, 16);
+        writer.signedBits(bullet.vx, 16);
+        writer.signedBits(bullet.vy, 16);
+    }
+}
+
+static void ReadBullets(BitReader& reader, std::vector<SnapshotBullet>& bullets) {
+    uint32_t count = reader.varBits();
+    bullets.clear();
+    for (uint32_t i = 0; i < count && !reader.overflowed(); ++i) {
+        SnapshotBullet bullet;
+        bullet.x = (uint16_t)reader.bits(16);
+        bullet.y = (uint16_t)reader.bits(16);
+        bullet.vx = (int16_t)reader.signedBits(16);
+        bullet.vy = (int16_t)reader.signedBits(16);
+        bullets.push_back(bullet);
+    }
+}
+
+void EncodeSnapshot(BitWriter& writer, const WorldSnapshot& snapshot, const WorldSnapshot* baseline) {
+    writer.bits(snapshot.tick, 32);
+    writer.flag(baseline != nullptr);
+    if (baseline) writer.bits(baseline->tick, 32);
+    writer.bits(snapshot.status, 2);
+    writer.bits(snapshot.currentFloor, 8);
+    writer.varBits(snapshot.zombiesKilled);
+
+    WritePlayer(writer, snapshot.player, baseline ? &baseline->player : nullptr);
+
+    // Walls only change with the floor or when one breaks: one bit while they match the baseline
+    bool sameWalls = baseline && baseline->walls == snapshot.walls;
+    if (baseline) writer.flag(sameWalls);
+    if (!sameWalls) {
+        writer.varBits((uint32_t)snapshot.walls.size());
+        for (const SnapshotWall& wall : snapshot.walls) {
+            writer.bits(wall.x, 16);
+            writer.bits(wall.y, 16);
+            writer.bits(wall.width, 16);
+            writer.bits(wall.height, 16);
+        }
+    }
+
+    WriteZombies(writer, snapshot.zombies, baseline ? &baseline->zombies : nullptr);
+
+    // Bullets and spit live for a second or two and have no identity; they are always sent in full
+    WriteBullets(writer, snapshot.bullets);
+    WriteBullets(writer, snapshot.spit);
+}
+
+bool PeekSnapshotBaseline(const uint8_t* data, size_t size, uint32_t& baselineTick) {
+    BitReader reader(data, size);
+    reader.bits(32);
+    if (!reader.flag()) return false;
+    baselineTick = reader.bits(32);
+    return !reader.overflowed();
+}
+
+bool DecodeSnapshot(BitReader& reader, const WorldSnapshot* baseline, WorldSnapshot& out) {
+    out.tick = reader.bits(32);
+    if (reader.flag()) {
+        uint32_t baselineTick = reader.bits(32);
+        if (!baseline || baseline == &out || baseline->tick != baselineTick) return false;
+    } else {
+        baseline = nullptr;
+    }
+    out.status = (uint8_t)reader.bits(2);
+    out.currentFloor = (uint8_t)reader.bits(8);
+    out.zombiesKilled = reader.varBits();
+
+    ReadPlayer(reader, out.player, baseline ? &baseline->player : nullptr);
+
+    if (baseline && reader.flag()) {
+        out.walls = baseline->walls;
+    } else {
+        uint32_t count = reader.varBits();
+        out.walls.clear();
+        for (uint32_t i = 0; i < count && !reader.overflowed(); ++i) {
+            SnapshotWall wall;
+            wall.x = (uint16_t)reader.bits(16);
+            wall.y = (uint16_t)reader.bits(16);
+            wall.width = (uint16_t)reader.bits(16);
+            wall.height = (uint16_t)reader.bits(16);
+            out.walls.push_back(wall);
+        }
+    }
+
+    ReadZombies(reader, out.zombies, baseline ? &baseline->zombies : nullptr);
+
+    ReadBullets(reader, out.bullets);
+    ReadBullets(reader, out.spit);
+    return !reader.overflowed();
+}
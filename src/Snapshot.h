@@ -0,0 +1,78 @@
+#pragma once
+#include "raylib.h"
+#include "BitStream.h"
+#include <cstdint>
+#include <vector>
+
+class World;
+
+// Quantized, self-contained copy of the visible world state: what a client needs to draw a tick,
+// and what a replay stores per frame. Values are kept in their quantized form, so decoding an
+// encoded snapshot reproduces it exactly (operator== holds) and delta encoding compares integers.
+//
+// Positions are 16-bit fixed point, 1/16 px over [-512, 3584) px. Timers, weapon cooldowns and
+// the RNG are not included; exact save-states need more than this.
+
+struct SnapshotPlayer {
+    uint16_t x, y;
+    int16_t facingX, facingY; // Unit vector scaled to +-32767
+    uint16_t health;          // 1/16 hp
+    uint8_t weapon;           // WeaponType
+    bool dashing;
+};
+
+struct SnapshotZombie {
+    uint32_t id;       // Zombie::id; lists are sorted by it
+    uint16_t x, y;
+    uint16_t health;
+    uint16_t maxHealth;
+    uint8_t size;      // 1/4 px
+    uint8_t state;     // Zombie::ZombieState
+    uint8_t kind;      // ZombieKind
+};
+
+struct SnapshotBullet {
+    uint16_t x, y;
+    int16_t vx, vy; // 1/16 px per second
+};
+
+struct SnapshotWall {
+    uint16_t x, y, width, height; // Whole pixels
+};
+
+struct WorldSnapshot {
+    uint32_t tick;
+    uint8_t status; // World::Status
+    uint8_t currentFloor;
+    uint32_t zombiesKilled;
+    SnapshotPlayer player;
+    std::vector<SnapshotWall> walls;
+    std::vector<SnapshotZombie> zombies;
+    std::vector<SnapshotBullet> bullets;
+    std::vector<SnapshotBullet> spit; // World::enemyProjectiles
+};
+
+bool operator==(const SnapshotPlayer& a, const SnapshotPlayer& b);
+bool operator==(const SnapshotZombie& a, const SnapshotZombie& b);
+bool operator==(const SnapshotBullet& a, const SnapshotBullet& b);
+bool operator==(const SnapshotWall& a, const SnapshotWall& b);
+bool operator==(const WorldSnapshot& a, const WorldSnapshot& b);
+
+uint16_t QuantizePosition(float coordinate);
+float DequantizePosition(uint16_t value);
+
+// Fills 'out' from 'world', reusing its vectors' capacity
+void CaptureSnapshot(const World& world, WorldSnapshot& out);
+
+// Bitpacks 'snapshot'. With a 'baseline' (a snapshot the receiver is known to have, e.g. the last
+// one it acknowledged) only what changed is written: kept zombies cost a few bits, moved ones a
+// short position delta, and the walls one bit while none changed. Without one the
+// snapshot is written in full. Call writer.finish() afterwards.
+void EncodeSnapshot(BitWriter& writer, const WorldSnapshot& snapshot, const WorldSnapshot* baseline);
+
+// Tick of the baseline an encoded snapshot was delta-encoded against; false for a full snapshot
+bool PeekSnapshotBaseline(const uint8_t* data, size_t size, uint32_t& baselineTick);
+
+// Decodes into 'out'. 'baseline' must be the snapshot named by PeekSnapshotBaseline (ignored for
+// full snapshots) and cannot be 'out'. Returns false on a truncated packet or a missing/mismatched baseline.
+bool DecodeSnapshot(BitReader& reader, const WorldSnapshot* baseline, WorldSnapshot& out);
@@ -0,0 +1,181 @@
+// SnapshotBenchmark.cpp
+// Snapshot codec benchmark: a fixed-seed World is filled to N zombies (horde spawning, player kept
+// alive and not shooting, so the crowd stays and chases), then captured at 30 Hz like a server
+// would. Each capture is encoded in full and as a delta against the capture 'ackDelay' ticks
+// earlier (the baseline a client would have acknowledged one round trip ago), and both are decoded
+// again. Reports bytes per snapshot and encode/decode throughput, and exits 1 if any decode does
+// not reproduce the captured snapshot exactly.
+//
+// The same world then times exact checkpoints (WorldCheckpoint.h): save and restore cost, and a
+// replay check that stepping on from a restored checkpoint (in place, and into a second World
+// on another floor layout) ends on the same checksum as the original run.
+//
+// Usage: snapshot_bench [zombies=1000] [snapshots=300] [ackDelay=6] [seed=1]
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "Snapshot.h"
+#include "WorldCheckpoint.h"
+#include "raymath.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+static const int TICKS_PER_SNAPSHOT = 2; // 30 Hz
+static const int TIMED_REPEATS = 20;     // Encode/decode repeats per snapshot, to get measurable times
+static const int CHECKPOINT_REPEATS = 200;
+static const int REPLAY_TICKS = 300;
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+struct CodecTotals {
+    double bytes = 0.0;
+    size_t maxBytes = 0;
+    double encodeUs = 0.0;
+    double decodeUs = 0.0;
+};
+
+// Encodes 'snapshot' (against 'baseline' if given) TIMED_REPEATS times, decodes it as often, and
+// checks the decoded copy. Returns false on a mismatch.
+static bool Measure(const WorldSnapshot& snapshot, const WorldSnapshot* baseline, std::vector<uint8_t>& buffer,
+                    WorldSnapshot& decoded, CodecTotals& totals) {
+    size_t size = 0;
+    auto start = Clock::now();
+    for (int r = 0; r < TIMED_REPEATS; ++r) {
+        BitWriter writer(buffer.data(), buffer.size());
+        EncodeSnapshot(writer, snapshot, baseline);
+        size = writer.finish();
+        if (writer.overflowed()) return false;
+    }
+    totals.encodeUs += ElapsedUs(start) / TIMED_REPEATS;
+
+    bool ok = true;
+    start = Clock::now();
+    for (int r = 0; r < TIMED_REPEATS; ++r) {
+        BitReader reader(buffer.data(), size);
+        ok = DecodeSnapshot(reader, baseline, decoded) && ok;
+    }
+    totals.decodeUs += ElapsedUs(start) / TIMED_REPEATS;
+
+    totals.bytes += size;
+    if (size > totals.maxBytes) totals.maxBytes = size;
+    return ok && decoded == snapshot;
+}
+
+int main(int argc, char** argv) {
+    int zombieCount = argc > 1 ? atoi(argv[1]) : 1000;
+    int snapshots = argc > 2 ? atoi(argv[2]) : 300;
+    int ackDelay = argc > 3 ? atoi(argv[3]) : 6;
+    uint64_t seed = argc > 4 ? strtoull(argv[4], nullptr, 10) : 1;
+    if (zombieCount < 1) zombieCount = 1;
+    if (snapshots < 1) snapshots = 1;
+    if (ackDelay < TICKS_PER_SNAPSHOT) ackDelay = TICKS_PER_SNAPSHOT;
+    int baselineLag = ackDelay / TICKS_PER_SNAPSHOT; // In captures
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(1200.0f, 800.0f);
+    world.start(CreateRifle(), seed);
+    world.setHordeMode(true);
+    world.waveDirector.setConfig(WaveConfig::Horde(zombieCount));
+
+    // Hold still and let the horde arrive; nobody shoots, so nobody dies
+    PlayerInput input = { { 0, 0 }, { world.width, world.height / 2 }, false, false };
+    for (int i = 0; i < 600 && (int)world.floor.zombies.size() < zombieCount; ++i) {
+        world.step(TICK_SECONDS, input);
+    }
+
+    // Ring of recent captures; the oldest one is the delta baseline
+    std::vector<WorldSnapshot> history(baselineLag + 1);
+    WorldSnapshot decoded;
+    std::vector<uint8_t> buffer(1 << 20);
+    CodecTotals full, delta;
+    double captureUs = 0.0;
+    int deltaCount = 0;
+    int mismatches = 0;
+
+    auto advance = [&input](World& target, int ticks) {
+        for (int t = 0; t < ticks; ++t) {
+            target.player.health = target.player.maxHealth;
+            // Walk back and forth so the crowd keeps turning and moving
+            input.move = (target.ticks / 120) % 2 == 0 ? Vector2{ 1, 0 } : Vector2{ -1, 0 };
+            target.step(TICK_SECONDS, input);
+        }
+    };
+
+    for (int s = 0; s < snapshots; ++s) {
+        advance(world, TICKS_PER_SNAPSHOT);
+
+        WorldSnapshot& current = history[s % history.size()];
+        auto start = Clock::now();
+        CaptureSnapshot(world, current);
+        captureUs += ElapsedUs(start);
+
+        if (!Measure(current, nullptr, buffer, decoded, full)) mismatches++;
+        if (s >= baselineLag) {
+            const WorldSnapshot& baseline = history[(s - baselineLag) % history.size()];
+            if (!Measure(current, &baseline, buffer, decoded, delta)) mismatches++;
+            deltaCount++;
+        }
+    }
+
+    auto report = [](const char* name, const CodecTotals& totals, int count) {
+        if (count == 0) return;
+        double bytes = totals.bytes / count;
+        double encodeUs = totals.encodeUs / count;
+        double decodeUs = totals.decodeUs / count;
+        printf("  %-6s %8.0f B mean %8zu B max | encode %8.1f us (%7.1f MB/s) | decode %8.1f us (%7.1f MB/s)\n",
+               name, bytes, totals.maxBytes, encodeUs, bytes / encodeUs, decodeUs, bytes / decodeUs);
+    };
+
+    printf("Snapshots: %d zombies alive, %d captures at 30 Hz, delta baseline %d ticks old, seed %llu\n",
+           (int)world.floor.zombies.size(), snapshots, baselineLag * TICKS_PER_SNAPSHOT, (unsigned long long)seed);
+    printf("  Capture %.1f us mean\n", captureUs / snapshots);
+    report("full", full, snapshots);
+    report("delta", delta, deltaCount);
+    if (mismatches > 0) {
+        printf("FAILED: %d snapshots did not decode to the captured state\n", mismatches);
+        return 1;
+    }
+    printf("  All %d encodes round-tripped exactly\n", snapshots + deltaCount);
+
+    WorldCheckpoint checkpoint;
+    auto start = Clock::now();
+    for (int r = 0; r < CHECKPOINT_REPEATS; ++r) SaveCheckpoint(world, checkpoint);
+    double saveUs = ElapsedUs(start) / CHECKPOINT_REPEATS;
+    start = Clock::now();
+    for (int r = 0; r < CHECKPOINT_REPEATS; ++r) RestoreCheckpoint(world, checkpoint);
+    double restoreUs = ElapsedUs(start) / CHECKPOINT_REPEATS;
+
+    // Replay from the checkpoint three times: the original run, in place, and in a fresh World
+    advance(world, REPLAY_TICKS);
+    uint64_t original = world.checksum();
+    RestoreCheckpoint(world, checkpoint);
+    advance(world, REPLAY_TICKS);
+    uint64_t inPlace = world.checksum();
+    World other(1200.0f, 800.0f);
+    other.start(CreatePistol(), seed + 1);
+    start = Clock::now();
+    RestoreCheckpoint(other, checkpoint);
+    double crossFloorUs = ElapsedUs(start);
+    advance(other, REPLAY_TICKS);
+    uint64_t crossFloor = other.checksum();
+
+    printf("Checkpoints: %zu zombies, %zu bullets, %zu KB\n", checkpoint.zombies.size(), checkpoint.bullets.size(),
+           checkpoint.getMemoryBytes() / 1024);
+    printf("  Save %.1f us | restore %.1f us | restore onto another floor %.1f us\n", saveUs, restoreUs, crossFloorUs);
+    if (inPlace != original || crossFloor != original) {
+        printf("FAILED: replay after restore diverged (%016llx / %016llx, expected %016llx)\n",
+               (unsigned long long)inPlace, (unsigned long long)crossFloor, (unsigned long long)original);
+        return 1;
+    }
+    printf("  Replays of %d ticks after restore match the original run\n", REPLAY_TICKS);
+    return 0;
+}
@@ -0,0 +1,134 @@
+// SoakRunner.cpp
+// Window-less soak test: plays thousands of complete games with a Bot at the controls, spread
+// over worker threads (one World per game), and reports how the bots fared and what the
+// simulation cost: wins/losses, survival time, floors reached, aggregate ticks per second and
+// per-tick latency percentiles.
+//
+// Game i uses seed+i for both the world and its bot, so a run is reproducible whatever the
+// thread count: the combined checksum (xor of every game's final World::checksum) must match.
+//
+// Usage: zombie_soak [games=1000] [--threads <n>] [--seed <s>] [--max-seconds <t>] [--horde]
+//   --max-seconds  simulated time after which a game still running counts as timed out (default 600)
+//   --horde        play every game with the horde spawning preset
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "Bot.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+
+struct GameResult {
+    World::Status status;
+    bool timedOut;
+    float survivalSeconds;
+    int floorReached;
+    uint64_t ticks;
+    uint64_t checksum;
+};
+
+static GameResult PlayGame(uint64_t seed, WeaponType weapon, bool horde, float maxSeconds, LatencyHistogram& latency) {
+    World world(1200.0f, 800.0f);
+    world.start(CreateWeapon(weapon), seed);
+    world.setHordeMode(horde);
+    Bot bot(seed);
+
+    while (world.status == World::Status::PLAYING && world.time < maxSeconds) {
+        PlayerInput input = bot.think(world);
+        auto start = std::chrono::steady_clock::now();
+        world.step(TICK_SECONDS, input);
+        auto end = std::chrono::steady_clock::now();
+        latency.record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    GameResult result;
+    result.status = world.status;
+    result.timedOut = world.status == World::Status::PLAYING;
+    result.survivalSeconds = world.time;
+    result.floorReached = world.currentFloor;
+    result.ticks = world.ticks;
+    result.checksum = world.checksum();
+    return result;
+}
+
+static double Percentile(std::vector<double> samples, double p) {
+    if (samples.empty()) return 0.0;
+    size_t index = (size_t)(p * (samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+int main(int argc, char** argv) {
+    int games = 1000;
+    int threads = (int)std::thread::hardware_concurrency();
+    uint64_t seed = 1;
+    float maxSeconds = 600.0f;
+    bool horde = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--max-seconds") == 0 && i + 1 < argc) maxSeconds = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "--horde") == 0) horde = true;
+        else games = atoi(argv[i]);
+    }
+    if (games < 1) games = 1;
+    if (threads < 1) threads = 1;
+    if (threads > games) threads = games;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    std::vector<GameResult> results(games);
+    LatencyHistogram ticks; // Shared: every worker records into it without a lock
+    std::atomic<int> nextGame(0);
+
+    auto wallStart = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            for (int game = nextGame++; game < games; game = nextGame++) {
+                results[game] = PlayGame(seed + game, (WeaponType)(game % WEAPON_TYPE_COUNT), horde, maxSeconds, ticks);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    int won = 0, lost = 0, timedOut = 0;
+    int floors[4] = { 0, 0, 0, 0 };
+    uint64_t checksum = 0;
+    std::vector<double> survival;
+    survival.reserve(games);
+    for (const GameResult& result : results) {
+        if (result.timedOut) timedOut++;
+        else if (result.status == World::Status::WON) won++;
+        else lost++;
+        floors[std::min(std::max(result.floorReached, 0), 3)]++;
+        survival.push_back(result.survivalSeconds);
+        checksum ^= result.checksum;
+    }
+    double survivalTotal = 0.0;
+    for (double s : survival) survivalTotal += s;
+
+    printf("Soak: %d games (each weapon in turn), seed %llu, %d threads%s\n", games,
+           (unsigned long long)seed, threads, horde ? ", horde" : "");
+    printf("  Results:     %d won, %d lost, %d still alive after %.0f s\n", won, lost, timedOut, maxSeconds);
+    printf("  Floors:      reached 1: %d  2: %d  3: %d\n", floors[1], floors[2], floors[3]);
+    printf("  Survival:    mean %.1f s  p50 %.1f s  p99 %.1f s\n", survivalTotal / games,
+           Percentile(survival, 0.50), Percentile(survival, 0.99));
+    printf("  Throughput:  %llu ticks in %.2f s wall = %.0f ticks/s (%.0f per thread)\n",
+           (unsigned long long)ticks.getCount(), wallSeconds, ticks.getCount() / wallSeconds, ticks.getCount() / wallSeconds / threads);
+    printf("  Tick:        mean %.2f us  p50 %.2f us  p99 %.2f us  max %.2f us\n",
+           ticks.getMeanNs() / 1000.0, ticks.percentileNs(0.50) / 1000.0,
+           ticks.percentileNs(0.99) / 1000.0, ticks.getMaxNs() / 1000.0);
+    printf("  Checksum:    %016llx\n", (unsigned long long)checksum);
+    return 0;
+}
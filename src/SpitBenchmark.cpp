@@ -0,0 +1,146 @@
+// SpitBenchmark.cpp
+// Enemy-projectile benchmark. First the pool alone: on a fixed-seed floor it is filled with N
+// projectiles at random open points flying in random directions, the player's body in the middle,
+// and updated for a number of ticks with the spent ones topped back up after each tick (outside
+// the timing), for N doubling up to the limit. It reports the update cost per tick and per live
+// projectile and counts heap allocations made during the updates. Then a whole World: S spitters
+// ringed around the player at spitting range, stepped with the player kept alive, reporting the
+// step cost and how much spit is in the air.
+// Exits 1 if a pool update allocates, or if the cost per projectile at the largest N is more
+// than 3x the cost at the smallest (the update is meant to be linear in the live count).
+//
+// Usage: spit_bench [maxProjectiles=16384] [ticks=600] [spitters=500] [seed=1]
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "EnemyProjectiles.h"
+#include "raymath.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+static const float SPIT_SPEED = 300.0f; // As SpitterZombie
+static const float SPIT_LIFETIME = 1.5f;
+
+// Every heap allocation in the process goes through here, so the pool updates can be checked for them
+static size_t heapAllocations = 0;
+
+void* operator new(size_t size) {
+    heapAllocations++;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// A projectile at a random open point, flying in a random direction, with a random part of its life used up
+static EnemyProjectile RandomProjectile(const World& world, Rng& rng) {
+    Vector2 pos;
+    do {
+        pos = { (float)rng.range(0, (int)world.width - 1), (float)rng.range(0, (int)world.height - 1) };
+    } while (world.floor.wallIndex.containsPoint(pos));
+    float angle = rng.range(0, 359) * DEG2RAD;
+    float life = SPIT_LIFETIME * rng.range(10, 100) / 100.0f;
+    return { pos, { cosf(angle) * SPIT_SPEED, sinf(angle) * SPIT_SPEED }, life, 8 };
+}
+
+int main(int argc, char** argv) {
+    int maxProjectiles = argc > 1 ? atoi(argv[1]) : 16384;
+    int ticks = argc > 2 ? atoi(argv[2]) : 600;
+    int spitterCount = argc > 3 ? atoi(argv[3]) : 500;
+    uint64_t seed = argc > 4 ? strtoull(argv[4], nullptr, 10) : 1;
+    if (maxProjectiles < 1024) maxProjectiles = 1024;
+    if (ticks < 1) ticks = 1;
+    if (spitterCount < 1) spitterCount = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(1200.0f, 800.0f);
+    world.start(CreatePistol(), seed);
+    Vector2 target = world.player.pos;
+    Rng rng(seed * 7919);
+
+    // --- The pool alone ---
+    printf("Enemy projectile pool, %d ticks per size, seed %llu\n", ticks, (unsigned long long)seed);
+    double firstPerProjectile = 0.0, lastPerProjectile = 0.0;
+    size_t updateAllocations = 0;
+    for (int size = 1024; size <= maxProjectiles; size *= 2) {
+        EnemyProjectiles pool(size);
+        while (pool.spawn(RandomProjectile(world, rng))) {}
+
+        double totalUs = 0.0;
+        long long liveTotal = 0, spent = 0;
+        int hits = 0;
+        for (int t = 0; t < ticks; ++t) {
+            int live = pool.getCount();
+            size_t allocationsBefore = heapAllocations;
+            auto start = Clock::now();
+            hits += pool.update(TICK_SECONDS, target, world.player.size, world.floor.occupancy) > 0;
+            totalUs += ElapsedUs(start);
+            updateAllocations += heapAllocations - allocationsBefore;
+
+            liveTotal += live;
+            spent += live - pool.getCount();
+            while (pool.spawn(RandomProjectile(world, rng))) {}
+        }
+        double perProjectileNs = totalUs * 1000.0 / (double)liveTotal;
+        if (size == 1024) firstPerProjectile = perProjectileNs;
+        lastPerProjectile = perProjectileNs;
+        printf("  %6d live: %8.2f us per tick, %5.2f ns per projectile (%lld spent, player hit on %d ticks)\n",
+               size, totalUs / ticks, perProjectileNs, spent, hits);
+    }
+
+    // --- Spitters in a World ---
+    ZombieList& zombies = world.floor.zombies;
+    zombies.reserve(spitterCount);
+    while ((int)zombies.size() < spitterCount) {
+        float angle = rng.range(0, 359) * DEG2RAD;
+        float distance = (float)rng.range(120, (int)SpitterZombie::SPIT_RANGE - 10);
+        Vector2 pos = Vector2Add(target, { cosf(angle) * distance, sinf(angle) * distance });
+        if (world.floor.wallIndex.overlapsCircle(pos, SpitterZombie::SIZE)) continue;
+        zombies.push_back(SpawnZombie<SpitterZombie>(pos));
+        zombies.back().id = (uint32_t)zombies.size();
+    }
+
+    PlayerInput input = { { 0, 0 }, { world.width, world.height / 2 }, false, false };
+    double stepUs = 0.0, worstUs = 0.0;
+    long long inFlight = 0;
+    int peakInFlight = 0;
+    for (int t = 0; t < ticks; ++t) {
+        world.player.health = world.player.maxHealth;
+        auto start = Clock::now();
+        world.step(TICK_SECONDS, input);
+        double us = ElapsedUs(start);
+        stepUs += us;
+        if (us > worstUs) worstUs = us;
+        inFlight += world.enemyProjectiles.getCount();
+        if (world.enemyProjectiles.getCount() > peakInFlight) peakInFlight = world.enemyProjectiles.getCount();
+    }
+    printf("World with %d spitters: step %.1f us mean, %.1f us worst; spit in flight %.0f mean, %d peak (pool of %d)\n",
+           spitterCount, stepUs / ticks, worstUs, (double)inFlight / ticks, peakInFlight, world.enemyProjectiles.getCapacity());
+
+    bool linear = lastPerProjectile <= firstPerProjectile * 3.0;
+    if (updateAllocations > 0 || !linear) {
+        printf("FAILED: %zu heap allocations during pool updates; %.2f ns per projectile at the largest size vs %.2f at 1024\n",
+               updateAllocations, lastPerProjectile, firstPerProjectile);
+        return 1;
+    }
+    printf("  Pool updates made no heap allocations; cost per projectile stays within 3x from 1024 to %d live\n",
+           maxProjectiles);
+    return 0;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+// Fixed-capacity ring buffer for one producer thread and one consumer thread, lock-free: each side
+// owns one index and only reads the other's (acquire/release pairs hand the items over). The two
+// indices sit on separate cache lines so the sides don't invalidate each other's line on every
+// push and pop. CAPACITY must be a power of two; at most CAPACITY items are queued at once.
+template <typename T, size_t CAPACITY>
+class SpscQueue {
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    // Producer side. Returns false (and drops the item) when the queue is full.
+    bool push(const T& item) {
+        size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == CAPACITY) return false;
+        items[tail & (CAPACITY - 1)] = item;
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when the queue is empty.
+    bool pop(T& item) {
+        size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire)) return false;
+        item = items[head & (CAPACITY - 1)];
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: the oldest item without removing it, or nullptr when empty
+    const T* peek() const {
+        size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire)) return nullptr;
+        return &items[head & (CAPACITY - 1)];
+    }
+
+    // Exact on either side's thread when the other is idle, a snapshot otherwise
+    size_t size() const { return tailIndex.load(std::memory_order_acquire) - headIndex.load(std::memory_order_acquire); }
+
+private:
+    alignas(64) std::atomic<size_t> headIndex{ 0 }; // Next item to pop; written by the consumer only
+    alignas(64) std::atomic<size_t> tailIndex{ 0 }; // Next free slot; written by the producer only
+    alignas(64) T items[CAPACITY];
+};
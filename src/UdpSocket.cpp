@@ -0,0 +1,113 @@
+#include "UdpSocket.h"
+#include "raylib.h" // TraceLog
+#include <cstring>
+#include <cstdio>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI  // Keeps wingdi.h from clashing with raylib names (Rectangle, ...)
+#define NOUSER
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef int socklen_t;
+#define CLOSE_SOCKET closesocket
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define CLOSE_SOCKET ::close
+#endif
+
+UdpSocket::UdpSocket() : handle(-1), localPort(0) {
+#ifdef _WIN32
+    static bool winsockStarted = false;
+    if (!winsockStarted) {
+        WSADATA data;
+        winsockStarted = WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }
+#endif
+}
+
+UdpSocket::~UdpSocket() {
+    close();
+}
+
+bool UdpSocket::open(uint16_t port) {
+    close();
+    intptr_t fd = (intptr_t)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        TraceLog(LOG_WARNING, "NET: Failed to create UDP socket");
+        return false;
+    }
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind((int)fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+        TraceLog(LOG_WARNING, "NET: Failed to bind UDP port %d", (int)port);
+        CLOSE_SOCKET((int)fd);
+        return false;
+    }
+
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    ioctlsocket((SOCKET)fd, FIONBIO, &nonBlocking);
+#else
+    fcntl((int)fd, F_SETFL, fcntl((int)fd, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
+    socklen_t length = sizeof(addr);
+    getsockname((int)fd, (sockaddr*)&addr, &length);
+    localPort = ntohs(addr.sin_port);
+    handle = fd;
+    return true;
+}
+
+void UdpSocket::close() {
+    if (handle >= 0) {
+        CLOSE_SOCKET((int)handle);
+        handle = -1;
+        localPort = 0;
+    }
+}
+
+bool UdpSocket::isOpen() const {
+    return handle >= 0;
+}
+
+bool UdpSocket::send(const NetAddress& to, const void* data, size_t size) {
+    if (handle < 0) return false;
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(to.ip);
+    addr.sin_port = htons(to.port);
+    return sendto((int)handle, (const char*)data, (int)size, 0, (sockaddr*)&addr, sizeof(addr)) == (int)size;
+}
+
+size_t UdpSocket::receive(NetAddress& from, void* buffer, size_t bufferSize) {
+    if (handle < 0) return 0;
+    sockaddr_in addr;
+    socklen_t length = sizeof(addr);
+    int received = (int)recvfrom((int)handle, (char*)buffer, (int)bufferSize, 0, (sockaddr*)&addr, &length);
+    if (received <= 0) return 0; // Would block, or a transient error: either way nothing to read
+    from.ip = ntohl(addr.sin_addr.s_addr);
+    from.port = ntohs(addr.sin_port);
+    return (size_t)received;
+}
+
+bool UdpSocket::ParseAddress(const char* host, uint16_t port, NetAddress& out) {
+    if (strcmp(host, "localhost") == 0) host = "127.0.0.1";
+    unsigned a, b, c, d;
+    char trailing;
+    if (sscanf(host, "%u.%u.%u.%u%c", &a, &b, &c, &d, &trailing) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+        return false;
+    }
+    out.ip = (a << 24) | (b << 16) | (c << 8) | d;
+    out.port = port;
+    return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// IPv4 endpoint in host byte order
+struct NetAddress {
+    uint32_t ip;
+    uint16_t port;
+
+    bool operator==(const NetAddress& other) const { return ip == other.ip && port == other.port; }
+    bool operator!=(const NetAddress& other) const { return !(*this == other); }
+};
+
+// Minimal non-blocking UDP socket over BSD sockets / Winsock. Every call returns immediately:
+// receive() reports "nothing pending" instead of waiting, so one thread can poll the server
+// socket and any number of loopback client sockets from the same loop.
+class UdpSocket {
+public:
+    UdpSocket();
+    ~UdpSocket();
+
+    UdpSocket(const UdpSocket&) = delete;
+    UdpSocket& operator=(const UdpSocket&) = delete;
+
+    // Binds to 'port' on all interfaces (0 = any free port). Returns false and logs on failure.
+    bool open(uint16_t port);
+    void close();
+    bool isOpen() const;
+
+    bool send(const NetAddress& to, const void* data, size_t size);
+    // Returns the datagram size, or 0 when nothing is pending (or on error)
+    size_t receive(NetAddress& from, void* buffer, size_t bufferSize);
+
+    uint16_t getLocalPort() const { return localPort; }
+
+    // "a.b.c.d" or "localhost"; returns false for anything else
+    static bool ParseAddress(const char* host, uint16_t port, NetAddress& out);
+
+private:
+    intptr_t handle; // SOCKET on Windows, file descriptor elsewhere; -1 when closed
+    uint16_t localPort;
+};
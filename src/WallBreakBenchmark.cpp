@@ -0,0 +1,166 @@
+// WallBreakBenchmark.cpp
+// Destructible-wall benchmark: a fixed-seed World is filled to N zombies (horde spawning, player
+// kept alive and not shooting), then every wall of the floor is broken in turn from the same
+// checkpoint by a bullet parked inside it with the wall one hit point from breaking. For each wall
+// it times the step that breaks it against a plain step from the same state, the incremental
+// patch of the wall index and occupancy grid on its own, and a full rebuild of both. After every
+// break the world's patched indices are checked against freshly built ones with random raycasts,
+// circle and point queries; exits 1 on any difference or if a wall fails to break.
+//
+// Usage: breach_bench [zombies=10000] [queries=4000] [seed=1]
+
+#include "raylib.h"
+#include "World.h"
+#include "WeaponTypes.h"
+#include "WorldCheckpoint.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <vector>
+
+static const float TICK_SECONDS = 1.0f / 60.0f;
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+struct Timing {
+    double total = 0.0;
+    double worst = 0.0;
+    void add(double us) {
+        total += us;
+        worst = std::max(worst, us);
+    }
+};
+
+static bool SameRect(const Rectangle& a, const Rectangle& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+// Random queries against the world's (patched) indices and fresh ones; returns the number that differ
+static int CompareIndices(const World& world, const WallIndex& freshIndex, const OccupancyGrid& freshGrid,
+                          Rng& rng, int queries) {
+    const Floor& floor = world.floor;
+    int lowX = -100, highX = (int)world.width + 100, lowY = -100, highY = (int)world.height + 100;
+    int mismatches = 0;
+    for (int q = 0; q < queries; ++q) {
+        Vector2 a = { (float)rng.range(lowX, highX), (float)rng.range(lowY, highY) };
+        Vector2 b = { (float)rng.range(lowX, highX), (float)rng.range(lowY, highY) };
+        RayHit patched = floor.occupancy.castSegment({ a, b });
+        RayHit fresh = freshGrid.castSegment({ a, b });
+        if (patched.wall != fresh.wall || patched.fraction != fresh.fraction) mismatches++;
+
+        float radius = (float)rng.range(2, 40);
+        if (floor.wallIndex.overlapsCircle(a, radius) != freshIndex.overlapsCircle(a, radius)) mismatches++;
+        if (floor.wallIndex.containsPoint(b) != freshIndex.containsPoint(b)) mismatches++;
+    }
+    return mismatches;
+}
+
+int main(int argc, char** argv) {
+    int zombieCount = argc > 1 ? atoi(argv[1]) : 10000;
+    int queries = argc > 2 ? atoi(argv[2]) : 4000;
+    uint64_t seed = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1;
+    if (zombieCount < 1) zombieCount = 1;
+    if (queries < 1) queries = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(1200.0f, 800.0f);
+    world.start(CreatePistol(), seed);
+    world.setHordeMode(true);
+    world.waveDirector.setConfig(WaveConfig::Horde(zombieCount));
+    world.floor.zombies.reserve(zombieCount);
+
+    // Hold still and let the horde arrive; nobody shoots, so nobody dies
+    PlayerInput input = { { 0, 0 }, { world.width, world.height / 2 }, false, false };
+    for (int i = 0; i < 1200 && (int)world.floor.zombies.size() < zombieCount; ++i) {
+        world.player.health = world.player.maxHealth;
+        world.step(TICK_SECONDS, input);
+    }
+    world.player.health = world.player.maxHealth;
+
+    WorldCheckpoint checkpoint;
+    SaveCheckpoint(world, checkpoint);
+    const std::vector<Rectangle>& before = checkpoint.walls;
+    int wallCount = (int)before.size();
+
+    // Scratch indices outside the world: one patched from the old layout, one built fresh
+    std::pmr::memory_resource* heap = std::pmr::new_delete_resource();
+    WallList scratchWalls(heap);
+    WallList freshWalls(heap);
+    WallIndex patchedIndex(heap), freshIndex(heap);
+    OccupancyGrid patchedGrid(heap), freshGrid(heap);
+
+    Rng rng(seed * 7919);
+    Timing plainStep, breakStep, patch, rebuild;
+    int notBroken = 0, mismatches = 0, piecesLeft = 0;
+
+    for (int w = 0; w < wallCount; ++w) {
+        // The same tick without a break, for reference
+        RestoreCheckpoint(world, checkpoint);
+        auto start = Clock::now();
+        world.step(TICK_SECONDS, input);
+        plainStep.add(ElapsedUs(start));
+
+        // One hit point left and a stopped bullet inside: this step breaks walls[w] at its center
+        RestoreCheckpoint(world, checkpoint);
+        const Rectangle& wall = before[w];
+        Vector2 center = { wall.x + wall.width / 2, wall.y + wall.height / 2 };
+        world.floor.wallHealth[w] = 1;
+        world.player.bullets.push_back(Bullet(center, { 0, 0 }, 1));
+        start = Clock::now();
+        world.step(TICK_SECONDS, input);
+        breakStep.add(ElapsedUs(start));
+
+        const WallList& after = world.floor.walls;
+        if ((int)after.size() == wallCount && SameRect(after[w], before[w])) {
+            notBroken++;
+            continue;
+        }
+        piecesLeft += (int)after.size() - wallCount + 1;
+
+        // The patch alone: indices of the old layout, updated over the old wall's extent (and the
+        // extent of the last wall when it was moved into the emptied slot)
+        scratchWalls.assign(before.begin(), before.end());
+        patchedIndex.build(scratchWalls, world.width, world.height);
+        patchedGrid.build(scratchWalls, world.width, world.height);
+        scratchWalls.assign(after.begin(), after.end());
+        start = Clock::now();
+        patchedIndex.updateRegion(wall);
+        patchedGrid.updateRegion(wall);
+        if ((int)after.size() < wallCount && w != wallCount - 1) {
+            patchedIndex.updateRegion(before.back());
+            patchedGrid.updateRegion(before.back());
+        }
+        patch.add(ElapsedUs(start));
+
+        // Against building both from scratch
+        freshWalls.assign(after.begin(), after.end());
+        start = Clock::now();
+        freshIndex.build(freshWalls, world.width, world.height);
+        freshGrid.build(freshWalls, world.width, world.height);
+        rebuild.add(ElapsedUs(start));
+
+        mismatches += CompareIndices(world, freshIndex, freshGrid, rng, queries);
+    }
+
+    int broken = wallCount - notBroken;
+    int divisor = broken > 0 ? broken : 1;
+    printf("Wall breaks: %d zombies, %d walls broken one at a time (%.1f pieces left per wall), seed %llu\n",
+           (int)checkpoint.zombies.size(), broken, (double)piecesLeft / divisor, (unsigned long long)seed);
+    printf("  Plain step:   %8.1f us mean, %8.1f us worst\n", plainStep.total / wallCount, plainStep.worst);
+    printf("  Break step:   %8.1f us mean, %8.1f us worst\n", breakStep.total / wallCount, breakStep.worst);
+    printf("  Index patch:  %8.2f us mean, %8.2f us worst (wall index + occupancy grid)\n", patch.total / divisor, patch.worst);
+    printf("  Full rebuild: %8.2f us mean, %8.2f us worst\n", rebuild.total / divisor, rebuild.worst);
+    if (notBroken > 0 || mismatches > 0) {
+        printf("FAILED: %d walls did not break, %d queries differ from freshly built indices\n", notBroken, mismatches);
+        return 1;
+    }
+    printf("  Patched indices match fresh builds on %d queries per break\n", queries * 3);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "WallIndex.h"
+#include "CellLists.h"
+#include <cmath>
+
+const float WallIndex::DEFAULT_CELL_SIZE = 64.0f;
+
+WallIndex::WallIndex(std::pmr::memory_resource* resource)
+    : walls(nullptr), cellSize(DEFAULT_CELL_SIZE), cols(0), rows(0),
+      cellStart(resource), cellWalls(resource) {}
+
+void WallIndex::build(const WallList& wallList, float worldWidth, float worldHeight, float newCellSize) {
+    walls = &wallList;
+    cellSize = newCellSize;
+    cols = (int)ceilf(worldWidth / cellSize);
+    rows = (int)ceilf(worldHeight / cellSize);
+    if (cols < 1) cols = 1;
+    if (rows < 1) rows = 1;
+
+    int cellCount = cols * rows;
+    cellStart.assign(cellCount + 1, 0);
+
+    // Pass 1: count walls per cell (stored shifted by one so the prefix sum yields start offsets)
+    for (const Rectangle& wall : wallList) {
+        int minCol, minRow, maxCol, maxRow;
+        if (!cellRange(wall, minCol, minRow, maxCol, maxRow)) continue;
+        for (int row = minRow; row <= maxRow; ++row)
+            for (int col = minCol; col <= maxCol; ++col)
+                cellStart[row * cols + col + 1]++;
+    }
+    for (int i = 0; i < cellCount; ++i) cellStart[i + 1] += cellStart[i];
+
+    // Pass 2: scatter wall indices into their cells
+    cellWalls.assign(cellStart[cellCount], 0);
+    std::pmr::vector<int> cursor(cellStart.begin(), cellStart.end() - 1, cellStart.get_allocator());
+    for (int w = 0; w < (int)wallList.size(); ++w) {
+        int minCol, minRow, maxCol, maxRow;
+        if (!cellRange(wallList[w], minCol, minRow, maxCol, maxRow)) continue;
+        for (int row = minRow; row <= maxRow; ++row)
+            for (int col = minCol; col <= maxCol; ++col)
+                cellWalls[cursor[row * cols + col]++] = w;
+    }
+}
+
+void WallIndex::updateRegion(Rectangle area) {
+    int minCol, minRow, maxCol, maxRow;
+    if (!walls || !cellRange(area, minCol, minRow, maxCol, maxRow)) return;
+    RelistCells(cellStart, cellWalls, cols, minCol, minRow, maxCol, maxRow, (int)walls->size(),
+                [&](int wall, int& wallMinCol, int& wallMinRow, int& wallMaxCol, int& wallMaxRow) {
+                    return cellRange((*walls)[wall], wallMinCol, wallMinRow, wallMaxCol, wallMaxRow);
+                });
+}
+
+void WallIndex::release() {
+    std::pmr::vector<int>(cellStart.get_allocator()).swap(cellStart);
+    std::pmr::vector<int>(cellWalls.get_allocator()).swap(cellWalls);
+    walls = nullptr;
+    cols = rows = 0;
+}
+
+bool WallIndex::cellRange(Rectangle area, int& minCol, int& minRow, int& maxCol, int& maxRow) const {
+    if (cols == 0 || rows == 0) return false;
+    minCol = (int)floorf(area.x / cellSize);
+    minRow = (int)floorf(area.y / cellSize);
+    maxCol = (int)floorf((area.x + area.width) / cellSize);
+    maxRow = (int)floorf((area.y + area.height) / cellSize);
+    if (maxCol < 0 || maxRow < 0 || minCol >= cols || minRow >= rows) return false;
+    if (minCol < 0) minCol = 0;
+    if (minRow < 0) minRow = 0;
+    if (maxCol >= cols) maxCol = cols - 1;
+    if (maxRow >= rows) maxRow = rows - 1;
+    return true;
+}
+
+bool WallIndex::overlapsCircle(Vector2 center, float radius) const {
+    bool hit = false;
+    Rectangle area = { center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f };
+    forEachWallNear(area, [&](const Rectangle& wall) {
+        if (!hit && CheckCollisionCircleRec(center, radius, wall)) hit = true;
+    });
+    return hit;
+}
+
+bool WallIndex::containsPoint(Vector2 point) const {
+    bool hit = false;
+    forEachWallNear({ point.x, point.y, 0, 0 }, [&](const Rectangle& wall) {
+        if (!hit && CheckCollisionPointRec(point, wall)) hit = true;
+    });
+    return hit;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "raylib.h"
+#include "FloorArena.h"
+#include <memory_resource>
+#include <vector>
+
+// Uniform-grid index over the floor's walls. Each cell lists the walls overlapping it
+// (compressed: one offsets array + one flat wall-index array), so point/circle queries
+// only test the few walls near the query instead of scanning the whole list.
+// Built once per floor right after the walls are generated and patched cell by cell when walls
+// break; storage comes from the floor arena.
+// The grid covers [0, worldWidth] x [0, worldHeight]: walls and queries entirely outside it see nothing.
+class WallIndex {
+public:
+    static const float DEFAULT_CELL_SIZE;
+
+    explicit WallIndex(std::pmr::memory_resource* resource);
+
+    void build(const WallList& walls, float worldWidth, float worldHeight, float cellSize = DEFAULT_CELL_SIZE);
+
+    // Re-lists the cells overlapping 'area' from the current wall list, after walls inside it broke
+    // (shrank, split or were removed; a wall moved to another index counts as changed at its extent).
+    // The result equals a fresh build().
+    void updateRegion(Rectangle area);
+
+    // Empties the index and hands its storage back before the arena is rewound
+    void release();
+
+    bool overlapsCircle(Vector2 center, float radius) const;
+    bool containsPoint(Vector2 point) const;
+
+    // Calls fn(const Rectangle&) for each wall listed in the cells overlapping 'area'.
+    // A wall spanning several cells may be visited more than once.
+    template <typename Fn>
+    void forEachWallNear(Rectangle area, Fn&& fn) const {
+        int minCol, minRow, maxCol, maxRow;
+        if (!cellRange(area, minCol, minRow, maxCol, maxRow)) return;
+        for (int row = minRow; row <= maxRow; ++row) {
+            for (int col = minCol; col <= maxCol; ++col) {
+                int cell = row * cols + col;
+                for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                    fn((*walls)[cellWalls[i]]);
+                }
+            }
+        }
+    }
+
+    int getCols() const { return cols; }
+    int getRows() const { return rows; }
+    float getCellSize() const { return cellSize; }
+
+private:
+    const WallList* walls;
+    float cellSize;
+    int cols;
+    int rows;
+    std::pmr::vector<int> cellStart; // cols*rows + 1 offsets into cellWalls
+    std::pmr::vector<int> cellWalls; // Wall indices, grouped by cell
+
+    // Clamps the cells touched by 'area' to the grid; false if it lies entirely outside
+    bool cellRange(Rectangle area, int& minCol, int& minRow, int& maxCol, int& maxRow) const;
+};
@@ -0,0 +1,117 @@
+#include "WaveDirector.h"
+#include "ZombieTypes.h"
+
+const float WaveDirector::SPAWN_MARGIN = 50.0f;
+const float WaveDirector::SPAWN_POINT_SPACING = 20.0f;
+const float WaveDirector::SPAWN_CLEARANCE = TankZombie::SIZE + SPAWN_POINT_SPACING; // Largest zombie + jitter reach
+
+WaveConfig WaveConfig::Standard(float spawnInterval, int maxAlive) {
+    WaveConfig config;
+    // With the archetypes' spawn weights the average spawn costs 1.5
+    config.budgetPerSecond = 1.5f / spawnInterval;
+    config.maxBudget = 2.0f; // Just enough for the dearest archetype: no bursts in normal play
+    config.maxAlive = maxAlive;
+    config.maxSpawnsPerTick = 1;
+    return config;
+}
+
+WaveConfig WaveConfig::Horde(int maxAlive) {
+    WaveConfig config;
+    config.budgetPerSecond = 20000.0f; // ~330 cost per 60 Hz tick
+    config.maxBudget = 1000.0f;
+    config.maxAlive = maxAlive;
+    config.maxSpawnsPerTick = 512;
+    return config;
+}
+
+WaveDirector::WaveDirector()
+    : config(WaveConfig::Standard(2.0f, 20)), budget(0.0f), nextKind(ZombieKind::Fast), nextZombieId(1), stats{ 0, 0, 0, 0 } {}
+
+void WaveDirector::setState(const State& state) {
+    config = state.config;
+    budget = state.budget;
+    nextKind = state.nextKind;
+    nextZombieId = state.nextZombieId;
+    stats = state.stats;
+}
+
+void WaveDirector::beginFloor(Floor& floor, float worldWidth, float worldHeight, Rng& rng) {
+    budget = 0.0f;
+    nextKind = rollKind(rng);
+    nextZombieId = 1;
+    stats = { 0, 0, 0, 0 };
+
+    // Ring of candidate points just off-screen; keep the ones with room for the largest zombie.
+    // The ring lies outside the world the wall index covers, so a wall out there would never be
+    // found through it: each point is checked against every wall, once per floor.
+    SpawnPointList& points = floor.spawnPoints;
+    points.clear();
+    int across = (int)(worldWidth / SPAWN_POINT_SPACING) + 1;
+    int down = (int)(worldHeight / SPAWN_POINT_SPACING) + 1;
+    points.reserve(2 * (across + down));
+
+    auto tryAdd = [&](Vector2 p) {
+        for (const Rectangle& wall : floor.walls) {
+            if (CheckCollisionCircleRec(p, SPAWN_CLEARANCE, wall)) return;
+        }
+        points.push_back(p);
+    };
+    for (int i = 0; i < across; ++i) {
+        float x = i * SPAWN_POINT_SPACING;
+        tryAdd({ x, -SPAWN_MARGIN });               // Top edge
+        tryAdd({ x, worldHeight + SPAWN_MARGIN }); // Bottom edge
+    }
+    for (int i = 0; i < down; ++i) {
+        float y = i * SPAWN_POINT_SPACING;
+        tryAdd({ -SPAWN_MARGIN, y });              // Left edge
+        tryAdd({ worldWidth + SPAWN_MARGIN, y }); // Right edge
+    }
+    stats.spawnPoints = (int)points.size();
+    if (points.empty()) {
+        TraceLog(LOG_WARNING, "WAVE DIRECTOR: floor %d has no valid spawn points", floor.number);
+    }
+
+    floor.zombies.reserve(config.maxAlive);
+}
+
+int WaveDirector::update(float deltaTime, Floor& floor, Rng& rng) {
+    budget += config.budgetPerSecond * deltaTime;
+    if (budget > config.maxBudget) budget = config.maxBudget;
+
+    ZombieList& zombies = floor.zombies;
+    const SpawnPointList& points = floor.spawnPoints;
+    int lastPoint = (int)points.size() - 1;
+    int jitter = (int)(SPAWN_POINT_SPACING / 2);
+
+    int spawned = 0;
+    while (lastPoint >= 0 && spawned < config.maxSpawnsPerTick && (int)zombies.size() < config.maxAlive
+           && budget >= ZOMBIE_ARCHETYPES[(int)nextKind].spawnCost) {
+        Vector2 spawnPos = points[rng.range(0, lastPoint)];
+        // Spread a burst around the point so hundreds of spawns don't stack on one pixel
+        spawnPos.x += (float)rng.range(-jitter, jitter);
+        spawnPos.y += (float)rng.range(-jitter, jitter);
+
+        zombies.push_back(MakeZombie(nextKind, spawnPos));
+        zombies.back().id = nextZombieId++;
+
+        budget -= ZOMBIE_ARCHETYPES[(int)nextKind].spawnCost;
+        nextKind = rollKind(rng);
+        spawned++;
+    }
+
+    stats.lastBurst = spawned;
+    if (spawned > stats.peakBurst) stats.peakBurst = spawned;
+    stats.totalSpawned += spawned;
+    return spawned;
+}
+
+ZombieKind WaveDirector::rollKind(Rng& rng) {
+    int totalWeight = 0;
+    for (const ZombieArchetype& archetype : ZOMBIE_ARCHETYPES) totalWeight += archetype.spawnWeight;
+    int roll = rng.range(0, totalWeight - 1);
+    for (int kind = 0; kind < ZOMBIE_KIND_COUNT - 1; ++kind) {
+        if (roll < ZOMBIE_ARCHETYPES[kind].spawnWeight) return (ZombieKind)kind;
+        roll -= ZOMBIE_ARCHETYPES[kind].spawnWeight;
+    }
+    return (ZombieKind)(ZOMBIE_KIND_COUNT - 1);
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "raylib.h"
+#include "Floor.h"
+#include "Rng.h"
+#include <cstdint>
+
+// Tuning for one floor's spawning. Spawning is paid for out of a budget that refills every
+// second; each zombie archetype has a cost (ZombieTypes.h), and one tick spends as much of the budget as it can,
+// so a large budget turns into a burst of hundreds of spawns in a single tick.
+struct WaveConfig {
+    float budgetPerSecond;  // Spawn cost earned per second
+    float maxBudget;        // Unspent budget is capped here so a long stall can't bank an unbounded burst
+    int maxAlive;           // Live zombie cap; this much zombie capacity is reserved when the floor starts
+    int maxSpawnsPerTick;   // Hard cap on a single tick's burst
+
+    // One zombie every 'spawnInterval' seconds on average, never more than one at a time
+    static WaveConfig Standard(float spawnInterval, int maxAlive);
+    // Stress preset: fills up to 'maxAlive' zombies in a few seconds of large bursts
+    static WaveConfig Horde(int maxAlive);
+};
+
+class WaveDirector {
+public:
+    struct Stats {
+        int spawnPoints; // Valid spawn points of the current floor
+        int lastBurst;   // Zombies spawned by the last update()
+        int peakBurst;   // Largest burst this floor
+        int totalSpawned;
+    };
+
+    static const float SPAWN_MARGIN;        // How far off-screen the spawn ring sits
+    static const float SPAWN_POINT_SPACING; // Distance between neighbouring spawn points
+    static const float SPAWN_CLEARANCE;     // Radius that must be free of walls (largest zombie + jitter)
+
+    WaveDirector();
+
+    void setConfig(const WaveConfig& newConfig) { config = newConfig; }
+    const WaveConfig& getConfig() const { return config; }
+
+    // Computes the floor's valid spawn points once (against floor.walls) and reserves
+    // zombie capacity for config.maxAlive, so spawning never searches or reallocates mid-floor.
+    void beginFloor(Floor& floor, float worldWidth, float worldHeight, Rng& rng);
+
+    // Earns budget for 'deltaTime' and spends it on spawns. Returns how many zombies were spawned.
+    int update(float deltaTime, Floor& floor, Rng& rng);
+
+    const Stats& getStats() const { return stats; }
+
+    // Everything update() carries from tick to tick, for world checkpoints (WorldCheckpoint.h)
+    struct State {
+        WaveConfig config;
+        float budget;
+        ZombieKind nextKind;
+        uint32_t nextZombieId;
+        Stats stats;
+    };
+    State getState() const { return { config, budget, nextKind, nextZombieId, stats }; }
+    void setState(const State& state);
+
+private:
+    WaveConfig config;
+    float budget;
+    ZombieKind nextKind; // Archetype of the next zombie, rolled ahead so an unaffordable one waits for its budget
+    uint32_t nextZombieId; // Ids increase in spawn order, so a floor's zombie list stays sorted by id
+    Stats stats;
+
+    // Picks an archetype with odds proportional to their SPAWN_WEIGHT
+    static ZombieKind rollKind(Rng& rng);
+};
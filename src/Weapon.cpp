@@ -1,6 +1,9 @@
 #include "raylib.h"      // <-- Always include raylib.h for its functions
 #include "Weapon.h"      // For Weapon class and WeaponType enum declarations
 #include "raymath.h"     // For Vector2 utilities
+#include "Renderer.h"    // Draw calls go through the render-command interface
+#include <algorithm>     // For std::max
+#include <cmath>         // For std::floor
 #include <utility>       // For std::move
 
 // --- IMPORTANT: Icon drawing function DEFINITIONS DO NOT BELONG IN THIS FILE. ---
@@ -8,9 +11,13 @@
 
 // Weapon constructor: Initializes weapon properties and loads its specific firing sound
 Weapon::Weapon(float fireRate, float bulletSpeed, int damage, WeaponType type)
-    : fireRate(fireRate), bulletSpeed(bulletSpeed), damage(damage), type(type), lastFireTime(0.0f) {
+    : type(type), fireRate(fireRate), lastFireTime(0.0f), triggerHeld(false), bulletSpeed(bulletSpeed), damage(damage),
+      hitscan(false), penetration(0), range(0.0f), blastRadius(0.0f), fuse(0.0f) {
     
-    fireSound = { 0 }; // Initialize fireSound to an empty/null sound initially
+    fireSound = {}; // Initialize fireSound to an empty/null sound initially
+
+    // Headless runs (benchmarks, server) never open an audio device; the weapon then stays silent
+    if (!IsAudioDeviceReady()) return;
 
     // Load the appropriate sound file based on the weapon type
     switch (type) {
@@ -29,6 +36,24 @@ Weapon::Weapon(float fireRate, float bulletSpeed, int damage, WeaponType type)
             fireSound = LoadSound("./assets/audio/rifle_fire.wav");
             SetSoundVolume(fireSound, 0.6f); 
             break;
+        case WeaponType::Railgun:
+            // No sample of its own yet: the rifle shot, louder and pitched down
+            fireSound = LoadSound("./assets/audio/rifle_fire.wav");
+            SetSoundVolume(fireSound, 0.9f);
+            SetSoundPitch(fireSound, 0.6f);
+            break;
+        case WeaponType::Launcher:
+            // Likewise borrowed: a dull, low shotgun thump
+            fireSound = LoadSound("./assets/audio/shotgun_fire.wav");
+            SetSoundVolume(fireSound, 0.6f);
+            SetSoundPitch(fireSound, 0.5f);
+            break;
+        case WeaponType::Minigun:
+            // A quiet, quick rifle crack: it plays twenty times a second
+            fireSound = LoadSound("./assets/audio/rifle_fire.wav");
+            SetSoundVolume(fireSound, 0.3f);
+            SetSoundPitch(fireSound, 1.4f);
+            break;
         default:
             TraceLog(LOG_WARNING, "WEAPON: Unknown weapon type created, no specific fire sound loaded.");
             break;
@@ -37,11 +62,13 @@ Weapon::Weapon(float fireRate, float bulletSpeed, int damage, WeaponType type)
 
 // Move constructor: "Steals" the resources from another Weapon object
 Weapon::Weapon(Weapon&& other) noexcept
-    : type(other.type), fireRate(other.fireRate), lastFireTime(other.lastFireTime), 
-      bulletSpeed(other.bulletSpeed), damage(other.damage), fireSound(other.fireSound) {
+    : type(other.type), fireRate(other.fireRate), lastFireTime(other.lastFireTime),
+      triggerHeld(other.triggerHeld), bulletSpeed(other.bulletSpeed), damage(other.damage), hitscan(other.hitscan),
+      penetration(other.penetration), range(other.range), blastRadius(other.blastRadius),
+      fuse(other.fuse), fireSound(other.fireSound) {
     
     // After moving, set the original's sound to {0} so its destructor doesn't unload it
-    other.fireSound = { 0 }; 
+    other.fireSound = {}; 
 }
 
 // Move assignment operator: Handles moving resources when assigning one Weapon to another
@@ -56,12 +83,18 @@ Weapon& Weapon::operator=(Weapon&& other) noexcept {
         type = other.type;
         fireRate = other.fireRate;
         lastFireTime = other.lastFireTime;
+        triggerHeld = other.triggerHeld;
         bulletSpeed = other.bulletSpeed;
         damage = other.damage;
+        hitscan = other.hitscan;
+        penetration = other.penetration;
+        range = other.range;
+        blastRadius = other.blastRadius;
+        fuse = other.fuse;
         fireSound = other.fireSound;
 
         // Clear 'other' so its destructor doesn't free the moved resource
-        other.fireSound = { 0 };
+        other.fireSound = {};
     }
     return *this;
 }
@@ -74,26 +107,32 @@ Weapon::~Weapon() {
     }
 }
 
-// Method to check if the weapon can fire based on its fire rate
-bool Weapon::canFire(float currentTime) {
-    if (currentTime - lastFireTime >= 1.0f / fireRate) {
-        lastFireTime = currentTime;
-        return true;
+// Shots due within one step of held fire, timed on the fire rate's own grid
+int Weapon::pullTrigger(float stepStart, float pressTime, float stepEnd, float* shotTimes, int maxShots) {
+    float interval = 1.0f / fireRate;
+    float due = std::max(lastFireTime + interval, triggerHeld ? stepStart : pressTime);
+    triggerHeld = true;
+
+    int shots = 0;
+    for (; due <= stepEnd && shots < maxShots; due += interval) {
+        shotTimes[shots++] = due;
+        lastFireTime = due;
     }
-    return false;
+    if (due <= stepEnd) lastFireTime += interval * std::floor((stepEnd - lastFireTime) / interval); // Skip the rest
+    return shots;
 }
 
 // Method to play the weapon's firing sound
 void Weapon::playFireSound() const {
     if (fireSound.frameCount > 0) { // Check if the sound resource is valid before playing
         PlaySound(fireSound);
-    } else {
+    } else if (IsAudioDeviceReady()) { // Silent by design when running without audio
         TraceLog(LOG_WARNING, "WEAPON: Attempted to play an unloaded or invalid sound for weapon type %d", (int)type);
     }
 }
 
 // Method to draw the weapon on screen, considering player position and facing direction
-void Weapon::draw(Vector2 playerPos, Vector2 facing) const {
+void Weapon::draw(Renderer& renderer, Vector2 playerPos, Vector2 facing) const {
     Vector2 normFacing = Vector2Normalize(facing);
     float angle = atan2f(normFacing.y, normFacing.x) * RAD2DEG;
 
@@ -109,27 +148,27 @@ void Weapon::draw(Vector2 playerPos, Vector2 facing) const {
             // Main body/slide
             width = 30; height = 8;
             rectPos = Vector2Subtract(weaponPivot, Vector2Scale(normFacing, 0)); // Align with pivot
-            DrawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, GRAY);
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, GRAY);
 
             // Barrel
             width = 10; height = 6;
             rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 30));
-            DrawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKGRAY);
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKGRAY);
 
             // Grip (angled for ergonomic feel)
             width = 10; height = 20;
             rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -10));
-            DrawRectanglePro({rectPos.x - width/2, rectPos.y - height/2, width, height}, {width/2, height/2}, angle + 15, BLACK);
+            renderer.drawRectanglePro({rectPos.x - width/2, rectPos.y - height/2, width, height}, {width/2, height/2}, angle + 15, BLACK);
 
             // Trigger Guard
             width = 5; height = 10;
             Vector2 triggerGuardPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 8)); // Pos relative to weaponPivot
-            DrawRectanglePro({triggerGuardPos.x - width/2, triggerGuardPos.y - height/2, width, height}, {width/2, height/2}, angle, DARKGRAY);
+            renderer.drawRectanglePro({triggerGuardPos.x - width/2, triggerGuardPos.y - height/2, width, height}, {width/2, height/2}, angle, DARKGRAY);
 
             // Hammer (small detail at the back)
             width = 3; height = 5;
             Vector2 hammerPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -5));
-            DrawRectanglePro({hammerPos.x - width/2, hammerPos.y - height/2, width, height}, {width/2, height/2}, angle, LIGHTGRAY);
+            renderer.drawRectanglePro({hammerPos.x - width/2, hammerPos.y - height/2, width, height}, {width/2, height/2}, angle, LIGHTGRAY);
             break;
         }
         case WeaponType::Shotgun: {
@@ -139,33 +178,33 @@ void Weapon::draw(Vector2 playerPos, Vector2 facing) const {
             // Receiver / Pump action body
             width = 45; height = 10;
             rectPos = Vector2Subtract(weaponPivot, Vector2Scale(normFacing, 0));
-            DrawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, BROWN);
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, BROWN);
 
             // Barrel (long and thin)
             width = 25; height = 6;
             rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 45));
-            DrawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKBROWN);
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKBROWN);
 
             // Pump action foregrip
             width = 15; height = 8;
             rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 25));
-            DrawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, BROWN);
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, BROWN);
 
             // Stock (more defined shape)
             width = 20; height = 15;
             Vector2 stockBase = Vector2Add(weaponPivot, Vector2Scale(normFacing, -30));
-            DrawRectanglePro({stockBase.x - width/2, stockBase.y - height/2, width, height}, {width/2, height/2}, angle - 5, DARKBROWN);
+            renderer.drawRectanglePro({stockBase.x - width/2, stockBase.y - height/2, width, height}, {width/2, height/2}, angle - 5, DARKBROWN);
 
             // Connecting part of stock (simpler rectangle aligned with receiver)
             width = 20; height = 8;
             rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -10)); // Position it between stockBase and receiver
-            DrawRectanglePro({rectPos.x - width/2, rectPos.y - height/2, width, height}, {width/2, height/2}, angle, BROWN);
+            renderer.drawRectanglePro({rectPos.x - width/2, rectPos.y - height/2, width, height}, {width/2, height/2}, angle, BROWN);
 
 
             // Muzzle break / Choke (slightly wider end)
             width = 5; height = 8;
             Vector2 muzzlePos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 65));
-            DrawRectanglePro({muzzlePos.x - width/2, muzzlePos.y - height/2, width, height}, {width/2, height/2}, angle, GRAY);
+            renderer.drawRectanglePro({muzzlePos.x - width/2, muzzlePos.y - height/2, width, height}, {width/2, height/2}, angle, GRAY);
             break;
         }
         case WeaponType::Rifle: {
@@ -175,34 +214,126 @@ void Weapon::draw(Vector2 playerPos, Vector2 facing) const {
             // Receiver / Main Body
             width = 50; height = 8;
             rectPos = Vector2Subtract(weaponPivot, Vector2Scale(normFacing, 0));
-            DrawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKGREEN);
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKGREEN);
 
             // Barrel (long and slender)
             width = 40; height = 5;
             rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 50));
-            DrawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, BLACK);
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, BLACK);
 
             // Magazine (protruding downwards)
             width = 8; height = 25;
             Vector2 magOffset = Vector2Add(weaponPivot, Vector2Scale(normFacing, 10));
-            DrawRectanglePro({magOffset.x - width/2, magOffset.y - height/2, width, height}, {width/2, height/2}, angle + 90, DARKGRAY);
+            renderer.drawRectanglePro({magOffset.x - width/2, magOffset.y - height/2, width, height}, {width/2, height/2}, angle + 90, DARKGRAY);
 
             // Scope
             width = 25; height = 6;
             Vector2 scopeBase = Vector2Add(weaponPivot, Vector2Scale(normFacing, 15));
-            DrawRectanglePro({scopeBase.x - width/2, scopeBase.y - height/2, width, height}, {width/2, height/2}, angle, GRAY); // Scope body
-            DrawCircleV(Vector2Add(scopeBase, Vector2Scale(normFacing, 20)), 4, BLACK); // Front lens
-            DrawCircleV(Vector2Add(scopeBase, Vector2Scale(normFacing, -5)), 3, BLACK); // Back lens
+            renderer.drawRectanglePro({scopeBase.x - width/2, scopeBase.y - height/2, width, height}, {width/2, height/2}, angle, GRAY); // Scope body
+            renderer.drawCircle(Vector2Add(scopeBase, Vector2Scale(normFacing, 20)), 4, BLACK); // Front lens
+            renderer.drawCircle(Vector2Add(scopeBase, Vector2Scale(normFacing, -5)), 3, BLACK); // Back lens
 
             // Stock
             width = 30; height = 10;
             Vector2 stockPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -30));
-            DrawRectanglePro({stockPos.x - width/2, stockPos.y - height/2, width, height}, {width/2, height/2}, angle + 3, DARKGREEN);
+            renderer.drawRectanglePro({stockPos.x - width/2, stockPos.y - height/2, width, height}, {width/2, height/2}, angle + 3, DARKGREEN);
 
             // Pistol Grip (angled for comfort)
             width = 10; height = 20;
             Vector2 pistolGripPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -5));
-            DrawRectanglePro({pistolGripPos.x - width/2, pistolGripPos.y - height/2, width, height}, {width/2, height/2}, angle + 20, BLACK);
+            renderer.drawRectanglePro({pistolGripPos.x - width/2, pistolGripPos.y - height/2, width, height}, {width/2, height/2}, angle + 20, BLACK);
+            break;
+        }
+        case WeaponType::Railgun: {
+            float width, height;
+            Vector2 rectPos;
+
+            // Body
+            width = 55; height = 10;
+            rectPos = Vector2Subtract(weaponPivot, Vector2Scale(normFacing, 0));
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKBLUE);
+
+            // Twin rails
+            width = 40; height = 3;
+            rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 55));
+            Vector2 side = { -normFacing.y * 3, normFacing.x * 3 };
+            renderer.drawRectanglePro({rectPos.x + side.x, rectPos.y + side.y - height/2, width, height}, {0, height/2}, angle, LIGHTGRAY);
+            renderer.drawRectanglePro({rectPos.x - side.x, rectPos.y - side.y - height/2, width, height}, {0, height/2}, angle, LIGHTGRAY);
+
+            // Charge coils
+            for (int i = 0; i < 3; ++i) {
+                renderer.drawCircle(Vector2Add(weaponPivot, Vector2Scale(normFacing, 15.0f + i * 12.0f)), 4, SKYBLUE);
+            }
+
+            // Stock
+            width = 25; height = 10;
+            Vector2 stockPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -25));
+            renderer.drawRectanglePro({stockPos.x - width/2, stockPos.y - height/2, width, height}, {width/2, height/2}, angle, DARKBLUE);
+
+            // Grip
+            width = 10; height = 20;
+            Vector2 gripPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -5));
+            renderer.drawRectanglePro({gripPos.x - width/2, gripPos.y - height/2, width, height}, {width/2, height/2}, angle + 20, BLACK);
+            break;
+        }
+        case WeaponType::Launcher: {
+            float width, height;
+            Vector2 rectPos;
+
+            // Wide, short tube
+            width = 45; height = 14;
+            rectPos = Vector2Subtract(weaponPivot, Vector2Scale(normFacing, 0));
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKGREEN);
+
+            // Muzzle ring
+            width = 6; height = 16;
+            rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 45));
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, BLACK);
+
+            // Drum magazine
+            renderer.drawCircle(Vector2Add(weaponPivot, Vector2Scale(normFacing, 15)), 9, DARKGRAY);
+            renderer.drawCircle(Vector2Add(weaponPivot, Vector2Scale(normFacing, 15)), 4, GRAY);
+
+            // Stock
+            width = 20; height = 10;
+            Vector2 stockPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -20));
+            renderer.drawRectanglePro({stockPos.x - width/2, stockPos.y - height/2, width, height}, {width/2, height/2}, angle, BROWN);
+
+            // Grip
+            width = 10; height = 20;
+            Vector2 gripPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -5));
+            renderer.drawRectanglePro({gripPos.x - width/2, gripPos.y - height/2, width, height}, {width/2, height/2}, angle + 20, BLACK);
+            break;
+        }
+        case WeaponType::Minigun: {
+            float width, height;
+            Vector2 rectPos;
+
+            // Motor housing
+            width = 30; height = 14;
+            rectPos = Vector2Subtract(weaponPivot, Vector2Scale(normFacing, 0));
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, DARKGRAY);
+
+            // Barrel cluster: three barrels side by side
+            width = 40; height = 3;
+            rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 30));
+            for (int i = -1; i <= 1; ++i) {
+                Vector2 side = { -normFacing.y * 4.0f * i, normFacing.x * 4.0f * i };
+                renderer.drawRectanglePro({rectPos.x + side.x, rectPos.y + side.y - height/2, width, height}, {0, height/2}, angle, GRAY);
+            }
+
+            // Barrel clamp
+            width = 5; height = 14;
+            rectPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, 55));
+            renderer.drawRectanglePro({rectPos.x, rectPos.y - height/2, width, height}, {0, height/2}, angle, BLACK);
+
+            // Ammo box
+            renderer.drawCircle(Vector2Add(weaponPivot, Vector2Scale(normFacing, 8)), 7, DARKGREEN);
+
+            // Grip
+            width = 10; height = 20;
+            Vector2 gripPos = Vector2Add(weaponPivot, Vector2Scale(normFacing, -5));
+            renderer.drawRectanglePro({gripPos.x - width/2, gripPos.y - height/2, width, height}, {width/2, height/2}, angle + 20, BLACK);
             break;
         }
     }
@@ -4,12 +4,18 @@
 #include "raylib.h" // Essential for 'Sound' type
 #include "raymath.h" // Essential for Vector2
 
+class Renderer;
+
 // Enum definition: Declares the types of weapons
 enum class WeaponType {
     Pistol,
     Shotgun,
-    Rifle
+    Rifle,
+    Railgun,
+    Launcher,
+    Minigun
 };
+constexpr int WEAPON_TYPE_COUNT = 6;
 
 // Weapon class declaration: Declares the structure and methods of a Weapon object
 class Weapon {
@@ -30,17 +36,37 @@ public:
     // Destructor (crucial for freeing loaded sounds when the LAST owner goes out of scope)
     ~Weapon(); 
 
+    // Fire timing, called once per step while the trigger is held (see World::step). Fills
+    // 'shotTimes' with the shots due in the step, oldest first, and returns how many: one every
+    // 1/fireRate seconds after the last shot, the first no earlier than 'pressTime' (or the step's
+    // start when the trigger was already held at the end of the last step). lastFireTime moves to
+    // the last shot's due time rather than to 'stepEnd', so the rest of the interval carries into
+    // the next step and the fire rate holds at any tick rate. Shots beyond 'maxShots' are skipped,
+    // not owed to later steps.
+    int pullTrigger(float stepStart, float pressTime, float stepEnd, float* shotTimes, int maxShots);
+    void releaseTrigger() { triggerHeld = false; }
+
     // Method declarations
-    bool canFire(float currentTime);
-    void draw(Vector2 playerPos, Vector2 facing) const;
+    void draw(Renderer& renderer, Vector2 playerPos, Vector2 facing) const;
     void playFireSound() const; 
 
     // Member variables
     WeaponType type;
     float fireRate;
     float lastFireTime;
+    bool triggerHeld; // Held at the end of the last step: the next step's shots may start at its start
     float bulletSpeed;
     int damage;
+
+    // Hitscan weapons fire no Bullet: the World resolves each shot instantly along a ray
+    bool hitscan;
+    int penetration; // Zombies a hitscan shot passes through before it stops (0: only the first one)
+    float range;     // Hitscan reach in pixels
+
+    // Explosive weapons fire rounds that detonate (see Bullet) instead of hitting one zombie
+    float blastRadius; // 0 for plain bullets
+    float fuse;        // Seconds before an explosive round that hit nothing goes off
+
     Sound fireSound; // Declares the Sound object for firing audio
 };
 
@@ -14,6 +14,48 @@ Weapon CreateRifle() {
     return Weapon(5.0f, 800.0f, 15, WeaponType::Rifle);
 }
 
+Weapon CreateRailgun() {
+    Weapon railgun(0.8f, 0.0f, 120, WeaponType::Railgun);
+    railgun.hitscan = true;
+    railgun.penetration = 3;
+    railgun.range = 1400.0f;
+    return railgun;
+}
+
+Weapon CreateLauncher() {
+    Weapon launcher(0.7f, 450.0f, 80, WeaponType::Launcher);
+    launcher.blastRadius = 110.0f;
+    launcher.fuse = 1.2f; // About 540 px of flight
+    return launcher;
+}
+
+Weapon CreateMinigun() {
+    return Weapon(20.0f, 900.0f, 5, WeaponType::Minigun);
+}
+
+Weapon CreateWeapon(WeaponType type) {
+    switch (type) {
+        case WeaponType::Shotgun: return CreateShotgun();
+        case WeaponType::Rifle: return CreateRifle();
+        case WeaponType::Railgun: return CreateRailgun();
+        case WeaponType::Launcher: return CreateLauncher();
+        case WeaponType::Minigun: return CreateMinigun();
+        default: return CreatePistol();
+    }
+}
+
+const char* GetWeaponName(WeaponType type) {
+    switch (type) {
+        case WeaponType::Pistol: return "Pistol";
+        case WeaponType::Shotgun: return "Shotgun";
+        case WeaponType::Rifle: return "Rifle";
+        case WeaponType::Railgun: return "Railgun";
+        case WeaponType::Launcher: return "Launcher";
+        case WeaponType::Minigun: return "Minigun";
+        default: return "Unknown";
+    }
+}
+
 void DrawPistolIcon(int x, int y) {
     Vector2 basePos = {(float)x, (float)y};
     float scale = 0.8f; // Adjust scale for icons if needed
@@ -63,4 +105,58 @@ void DrawRifleIcon(int x, int y) {
     DrawRectanglePro({basePos.x - 5 * scale, basePos.y + 10 * scale, 35 * scale, 10 * scale}, {0,0}, 3, DARKGREEN);
     // Pistol Grip
     DrawRectanglePro({basePos.x + 5 * scale, basePos.y + 15 * scale, 10 * scale, 20 * scale}, {0,0}, 20, BLACK);
-}
\ No newline at end of file
+}
+
+void DrawRailgunIcon(int x, int y) {
+    Vector2 basePos = {(float)x, (float)y};
+    float scale = 0.8f;
+
+    // Body
+    DrawRectangle(basePos.x, basePos.y + 7 * scale, 60 * scale, 10 * scale, DARKBLUE);
+    // Twin rails
+    DrawRectangle(basePos.x + 60 * scale, basePos.y + 7 * scale, 35 * scale, 3 * scale, LIGHTGRAY);
+    DrawRectangle(basePos.x + 60 * scale, basePos.y + 14 * scale, 35 * scale, 3 * scale, LIGHTGRAY);
+    // Charge coils
+    for (int i = 0; i < 3; ++i) {
+        DrawCircle(basePos.x + (18 + i * 12) * scale, basePos.y + 12 * scale, 4 * scale, SKYBLUE);
+    }
+    // Stock
+    DrawRectanglePro({basePos.x - 5 * scale, basePos.y + 9 * scale, 30 * scale, 10 * scale}, {0,0}, 3, DARKBLUE);
+    // Grip
+    DrawRectanglePro({basePos.x + 5 * scale, basePos.y + 15 * scale, 10 * scale, 20 * scale}, {0,0}, 20, BLACK);
+}
+
+void DrawLauncherIcon(int x, int y) {
+    Vector2 basePos = {(float)x, (float)y};
+    float scale = 0.8f;
+
+    // Tube
+    DrawRectangle(basePos.x, basePos.y + 4 * scale, 55 * scale, 14 * scale, DARKGREEN);
+    // Muzzle ring
+    DrawRectangle(basePos.x + 55 * scale, basePos.y + 3 * scale, 6 * scale, 16 * scale, BLACK);
+    // Drum magazine
+    DrawCircle(basePos.x + 22 * scale, basePos.y + 20 * scale, 9 * scale, DARKGRAY);
+    DrawCircle(basePos.x + 22 * scale, basePos.y + 20 * scale, 4 * scale, GRAY);
+    // Stock
+    DrawRectanglePro({basePos.x - 15 * scale, basePos.y + 7 * scale, 20 * scale, 10 * scale}, {0,0}, 3, BROWN);
+    // Grip
+    DrawRectanglePro({basePos.x + 5 * scale, basePos.y + 15 * scale, 10 * scale, 20 * scale}, {0,0}, 20, BLACK);
+}
+
+void DrawMinigunIcon(int x, int y) {
+    Vector2 basePos = {(float)x, (float)y};
+    float scale = 0.8f;
+
+    // Motor housing
+    DrawRectangle(basePos.x, basePos.y + 5 * scale, 35 * scale, 14 * scale, DARKGRAY);
+    // Barrel cluster
+    for (int i = 0; i < 3; ++i) {
+        DrawRectangle(basePos.x + 35 * scale, basePos.y + (6 + i * 4) * scale, 45 * scale, 3 * scale, GRAY);
+    }
+    // Barrel clamp
+    DrawRectangle(basePos.x + 62 * scale, basePos.y + 4 * scale, 5 * scale, 16 * scale, BLACK);
+    // Ammo box
+    DrawRectangle(basePos.x + 8 * scale, basePos.y + 19 * scale, 16 * scale, 12 * scale, DARKGREEN);
+    // Grip
+    DrawRectanglePro({basePos.x + 28 * scale, basePos.y + 15 * scale, 10 * scale, 20 * scale}, {0,0}, 20, BLACK);
+}
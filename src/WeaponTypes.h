@@ -6,8 +6,18 @@
 Weapon CreatePistol();
 Weapon CreateShotgun();
 Weapon CreateRifle();
+Weapon CreateRailgun(); // Hitscan: resolved instantly, pierces several zombies
+Weapon CreateLauncher(); // Explosive rounds: blast damage with falloff
+Weapon CreateMinigun(); // Fires faster than the frame rate: several shots per step
+Weapon CreateWeapon(WeaponType type);
+
+// Display name for HUD/UI text
+const char* GetWeaponName(WeaponType type);
 
 // Drawing functions for weapon icons
 void DrawPistolIcon(int x, int y);
 void DrawShotgunIcon(int x, int y);
 void DrawRifleIcon(int x, int y);
+void DrawRailgunIcon(int x, int y);
+void DrawLauncherIcon(int x, int y);
+void DrawMinigunIcon(int x, int y);
@@ -0,0 +1,417 @@
+#include "World.h"
+#include "WeaponTypes.h"
+#include "CollisionUtils.h"
+#include "raymath.h"
+#include <algorithm>
+#include <limits>
+#include <utility> // For std::move
+
+const int World::MAX_FLOORS = 3;
+const int World::ZOMBIES_PER_FLOOR = 20;
+const int World::HORDE_MAX_ALIVE = 10000;
+const int World::WALLS_PER_FLOOR = 14;
+const float World::PLAYER_MOVE_SPEED = 200.0f;
+const float World::INITIAL_SPAWN_INTERVAL = 2.0f;
+const float World::BLAST_RIM_DAMAGE = 0.25f;
+const float World::WALL_BREACH_WIDTH = 50.0f;
+const float World::WALL_MIN_FRAGMENT = 30.0f;
+const float World::CONTACT_DAMAGE_PER_SECOND = 20.0f;
+const int World::MAX_SHOTS_PER_STEP = 32;
+
+World::World(float width, float height, size_t floorArenaBytes)
+    : width(width), height(height), rng(), floor(floorArenaBytes),
+      player({ width / 2, height / 2 }, { 1, 0 }, 20.0f, 100, CreatePistol()),
+      currentFloor(0), zombiesKilled(0), spawnInterval(INITIAL_SPAWN_INTERVAL),
+      time(0.0f), ticks(0), hordeMode(false), farZombieUpdateStride(1), status(Status::PLAYING) {}
+
+void World::start(Weapon&& weapon, uint64_t seed) {
+    rng.seed(seed);
+    player = Player({ width / 2, height / 2 }, { 1, 0 }, 20.0f, 100, std::move(weapon));
+    time = 0.0f;
+    ticks = 0;
+    player.weapon.lastFireTime = -1.0f / player.weapon.fireRate; // Ready to fire on the first tick
+
+    currentFloor = 1;
+    spawnInterval = INITIAL_SPAWN_INTERVAL;
+    zombiesKilled = 0;
+    status = Status::PLAYING;
+    explosions.clear();
+    wallChanges.clear();
+    wallHits.clear();
+    setupFloor();
+}
+
+int World::controlPlayer(Player& player, const PlayerInput& input, float deltaTime, float stepEnd, const Floor& floor,
+                         float* shotTimes) {
+    // Movement, blocked by walls
+    Vector2 move = input.move;
+    if (Vector2Length(move) > 0) move = Vector2Normalize(move); // Normalize diagonal movement
+    Vector2 newPlayerPos = Vector2Add(player.pos, Vector2Scale(move, PLAYER_MOVE_SPEED * deltaTime));
+    if (!CollidesWithWallCircle(newPlayerPos, player.size, floor.walls)) {
+        player.pos = newPlayerPos;
+    }
+
+    // Face the aim point (keep the old facing when aiming at the player itself)
+    Vector2 toAim = Vector2Subtract(input.aim, player.pos);
+    if (Vector2Length(toAim) > 0) player.facing = Vector2Normalize(toAim);
+
+    if (input.dash) player.dash(Vector2Length(move) > 0 ? move : player.facing);
+    // Hugging a wall can put the muzzle inside it; hold fire rather than spawn a bullet in the wall
+    if (input.fire && floor.occupancy.lineOfSight(player.pos, player.getMuzzlePosition())) {
+        float pressTime = stepEnd - std::min(std::max(input.fireLead, 0.0f), deltaTime);
+        return player.weapon.pullTrigger(stepEnd - deltaTime, pressTime, stepEnd, shotTimes, MAX_SHOTS_PER_STEP);
+    }
+    player.weapon.releaseTrigger();
+    return 0;
+}
+
+void World::updatePlayer(Player& player, float deltaTime, ZombieList& zombies, const ZombieGrid& zombieGrid,
+                         const WallList& walls, Vector2 worldSize) {
+    // A dash moves the player on its own, so undo it if it ends in a wall
+    Vector2 posBeforeUpdate = player.pos;
+    player.update(deltaTime, zombies, zombieGrid, walls, worldSize);
+    if (CollidesWithWallCircle(player.pos, player.size, walls)) player.pos = posBeforeUpdate;
+}
+
+void World::setHordeMode(bool enabled) {
+    hordeMode = enabled;
+    waveDirector.setConfig(currentWaveConfig());
+    floor.zombies.reserve(waveDirector.getConfig().maxAlive);
+}
+
+WaveConfig World::currentWaveConfig() const {
+    return hordeMode ? WaveConfig::Horde(HORDE_MAX_ALIVE) : WaveConfig::Standard(spawnInterval, ZOMBIES_PER_FLOOR);
+}
+
+void World::setupFloor() {
+    floor.reset(currentFloor); // Drop the old floor's data and rewind its arena in one step
+    enemyProjectiles.clear();
+    createWalls(WALLS_PER_FLOOR);
+    for (const Rectangle& wall : floor.walls) floor.wallHealth.push_back(Floor::maxWallHealth(wall));
+    floor.wallIndex.build(floor.walls, width, height);
+    floor.occupancy.build(floor.walls, width, height);
+    waveDirector.setConfig(currentWaveConfig());
+    waveDirector.beginFloor(floor, width, height, rng); // Also reserves zombie capacity
+    zombieGrid.build(floor.zombies, width, height);
+}
+
+void World::createWalls(int targetWallCount) {
+    WallList& walls = floor.walls;
+    walls.reserve(targetWallCount); // One arena allocation for the whole layout
+    floor.wallHealth.reserve(targetWallCount);
+    int maxAttemptsPerWall = 100; // Max attempts to place each individual wall
+
+    // Clearance around the player's spawn point (world center, radius 20) so walls never block it
+    Rectangle playerSpawnClearance = { width / 2 - 40, height / 2 - 40, 80, 80 };
+
+    for (int i = 0; i < targetWallCount; ++i) {
+        int attempts = 0;
+        bool placed = false;
+        while (attempts < maxAttemptsPerWall && !placed) {
+            float x = static_cast<float>(rng.range(50, (int)width - 150)); // Avoid edges
+            float y = static_cast<float>(rng.range(50, (int)height - 150)); // Avoid edges
+            bool horizontal = rng.range(0, 1);
+            float wallWidth = horizontal ? static_cast<float>(rng.range(80, 250)) : 20.0f;
+            float wallHeight = horizontal ? 20.0f : static_cast<float>(rng.range(80, 250));
+            Rectangle newWall = { x, y, wallWidth, wallHeight };
+
+            bool overlaps = CheckCollisionRecs(newWall, playerSpawnClearance);
+            for (const auto& existingWall : walls) {
+                if (overlaps) break;
+                overlaps = CheckCollisionRecs(newWall, existingWall);
+            }
+
+            if (!overlaps) {
+                walls.push_back(newWall);
+                placed = true;
+            }
+            attempts++;
+        }
+        // A wall that can't be placed within maxAttemptsPerWall is simply skipped
+    }
+}
+
+void World::step(float deltaTime, const PlayerInput& input) {
+    if (status != Status::PLAYING) return;
+    time += deltaTime;
+    ticks++;
+    explosions.clear();
+    wallChanges.clear();
+    wallHits.clear(); // Hits queued outside a step (direct detonate() calls) are not carried over
+
+    WallList& walls = floor.walls;
+    ZombieList& zombies = floor.zombies;
+
+    // The player's own part: move, face, dash and pull the trigger. Every shot due within the step
+    // fires, each aged by how long before the step's end it left; hitscan shots resolve here.
+    float shotTimes[MAX_SHOTS_PER_STEP];
+    int shots = controlPlayer(player, input, deltaTime, time, floor, shotTimes);
+    for (int i = 0; i < shots; ++i) {
+        player.shoot(time - shotTimes[i], deltaTime);
+        if (player.weapon.hitscan) fireHitscan();
+    }
+
+    // Zombie spawning: the director spends its budget on spawns at pre-validated points
+    waveDirector.update(deltaTime, floor, rng);
+
+    // The grid still holds this step's starting positions; the director's new spawns are past its end
+    updatePlayer(player, deltaTime, zombies, zombieGrid, walls, { width, height });
+    if (!player.detonations.empty()) {
+        zombieGrid.build(zombies, width, height); // Re-index: the director may have spawned since the last step
+        for (const Explosion& explosion : player.detonations) {
+            detonate(explosion.center, explosion.radius, explosion.damage);
+            explosions.push_back(explosion);
+        }
+        player.detonations.clear();
+    }
+    wallHits.insert(wallHits.end(), player.wallHits.begin(), player.wallHits.end());
+    player.wallHits.clear();
+    applyWallHits(); // Before the zombies move, so a breach is open to them this tick
+
+    // Contact: one query around the player feeds both the contact damage and the zombies' attack
+    // transitions below (Player::takeDamage handles invulnerability)
+    findContacts();
+    for (int index : contacts) {
+        float touch = player.size + zombies[index].size;
+        if (playerDistanceSq[index] < touch * touch) player.takeDamage(CONTACT_DAMAGE_PER_SECOND * deltaTime);
+    }
+
+    // Zombie AI, one archetype batch at a time
+    zombieBatches.build(zombies.data(), (int)zombies.size());
+    ZombieContext context = { player.pos, player.size, deltaTime, walls, floor.occupancy, playerDistanceSq.data(),
+                              player.health, zombieBursts, enemyProjectiles, farZombieUpdateStride, ticks };
+    zombieBatches.update(zombies.data(), context);
+    for (int index : contacts) playerDistanceSq[index] = std::numeric_limits<float>::infinity(); // Before indices shift
+    int spitDamage = enemyProjectiles.update(deltaTime, player.pos, player.size, floor.occupancy);
+    if (spitDamage > 0) player.takeDamage((float)spitDamage);
+    if (!zombieBursts.empty()) {
+        zombieGrid.build(zombies, width, height); // The zombies have moved since the last index
+        for (const Explosion& burst : zombieBursts) {
+            detonate(burst.center, burst.radius, burst.damage);
+            float distance = Vector2Distance(burst.center, player.pos) - player.size;
+            if (distance <= burst.radius) player.takeDamage((float)blastDamage(burst.damage, burst.radius, std::max(distance, 0.0f)));
+            explosions.push_back(burst);
+        }
+        zombieBursts.clear();
+        applyWallHits();
+    }
+
+    // Remove dead zombies and update kill count
+    int zombiesBeforeErase = (int)zombies.size();
+    zombies.erase(std::remove_if(zombies.begin(), zombies.end(), [](const Zombie& z) { return z.isDead(); }), zombies.end());
+    zombiesKilled += (zombiesBeforeErase - (int)zombies.size());
+
+    // Floor completion (not in horde mode, which would otherwise throw its horde away every 20 kills)
+    if (!hordeMode && zombiesKilled >= ZOMBIES_PER_FLOOR) {
+        if (currentFloor < MAX_FLOORS) {
+            zombiesKilled = 0;
+            currentFloor++;
+            spawnInterval *= 0.9f; // Make next floor harder (faster spawns)
+            if (spawnInterval < 0.5f) spawnInterval = 0.5f; // Cap minimum spawn interval
+            setupFloor(); // Release the finished floor's data in O(1) and build the next one
+            // Replenish player health slightly for reaching a new floor
+            player.health = std::min(player.health + 20.0f, player.maxHealth);
+        } else {
+            status = Status::WON;
+        }
+    }
+
+    if (player.health <= 0) {
+        status = Status::LOST;
+    }
+
+    // Spatial queries between steps (bots, tools) see the positions this step ended with
+    zombieGrid.build(floor.zombies, width, height);
+}
+
+void World::findContacts() {
+    const ZombieList& zombies = floor.zombies;
+    if (playerDistanceSq.size() < zombies.size()) playerDistanceSq.resize(zombies.size(), std::numeric_limits<float>::infinity());
+
+    // The grid is current: zombies have not moved since it was built, and this tick's spawns (not
+    // in it yet) stand in the off-screen ring, out of reach
+    contacts.clear();
+    Vector2 center = player.pos;
+    zombieGrid.forEachInRadius(center, player.size + zombieGrid.getMaxZombieSize(), [&](int index, const Zombie& zombie) {
+        float dx = zombie.pos.x - center.x;
+        float dy = zombie.pos.y - center.y;
+        playerDistanceSq[index] = dx * dx + dy * dy;
+        contacts.push_back(index);
+    });
+}
+
+int World::blastDamage(int damage, float radius, float distance) {
+    float falloff = 1.0f - (1.0f - BLAST_RIM_DAMAGE) * (distance / radius);
+    return (int)(damage * falloff + 0.5f);
+}
+
+int World::detonate(Vector2 center, float radius, int damage) {
+    int hits = 0;
+    ZombieList& zombies = floor.zombies;
+    // Centers up to one body size beyond the rim can still be touched by the blast
+    zombieGrid.forEachInRadius(center, radius + zombieGrid.getMaxZombieSize(), [&](int index, const Zombie& zombie) {
+        if (zombie.currentState == Zombie::ZombieState::DYING || zombie.currentState == Zombie::ZombieState::DEAD) return;
+        float distance = Vector2Distance(center, zombie.pos) - zombie.size;
+        if (distance > radius) return;
+        if (distance < 0.0f) distance = 0.0f;
+        zombies[index].takeDamage(blastDamage(damage, radius, distance));
+        hits++;
+    });
+
+    // Walls: the handful on a floor are scanned directly, measured to their nearest point
+    const WallList& walls = floor.walls;
+    for (int w = 0; w < (int)walls.size(); ++w) {
+        const Rectangle& wall = walls[w];
+        Vector2 nearest = { Clamp(center.x, wall.x, wall.x + wall.width), Clamp(center.y, wall.y, wall.y + wall.height) };
+        float distance = Vector2Distance(center, nearest);
+        if (distance <= radius) wallHits.push_back({ w, nearest, blastDamage(damage, radius, distance) });
+    }
+    return hits;
+}
+
+void World::applyWallHits() {
+    if (wallHits.empty()) return;
+    WallList& walls = floor.walls;
+    WallHealthList& health = floor.wallHealth;
+
+    wallBreaks.clear();
+    for (const WallHit& hit : wallHits) {
+        if (health[hit.wall] <= 0) continue; // Already coming down this tick
+        const Rectangle& wall = walls[hit.wall];
+        bool listed = false;
+        for (const Rectangle& area : wallChanges) {
+            listed = listed || (area.x == wall.x && area.y == wall.y && area.width == wall.width && area.height == wall.height);
+        }
+        if (!listed) wallChanges.push_back(wall);
+        health[hit.wall] -= hit.damage;
+        if (health[hit.wall] <= 0) wallBreaks.push_back({ hit.wall, hit.point });
+    }
+    wallHits.clear();
+    if (wallBreaks.empty()) return;
+
+    // Highest index first: breaking a wall only renumbers walls behind it, and those are done already
+    std::sort(wallBreaks.begin(), wallBreaks.end(), [](const WallBreak& a, const WallBreak& b) { return a.wall > b.wall; });
+    wallIndexDirty.clear();
+    for (const WallBreak& wallBreak : wallBreaks) breakWall(wallBreak.wall, wallBreak.point);
+
+    // Only the cells under the changed walls are re-listed; the rest of both indices stays as built
+    for (const Rectangle& area : wallIndexDirty) {
+        floor.wallIndex.updateRegion(area);
+        floor.occupancy.updateRegion(area);
+    }
+}
+
+void World::breakWall(int index, Vector2 point) {
+    WallList& walls = floor.walls;
+    WallHealthList& health = floor.wallHealth;
+    Rectangle wall = walls[index];
+    wallIndexDirty.push_back(wall);
+
+    // Work along the long axis: 'start'..'end' is the wall, the gap is cut out of it
+    bool horizontal = wall.width >= wall.height;
+    float start = horizontal ? wall.x : wall.y;
+    float end = start + (horizontal ? wall.width : wall.height);
+    float impact = Clamp(horizontal ? point.x : point.y, start, end);
+    float gapStart = std::max(start, impact - WALL_BREACH_WIDTH / 2);
+    float gapEnd = std::min(end, impact + WALL_BREACH_WIDTH / 2);
+
+    Rectangle pieces[2];
+    int pieceCount = 0;
+    if (gapStart - start >= WALL_MIN_FRAGMENT) {
+        pieces[pieceCount++] = horizontal ? Rectangle{ start, wall.y, gapStart - start, wall.height }
+                                          : Rectangle{ wall.x, start, wall.width, gapStart - start };
+    }
+    if (end - gapEnd >= WALL_MIN_FRAGMENT) {
+        pieces[pieceCount++] = horizontal ? Rectangle{ gapEnd, wall.y, end - gapEnd, wall.height }
+                                          : Rectangle{ wall.x, gapEnd, wall.width, end - gapEnd };
+    }
+
+    if (pieceCount > 0) {
+        walls[index] = pieces[0];
+        health[index] = Floor::maxWallHealth(pieces[0]);
+        if (pieceCount > 1) {
+            walls.push_back(pieces[1]);
+            health.push_back(Floor::maxWallHealth(pieces[1]));
+        }
+    } else {
+        // Nothing left: the last wall takes the slot, so its cells must be re-listed under the new index
+        int last = (int)walls.size() - 1;
+        if (index != last) {
+            wallIndexDirty.push_back(walls[last]);
+            walls[index] = walls[last];
+            health[index] = health[last];
+        }
+        walls.pop_back();
+        health.pop_back();
+    }
+}
+
+void World::fireHitscan() {
+    const Weapon& weapon = player.weapon;
+    Vector2 from = player.getMuzzlePosition();
+    Vector2 direction = Vector2Normalize(player.facing);
+    Vector2 to = Vector2Add(from, Vector2Scale(direction, weapon.range));
+
+    // Walls first: they cap how far zombies can be hit
+    RayHit wallHit = floor.occupancy.castSegment({ from, to });
+    float length = weapon.range * wallHit.fraction;
+    to = Vector2Add(from, Vector2Scale(direction, length));
+    if (wallHit.wall >= 0) wallHits.push_back({ wallHit.wall, to, weapon.damage });
+
+    // Ray against zombie circles, over the cells along the shot only (the grid is current: zombies
+    // have not moved or spawned since the last step ended)
+    hitscanHits.clear();
+    zombieGrid.forEachNearSegment(from, to, zombieGrid.getMaxZombieSize(), [&](int index, const Zombie& zombie) {
+        if (zombie.currentState == Zombie::ZombieState::DYING || zombie.currentState == Zombie::ZombieState::DEAD) return;
+        Vector2 toCenter = Vector2Subtract(zombie.pos, from);
+        float along = Vector2DotProduct(toCenter, direction);
+        float missSq = Vector2DotProduct(toCenter, toCenter) - along * along;
+        float radiusSq = zombie.size * zombie.size;
+        if (missSq > radiusSq) return;
+        float entry = along - sqrtf(radiusSq - missSq);
+        if (entry < 0.0f) entry = 0.0f; // Muzzle already inside the zombie
+        if (entry > length || along + zombie.size < 0.0f) return;
+        hitscanHits.push_back({ entry, index });
+    });
+    std::sort(hitscanHits.begin(), hitscanHits.end(), [](const HitscanHit& a, const HitscanHit& b) {
+        return a.distance != b.distance ? a.distance < b.distance : a.zombie < b.zombie;
+    });
+
+    int hits = std::min((int)hitscanHits.size(), weapon.penetration + 1);
+    for (int i = 0; i < hits; ++i) floor.zombies[hitscanHits[i].zombie].takeDamage(weapon.damage);
+    if (hits == weapon.penetration + 1) {
+        to = Vector2Add(from, Vector2Scale(direction, hitscanHits[hits - 1].distance)); // Stopped in the last one
+    }
+
+    player.tracers.push_back({ from, to, Player::TRACER_DURATION });
+}
+
+uint64_t World::checksum() const {
+    // FNV-1a over the raw bytes of the state that matters for gameplay
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto mix = [&hash](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+    };
+    mix(&ticks, sizeof(ticks));
+    mix(&rng.state, sizeof(rng.state));
+    mix(&currentFloor, sizeof(currentFloor));
+    mix(&zombiesKilled, sizeof(zombiesKilled));
+    mix(&player.pos, sizeof(player.pos));
+    mix(&player.health, sizeof(player.health));
+    for (const Bullet& bullet : player.bullets) mix(&bullet.pos, sizeof(bullet.pos));
+    for (int i = 0; i < enemyProjectiles.getCount(); ++i) {
+        mix(&enemyProjectiles.x[i], sizeof(float));
+        mix(&enemyProjectiles.y[i], sizeof(float));
+    }
+    for (const Zombie& zombie : floor.zombies) {
+        mix(&zombie.pos, sizeof(zombie.pos));
+        mix(&zombie.health, sizeof(zombie.health));
+    }
+    for (const Rectangle& wall : floor.walls) mix(&wall, sizeof(wall));
+    for (int health : floor.wallHealth) mix(&health, sizeof(health));
+    return hash;
+}
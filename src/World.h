@@ -0,0 +1,150 @@
+#pragma once
+#include "raylib.h"
+#include "Floor.h"
+#include "Player.h"
+#include "WaveDirector.h"
+#include "ZombieGrid.h"
+#include "EnemyProjectiles.h"
+#include "ZombieTypes.h"
+#include "Rng.h"
+#include <cstdint>
+#include <vector>
+
+// One tick's worth of player intent. The game fills it from keyboard and mouse; headless
+// runs (benchmarks, bots, the server) fill it themselves. The simulation never polls input.
+struct PlayerInput {
+    Vector2 move; // Movement direction, normalized by the simulation
+    Vector2 aim;  // World-space point the player faces
+    bool fire;
+    bool dash;
+    // Seconds before the end of the step at which fire was pressed (InputTimeline); the shot is
+    // timed there instead of at the step's end. 0 when sampled once per step or held from before.
+    float fireLead = 0.0f;
+};
+
+// The game simulation without a window: the current floor (walls, zombies, spawning), the
+// player and floor progression, advanced by step(). main.cpp feeds it input and draws it;
+// headless tools drive it directly. All randomness comes from 'rng', so a seed and an input
+// sequence reproduce a run exactly.
+class World {
+public:
+    enum class Status {
+        PLAYING,
+        WON,  // All floors cleared
+        LOST  // Player died
+    };
+
+    static const int MAX_FLOORS;
+    static const int ZOMBIES_PER_FLOOR;
+    static const int HORDE_MAX_ALIVE;    // Live zombie cap of the horde stress mode
+    static const int WALLS_PER_FLOOR;
+    static const float PLAYER_MOVE_SPEED;
+    static const float INITIAL_SPAWN_INTERVAL;
+    static const float BLAST_RIM_DAMAGE; // Fraction of a blast's damage still dealt at its rim
+    static const float WALL_BREACH_WIDTH; // Gap a breaking wall opens around the hit that broke it
+    static const float WALL_MIN_FRAGMENT; // Shorter pieces of a broken wall crumble away entirely
+    static const float CONTACT_DAMAGE_PER_SECOND; // Dealt to the player while any zombie's body touches theirs
+    static const int MAX_SHOTS_PER_STEP; // Shots one step can fire; a long hitch skips the rest
+
+    // 'floorArenaBytes' sizes the floor arena; servers running many small sessions pass less than the default
+    World(float width, float height, size_t floorArenaBytes = Floor::DEFAULT_ARENA_BYTES);
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // Starts a new game on floor 1 with 'weapon'; 'seed' fixes every wall layout and spawn
+    void start(Weapon&& weapon, uint64_t seed);
+
+    void step(float deltaTime, const PlayerInput& input);
+
+    // The player's own part of a step, shared with client-side prediction (PlayerPredictor) so a
+    // networked client moves its player with exactly the server's code. controlPlayer moves along
+    // input.move unless that ends in a wall, faces input.aim, starts a dash and pulls or releases
+    // the trigger at 'stepEnd' (the clock after the step); it fills 'shotTimes' (MAX_SHOTS_PER_STEP)
+    // and returns the number of shots due, leaving firing them to the caller. updatePlayer advances
+    // the player's timers, dash and bullets, undoing a dash that ends in a wall.
+    static int controlPlayer(Player& player, const PlayerInput& input, float deltaTime, float stepEnd, const Floor& floor,
+                             float* shotTimes);
+    static void updatePlayer(Player& player, float deltaTime, ZombieList& zombies, const ZombieGrid& zombieGrid,
+                             const WallList& walls, Vector2 worldSize);
+
+    // Switches the wave director between normal play and the horde stress preset. While the horde is
+    // on, the floor never completes: kills still count, but the horde stays and grows to
+    // HORDE_MAX_ALIVE. Switching back off completes the floor on the next step if its kills are in.
+    void setHordeMode(bool enabled);
+
+    // Applies a blast to every living zombie whose body reaches within 'radius' of 'center':
+    // full damage at the center, falling off linearly to BLAST_RIM_DAMAGE at the rim. Uses
+    // zombieGrid, which must index the current zombie list. Walls in reach take the same falloff,
+    // queued until the end of the step's combat. Returns the number of zombies hit.
+    int detonate(Vector2 center, float radius, int damage);
+
+    // Damage a blast deals 'distance' px from its center (measured to the zombie's edge)
+    static int blastDamage(int damage, float radius, float distance);
+
+    // Order-sensitive hash of the simulation state, for checking that two runs (or two builds) agree
+    uint64_t checksum() const;
+
+    float width;
+    float height;
+    Rng rng;
+    Floor floor;
+    Player player;
+    WaveDirector waveDirector;
+    ZombieGrid zombieGrid; // Index of floor.zombies as of the end of the last step (or setup/restore)
+    EnemyProjectiles enemyProjectiles; // Spit in flight; emptied with each new floor
+    int currentFloor;
+    int zombiesKilled;
+    float spawnInterval;
+    float time;     // Simulation clock in seconds; drives weapon fire timing
+    uint64_t ticks; // Steps taken since start()
+    bool hordeMode;
+    // Far chasing zombies update every Nth step (ZombieContext::farStride); 1 keeps runs bit-exact
+    // with the checksums, so only the game's quality governor raises it. Not part of checkpoints.
+    int farZombieUpdateStride;
+    Status status;
+    std::vector<Explosion> explosions; // Blasts resolved in the last step, for effects (scorch marks, flashes)
+    std::vector<Rectangle> wallChanges; // Extents (before breaking) of walls damaged or broken in the last step, for redrawing
+
+private:
+    // Builds a fresh floor: walls, their index and the director's spawn points, all in the floor arena
+    void setupFloor();
+    // Fills the floor's walls with random non-overlapping rectangles, keeping the player's spawn clear
+    void createWalls(int targetWallCount);
+    WaveConfig currentWaveConfig() const;
+
+    // Resolves a hitscan shot from the muzzle along the player's facing: the first wall ends it,
+    // zombies in its path take damage in order until the weapon's penetration runs out
+    void fireHitscan();
+
+    // One zombie grid query around the player: lists the zombies whose bodies can reach the
+    // player's in 'contacts' and records their squared distances in 'playerDistanceSq'
+    void findContacts();
+
+    // Applies the tick's queued wall hits, breaks the walls they bring down and patches the wall
+    // index and occupancy grid around them
+    void applyWallHits();
+    // Opens a WALL_BREACH_WIDTH gap in walls[index] along its long side, centered at 'point'; the
+    // pieces that are long enough stay as fresh walls. Records the areas the indices must re-list.
+    void breakWall(int index, Vector2 point);
+
+    std::vector<WallHit> wallHits;       // Queued this step (hitscan, blasts, bullets); applied by applyWallHits
+    struct WallBreak {
+        int wall;
+        Vector2 point;
+    };
+    std::vector<WallBreak> wallBreaks;   // Scratch for applyWallHits
+    std::vector<Rectangle> wallIndexDirty; // Likewise: areas whose index cells changed
+
+    struct HitscanHit {
+        float distance; // Along the shot to where it enters the zombie
+        int zombie;
+    };
+    std::vector<HitscanHit> hitscanHits; // Scratch for fireHitscan, reused between shots
+
+    std::vector<int> contacts;           // Zombie indices found by findContacts this step
+    std::vector<float> playerDistanceSq; // Per zombie index; infinity except for this step's contacts
+
+    ZombieBatches zombieBatches;        // The zombie list grouped by archetype, rebuilt each step
+    std::vector<Explosion> zombieBursts; // Exploders that went off this step
+};
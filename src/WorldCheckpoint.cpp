@@ -0,0 +1,179 @@
+#include "WorldCheckpoint.h"
+#include "WeaponTypes.h"
+#include <algorithm>
+
+size_t WorldCheckpoint::getMemoryBytes() const {
+    return bullets.capacity() * sizeof(Bullet) + enemyProjectiles.capacity() * sizeof(EnemyProjectile) +
+           zombies.capacity() * sizeof(Zombie) +
+           walls.capacity() * sizeof(Rectangle) + wallHealth.capacity() * sizeof(int) +
+           spawnPoints.capacity() * sizeof(Vector2);
+}
+
+void SaveCheckpoint(const World& world, WorldCheckpoint& out) {
+    WorldCheckpoint::Scalars& s = out.scalars;
+    s.rngState = world.rng.state;
+    s.currentFloor = world.currentFloor;
+    s.zombiesKilled = world.zombiesKilled;
+    s.spawnInterval = world.spawnInterval;
+    s.time = world.time;
+    s.ticks = world.ticks;
+    s.hordeMode = world.hordeMode;
+    s.status = world.status;
+    s.floorNumber = world.floor.number;
+
+    const Player& player = world.player;
+    s.playerPos = player.pos;
+    s.playerFacing = player.facing;
+    s.playerSize = player.size;
+    s.playerHealth = player.health;
+    s.playerMaxHealth = player.maxHealth;
+    s.invulnerabilityTimer = player.invulnerabilityTimer;
+    s.muzzleFlashTimer = player.muzzleFlashTimer;
+    s.damageTakenFlashTimer = player.damageTakenFlashTimer;
+    s.isDashing = player.isDashing;
+    s.dashTimer = player.dashTimer;
+    s.dashDirection = player.dashDirection;
+    s.timeSinceLastDamage = player.timeSinceLastDamage;
+    s.regenTimer = player.regenTimer;
+
+    s.weaponType = player.weapon.type;
+    s.fireRate = player.weapon.fireRate;
+    s.lastFireTime = player.weapon.lastFireTime;
+    s.triggerHeld = player.weapon.triggerHeld;
+    s.bulletSpeed = player.weapon.bulletSpeed;
+    s.damage = player.weapon.damage;
+
+    s.wave = world.waveDirector.getState();
+
+    // Bulk copies into storage kept from the previous save
+    out.bullets.assign(player.bullets.begin(), player.bullets.end());
+    out.enemyProjectiles.clear();
+    for (int i = 0; i < world.enemyProjectiles.getCount(); ++i) out.enemyProjectiles.push_back(world.enemyProjectiles.get(i));
+    out.zombies.assign(world.floor.zombies.begin(), world.floor.zombies.end());
+    out.walls.assign(world.floor.walls.begin(), world.floor.walls.end());
+    out.wallHealth.assign(world.floor.wallHealth.begin(), world.floor.wallHealth.end());
+    out.spawnPoints.assign(world.floor.spawnPoints.begin(), world.floor.spawnPoints.end());
+}
+
+static bool SameWalls(const WallList& walls, const std::vector<Rectangle>& saved) {
+    if (walls.size() != saved.size()) return false;
+    for (size_t i = 0; i < walls.size(); ++i) {
+        const Rectangle& a = walls[i];
+        const Rectangle& b = saved[i];
+        if (a.x != b.x || a.y != b.y || a.width != b.width || a.height != b.height) return false;
+    }
+    return true;
+}
+
+void RestoreCheckpoint(World& world, const WorldCheckpoint& checkpoint) {
+    const WorldCheckpoint::Scalars& s = checkpoint.scalars;
+    world.rng.state = s.rngState;
+    world.currentFloor = s.currentFloor;
+    world.zombiesKilled = s.zombiesKilled;
+    world.spawnInterval = s.spawnInterval;
+    world.time = s.time;
+    world.ticks = s.ticks;
+    world.hordeMode = s.hordeMode;
+    world.status = s.status;
+    world.waveDirector.setState(s.wave);
+
+    // A different layout means the checkpoint is from another floor (or another game), or walls
+    // broke since: rebuild the floor from the saved walls instead of regenerating it, which would
+    // consume RNG draws
+    Floor& floor = world.floor;
+    if (floor.number != s.floorNumber || !SameWalls(floor.walls, checkpoint.walls)) {
+        floor.reset(s.floorNumber);
+        floor.walls.assign(checkpoint.walls.begin(), checkpoint.walls.end());
+        floor.wallIndex.build(floor.walls, world.width, world.height);
+        floor.occupancy.build(floor.walls, world.width, world.height);
+        floor.spawnPoints.assign(checkpoint.spawnPoints.begin(), checkpoint.spawnPoints.end());
+    }
+    floor.wallHealth.assign(checkpoint.wallHealth.begin(), checkpoint.wallHealth.end());
+    // Keep the spawn headroom beginFloor() reserved, so later spawns still don't reallocate
+    floor.zombies.reserve(std::max((size_t)s.wave.config.maxAlive, checkpoint.zombies.size()));
+    floor.zombies.assign(checkpoint.zombies.begin(), checkpoint.zombies.end());
+    world.zombieGrid.build(floor.zombies, world.width, world.height);
+    world.enemyProjectiles.clear();
+    for (const EnemyProjectile& projectile : checkpoint.enemyProjectiles) world.enemyProjectiles.spawn(projectile);
+
+    Player& player = world.player;
+    player.pos = s.playerPos;
+    player.facing = s.playerFacing;
+    player.size = s.playerSize;
+    player.health = s.playerHealth;
+    player.maxHealth = s.playerMaxHealth;
+    player.invulnerabilityTimer = s.invulnerabilityTimer;
+    player.muzzleFlashTimer = s.muzzleFlashTimer;
+    player.damageTakenFlashTimer = s.damageTakenFlashTimer;
+    player.isDashing = s.isDashing;
+    player.dashTimer = s.dashTimer;
+    player.dashDirection = s.dashDirection;
+    player.timeSinceLastDamage = s.timeSinceLastDamage;
+    player.regenTimer = s.regenTimer;
+    player.bullets.assign(checkpoint.bullets.begin(), checkpoint.bullets.end());
+    player.tracers.clear(); // Visual only; shots from the abandoned timeline should not linger
+
+    if (player.weapon.type != s.weaponType) player.weapon = CreateWeapon(s.weaponType);
+    player.weapon.fireRate = s.fireRate;
+    player.weapon.lastFireTime = s.lastFireTime;
+    player.weapon.triggerHeld = s.triggerHeld;
+    player.weapon.bulletSpeed = s.bulletSpeed;
+    player.weapon.damage = s.damage;
+}
+
+RewindBuffer::RewindBuffer(float seconds, float interval)
+    : ring(std::max(1, (int)(seconds / interval + 0.5f))), newest(-1), count(0),
+      interval(interval), lastRecordTime(0.0f) {}
+
+void RewindBuffer::clear() {
+    newest = -1;
+    count = 0; // The checkpoints themselves (and their capacity) are kept for reuse
+}
+
+const WorldCheckpoint& RewindBuffer::at(int age) const {
+    int size = (int)ring.size();
+    return ring[((newest - age) % size + size) % size];
+}
+
+void RewindBuffer::record(const World& world) {
+    // Time running backwards means a restart or a restore from elsewhere: record right away
+    if (count > 0 && world.time >= lastRecordTime && world.time - lastRecordTime < interval) return;
+    newest = (newest + 1) % (int)ring.size();
+    if (count < (int)ring.size()) count++;
+    SaveCheckpoint(world, ring[newest]);
+    lastRecordTime = world.time;
+}
+
+bool RewindBuffer::stepBack(World& world) {
+    if (count == 0) return false;
+    RestoreCheckpoint(world, at(0));
+    int size = (int)ring.size();
+    newest = (newest - 1 + size) % size;
+    count--;
+    lastRecordTime = world.time;
+    return true;
+}
+
+bool RewindBuffer::rewind(World& world, float seconds) {
+    if (count == 0) return false;
+    float target = world.time - seconds;
+    while (count > 1 && at(0).scalars.time > target) {
+        int size = (int)ring.size();
+        newest = (newest - 1 + size) % size;
+        count--;
+    }
+    RestoreCheckpoint(world, at(0));
+    lastRecordTime = world.time;
+    return true;
+}
+
+float RewindBuffer::getSpanSeconds() const {
+    if (count < 2) return 0.0f;
+    return at(0).scalars.time - at(count - 1).scalars.time;
+}
+
+size_t RewindBuffer::getMemoryBytes() const {
+    size_t bytes = ring.size() * sizeof(WorldCheckpoint);
+    for (const WorldCheckpoint& checkpoint : ring) bytes += checkpoint.getMemoryBytes();
+    return bytes;
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "raylib.h"
+#include "World.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Exact copy of a World's state: restoring it and replaying the same inputs reproduces the run
+// bit for bit (unlike WorldSnapshot, which is quantized for the wire). The scalar state of every
+// part (RNG, floor progress, player, weapon cooldown, spawn budget) is one plain struct, and each
+// entity list is a contiguous array, so saving and restoring are a handful of bulk copies. A
+// checkpoint keeps its vectors' capacity, so re-saving into the same one does not allocate.
+struct WorldCheckpoint {
+    struct Scalars {
+        uint64_t rngState;
+        int currentFloor;
+        int zombiesKilled;
+        float spawnInterval;
+        float time;
+        uint64_t ticks;
+        bool hordeMode;
+        World::Status status;
+        int floorNumber;
+
+        Vector2 playerPos;
+        Vector2 playerFacing;
+        float playerSize;
+        float playerHealth;
+        float playerMaxHealth;
+        float invulnerabilityTimer;
+        float muzzleFlashTimer;
+        float damageTakenFlashTimer;
+        bool isDashing;
+        float dashTimer;
+        Vector2 dashDirection;
+        float timeSinceLastDamage;
+        float regenTimer;
+
+        WeaponType weaponType;
+        float fireRate;
+        float lastFireTime;
+        bool triggerHeld;
+        float bulletSpeed;
+        int damage;
+
+        WaveDirector::State wave;
+    };
+
+    Scalars scalars;
+    std::vector<Bullet> bullets;
+    std::vector<EnemyProjectile> enemyProjectiles;
+    std::vector<Zombie> zombies;
+    std::vector<Rectangle> walls;      // Only needed when restoring onto a different layout
+    std::vector<int> wallHealth;
+    std::vector<Vector2> spawnPoints;
+
+    // Heap held by the checkpoint's lists
+    size_t getMemoryBytes() const;
+};
+
+void SaveCheckpoint(const World& world, WorldCheckpoint& out);
+
+// Puts 'world' back into the saved state. On the same floor layout only the entity lists and
+// scalars (and wall health) are copied; on another floor, or after walls broke, the floor is reset
+// and its walls, wall index and spawn points are rebuilt from the checkpoint first. A different weapon type is recreated (and its
+// sound reloaded), everything else is a plain copy.
+void RestoreCheckpoint(World& world, const WorldCheckpoint& checkpoint);
+
+// Rolling history of the last few seconds of play, as checkpoints taken at a fixed interval of
+// simulation time. The ring's checkpoints are reused, so recording stops allocating once the
+// buffer has wrapped around.
+class RewindBuffer {
+public:
+    RewindBuffer(float seconds, float interval);
+
+    void clear();
+
+    // Call after each step: saves 'world' when 'interval' has passed since the last checkpoint
+    void record(const World& world);
+
+    // Restores the newest checkpoint and drops it; repeated calls walk further back.
+    // Returns false when the buffer is empty.
+    bool stepBack(World& world);
+
+    // Restores the newest checkpoint at least 'seconds' older than the world's current time (or
+    // the oldest one kept), dropping everything newer. Returns false when the buffer is empty.
+    bool rewind(World& world, float seconds);
+
+    int getCount() const { return count; }
+    int getCapacity() const { return (int)ring.size(); }
+    float getSpanSeconds() const; // Simulation time covered by the kept checkpoints
+    size_t getMemoryBytes() const;
+
+private:
+    std::vector<WorldCheckpoint> ring;
+    int newest; // Index of the newest checkpoint
+    int count;
+    float interval;
+    float lastRecordTime;
+
+    const WorldCheckpoint& at(int age) const; // 0 = newest
+};
@@ -1,6 +1,7 @@
 #include "Zombie.h"
 #include <algorithm>
 #include "raymath.h"
+#include "Renderer.h"
 
 #ifndef CLAMP
 #define CLAMP(value, min, max) ((value < min) ? min : (value > max) ? max : value)
@@ -14,75 +15,33 @@ const float Zombie::ZOMBIE_ATTACK_RANGE_BUFFER = 5.0f;
 const float Zombie::ZOMBIE_EXPLOSION_MAX_RADIUS = 40.0f; // Max size of explosion particles/effect
 
 
-// Helper function for wall collision (now a private member of Zombie)
-bool Zombie::checkWallCollision(Vector2 checkPos, float checkSize, const std::vector<Rectangle>& walls) const {
-    for (const auto& wall : walls) {
-        if (CheckCollisionCircleRec(checkPos, checkSize, wall)) {
-            return true;
-        }
-    }
-    return false;
-}
-
 // Constructor
-Zombie::Zombie(Vector2 pos, float speed, int health, int damage, float size, Color color)
-    : pos(pos), speed(speed), health(health), maxHealth(health), damage(damage), size(size),
-      bodyColor(color), currentState(ZombieState::CHASING),
-      attackCooldownTimer(0.0f), hitFlashTimer(0.0f), deathTimer(0.0f),
+Zombie::Zombie(ZombieKind kind, Vector2 pos, float speed, int health, int damage, float size, Color color)
+    : id(0), kind(kind), action(Action::NONE), pos(pos), speed(speed), health(health), maxHealth(health),
+      damage(damage), size(size), bodyColor(color), currentState(ZombieState::CHASING),
+      attackCooldownTimer(0.0f), hitFlashTimer(0.0f), deathTimer(0.0f), actionTimer(0.0f), leapDirection({ 0, 0 }),
       explosionRadius(0.0f), explosionAlpha(0.0f) {}
 
-
-void Zombie::update(Vector2 playerPos, float deltaTime, const std::vector<Rectangle>& walls, float& playerHealth) {
-    if (currentState == ZombieState::DEAD) {
-        return; // No updates for fully dead zombies
-    }
-
-    updateTimers(deltaTime);
-
-    switch (currentState) {
-        case ZombieState::CHASING:
-            handleChasingState(playerPos, deltaTime, walls);
-            if (Vector2Distance(pos, playerPos) < size + 20.0f - ZOMBIE_ATTACK_RANGE_BUFFER && attackCooldownTimer <= 0) {
-                currentState = ZombieState::ATTACKING;
-            }
-            break;
-        case ZombieState::ATTACKING:
-            handleAttackingState(playerPos, deltaTime, playerHealth);
-            if (Vector2Distance(pos, playerPos) >= size + 20.0f || attackCooldownTimer > 0) {
-                 currentState = ZombieState::CHASING;
-            }
-            break;
-        case ZombieState::DYING:
-            handleDyingState(deltaTime); // This will update explosion and deathTimer
-            if (deathTimer <= 0) {
-                currentState = ZombieState::DEAD; // Transition to fully DEAD
-            }
-            break;
-        case ZombieState::DEAD:
-            break; // This state is just a marker for removal by the main game loop
-    }
-
+bool Zombie::beginDyingIfKilled() {
     // Health check and state transition to DYING
-    if (health <= 0 && currentState != ZombieState::DYING && currentState != ZombieState::DEAD) {
-        currentState = ZombieState::DYING;
-        deathTimer = ZOMBIE_DEATH_DURATION; // Start death animation timer
-        explosionRadius = 0.0f; // Start explosion from 0
-        explosionAlpha = 1.0f; // Start fully opaque
-        // Play death sound here
-    }
-
-    // Ensure health doesn't go below 0 (important for drawing health bar)
-    health = CLAMP(health, 0, maxHealth);
+    if (health > 0 || currentState == ZombieState::DYING || currentState == ZombieState::DEAD) return false;
+    currentState = ZombieState::DYING;
+    action = Action::NONE;
+    deathTimer = ZOMBIE_DEATH_DURATION; // Start death animation timer
+    explosionRadius = 0.0f; // Start explosion from 0
+    explosionAlpha = 1.0f; // Start fully opaque
+    // Play death sound here
+    return true;
 }
 
-void Zombie::draw() const {
+void Zombie::draw(Renderer& renderer, ZombieDetail detail) const {
     if (currentState == ZombieState::DEAD) {
         return; // Don't draw fully dead zombies
     }
 
     // --- DRAWING THE EXPLOSION EFFECT IF DYING ---
     if (currentState == ZombieState::DYING) {
-        drawExplosionEffect();
+        drawExplosionEffect(renderer, detail);
         return; // Don't draw the zombie body if it's exploding
     }
 
@@ -97,6 +56,12 @@ void Zombie::draw() const {
     // Ensure live zombie is fully opaque
     finalDrawColor.a = 255; 
 
+    if (detail == ZombieDetail::Silhouette) {
+        drawSilhouette(renderer, finalDrawColor);
+        drawHealthBar(renderer);
+        return;
+    }
+
     // --- SCARIER COLOR PALETTE ---
     Color zombieSkin = finalDrawColor;
     Color zombieShadow = { 
@@ -122,67 +87,68 @@ void Zombie::draw() const {
     float headRadius = currentSize * 0.6f;
     Vector2 headCenter = { pos.x, pos.y - currentSize * 0.8f + bobOffset };
 
-    DrawCircleV(headCenter, headRadius, zombieSkin); // Head base
-    DrawEllipse(headCenter.x, headCenter.y + headRadius * 0.5f, headRadius * 1.0f, headRadius * 0.3f, zombieShadow); // Neck shadow
+    renderer.drawCircle(headCenter, headRadius, zombieSkin); // Head base
+    renderer.drawEllipse({ headCenter.x, headCenter.y + headRadius * 0.5f }, headRadius * 1.0f, headRadius * 0.3f, zombieShadow); // Neck shadow
 
     // Sunken eye sockets/cheeks (darker ellipses)
-    DrawEllipse(headCenter.x + headRadius * 0.4f, headCenter.y - headRadius * 0.1f, headRadius * 0.3f, headRadius * 0.2f, zombieShadow);
-    DrawEllipse(headCenter.x - headRadius * 0.4f, headCenter.y - headRadius * 0.1f, headRadius * 0.3f, headRadius * 0.2f, zombieShadow);
+    renderer.drawEllipse({ headCenter.x + headRadius * 0.4f, headCenter.y - headRadius * 0.1f }, headRadius * 0.3f, headRadius * 0.2f, zombieShadow);
+    renderer.drawEllipse({ headCenter.x - headRadius * 0.4f, headCenter.y - headRadius * 0.1f }, headRadius * 0.3f, headRadius * 0.2f, zombieShadow);
 
 
     // Eyes
     Vector2 leftEyePos = { headCenter.x + headRadius * 0.3f, headCenter.y - headRadius * 0.2f };
     Vector2 rightEyePos = { headCenter.x - headRadius * 0.3f, headCenter.y - headRadius * 0.2f };
-    DrawCircleV(leftEyePos, headRadius * 0.25f, eyeSclera); // Yellowish sclera
-    DrawCircleV(rightEyePos, headRadius * 0.25f, eyeSclera);
-    DrawCircleV(leftEyePos, headRadius * 0.12f, pupilColor); // Larger red pupils
-    DrawCircleV(rightEyePos, headRadius * 0.12f, pupilColor);
+    renderer.drawCircle(leftEyePos, headRadius * 0.25f, eyeSclera); // Yellowish sclera
+    renderer.drawCircle(rightEyePos, headRadius * 0.25f, eyeSclera);
+    renderer.drawCircle(leftEyePos, headRadius * 0.12f, pupilColor); // Larger red pupils
+    renderer.drawCircle(rightEyePos, headRadius * 0.12f, pupilColor);
 
     // Nose (triangle)
     Vector2 noseTip = { headCenter.x, headCenter.y };
     Vector2 noseLeft = { headCenter.x - headRadius * 0.1f, headCenter.y + headRadius * 0.15f };
     Vector2 noseRight = { headCenter.x + headRadius * 0.1f, headCenter.y + headRadius * 0.15f };
-    DrawTriangle(noseTip, noseLeft, noseRight, zombieShadow);
+    renderer.drawTriangle(noseTip, noseLeft, noseRight, zombieShadow);
 
     // Mouth (more open, ragged look)
     Vector2 mouthCenter = { headCenter.x, headCenter.y + headRadius * 0.45f }; // Lowered slightly
     float mouthWidth = headRadius * 0.7f; // Wider
     float mouthHeight = headRadius * 0.3f; // Taller
-    DrawEllipse(mouthCenter.x, mouthCenter.y, mouthWidth, mouthHeight, mouthColor);
+    renderer.drawEllipse(mouthCenter, mouthWidth, mouthHeight, mouthColor);
 
-    // Teeth (more jagged/irregular)
-    int teethCount = 6;
+    // Teeth (more jagged/irregular), scars and wounds are the first detail to go under load
+    bool fullDetail = detail == ZombieDetail::Full;
+    int teethCount = fullDetail ? 6 : 2; // Two teeth leave no second row
     float teethWidth = mouthWidth / (teethCount * 1.2f);
     float teethHeight = mouthHeight * 0.8f;
     for (int i = 0; i < teethCount; i++) {
         float tx = mouthCenter.x - mouthWidth / 2 + i * teethWidth * 1.3f + teethWidth * 0.1f;
         float ty = mouthCenter.y - teethHeight / 2 + (i % 2 == 0 ? 0 : teethHeight * 0.1f);
         Rectangle tooth = { tx, ty, teethWidth, teethHeight };
-        DrawRectangleRec(tooth, teethColor);
+        renderer.drawRectangle(tooth, teethColor);
     }
     for (int i = 0; i < teethCount - 2; i++) {
         float tx = mouthCenter.x - mouthWidth / 2 + i * teethWidth * 1.5f + teethWidth * 0.5f;
         float ty = mouthCenter.y + teethHeight * 0.2f;
         Rectangle tooth = { tx, ty, teethWidth * 0.8f, teethHeight * 0.7f };
-        DrawRectangleRec(tooth, teethColor);
+        renderer.drawRectangle(tooth, teethColor);
     }
 
     // Head scar/wounds
-    DrawLineEx({ headCenter.x + headRadius * 0.3f, headCenter.y - headRadius * 0.6f },
+    if (fullDetail) renderer.drawLine({ headCenter.x + headRadius * 0.3f, headCenter.y - headRadius * 0.6f },
                { headCenter.x + headRadius * 0.7f, headCenter.y - headRadius * 0.5f }, 2, woundColor);
-    DrawLineEx({ headCenter.x - headRadius * 0.2f, headCenter.y + headRadius * 0.1f },
+    if (fullDetail) renderer.drawLine({ headCenter.x - headRadius * 0.2f, headCenter.y + headRadius * 0.1f },
                { headCenter.x - headRadius * 0.5f, headCenter.y + headRadius * 0.2f }, 2, woundColor);
 
 
     // --- BODY ---
     Vector2 bodyPos = { pos.x, pos.y + currentSize * 0.15f + bobOffset };
     Vector2 bodyShapeSize = { currentSize * 0.6f, currentSize * 0.7f };
-    DrawEllipse(bodyPos.x + 5, bodyPos.y + 5, bodyShapeSize.x, bodyShapeSize.y, zombieShadow); // Shadow
-    DrawEllipse(bodyPos.x, bodyPos.y, bodyShapeSize.x, bodyShapeSize.y, zombieSkin);           // Body
+    if (fullDetail) renderer.drawEllipse({ bodyPos.x + 5, bodyPos.y + 5 }, bodyShapeSize.x, bodyShapeSize.y, zombieShadow); // Shadow
+    renderer.drawEllipse(bodyPos, bodyShapeSize.x, bodyShapeSize.y, zombieSkin);           // Body
 
     // A hint of exposed rib or wound on body
-    DrawCircle(bodyPos.x + bodyShapeSize.x * 0.2f, bodyPos.y - bodyShapeSize.y * 0.1f, currentSize * 0.1f, woundColor);
-    DrawRectangle(bodyPos.x - bodyShapeSize.x * 0.3f, bodyPos.y + bodyShapeSize.y * 0.2f, currentSize * 0.2f, 3, woundColor);
+    if (fullDetail) renderer.drawCircle({ bodyPos.x + bodyShapeSize.x * 0.2f, bodyPos.y - bodyShapeSize.y * 0.1f }, currentSize * 0.1f, woundColor);
+    if (fullDetail) renderer.drawRectangle({ bodyPos.x - bodyShapeSize.x * 0.3f, bodyPos.y + bodyShapeSize.y * 0.2f, currentSize * 0.2f, 3 }, woundColor);
 
 
     // --- ARMS ---
@@ -191,8 +157,8 @@ void Zombie::draw() const {
     Vector2 leftArmPos = { pos.x - bodyShapeSize.x * 0.7f - armWidth * 0.3f, pos.y + currentSize * 0.1f + bobOffset };
     Vector2 rightArmPos = { pos.x + bodyShapeSize.x * 0.7f - armWidth * 0.7f, pos.y + currentSize * 0.1f + bobOffset };
 
-    DrawRectanglePro({ leftArmPos.x, leftArmPos.y, armWidth, armHeight }, { armWidth / 2, armHeight / 2 }, -20, zombieSkin); // More slumped
-    DrawRectanglePro({ rightArmPos.x, rightArmPos.y, armWidth, armHeight }, { armWidth / 2, armHeight / 2 }, 20, zombieSkin);
+    renderer.drawRectanglePro({ leftArmPos.x, leftArmPos.y, armWidth, armHeight }, { armWidth / 2, armHeight / 2 }, -20, zombieSkin); // More slumped
+    renderer.drawRectanglePro({ rightArmPos.x, rightArmPos.y, armWidth, armHeight }, { armWidth / 2, armHeight / 2 }, 20, zombieSkin);
 
 
     // --- LEGS ---
@@ -201,11 +167,11 @@ void Zombie::draw() const {
     Vector2 leftLegPos = { pos.x - legWidth * 0.8f, pos.y + bodyShapeSize.y * 0.8f + bobOffset };
     Vector2 rightLegPos = { pos.x + legWidth * 0.3f, pos.y + bodyShapeSize.y * 0.8f + bobOffset };
 
-    DrawRectangle(leftLegPos.x, leftLegPos.y, legWidth, legHeight, zombieSkin);
-    DrawRectangle(rightLegPos.x, rightLegPos.y, legWidth, legHeight, zombieSkin);
+    renderer.drawRectangle({ leftLegPos.x, leftLegPos.y, legWidth, legHeight }, zombieSkin);
+    renderer.drawRectangle({ rightLegPos.x, rightLegPos.y, legWidth, legHeight }, zombieSkin);
 
     // Health bar (only if not dying/dead)
-    drawHealthBar(); // Health bar uses the un-faded health.
+    drawHealthBar(renderer); // Health bar uses the un-faded health.
 }
 
 
@@ -223,17 +189,11 @@ void Zombie::takeDamage(int dmg) {
     }
 }
 
-// --- Private Helper Functions for Internal Logic ---
-
-void Zombie::handleChasingState(Vector2 playerPos, float deltaTime, const std::vector<Rectangle>& walls) {
-    Vector2 dir = Vector2Normalize(Vector2Subtract(playerPos, pos));
-    float currentSpeed = speed;
+// --- Shared Behaviour (composed per archetype in ZombieTypes.cpp) ---
 
-    // Calculate desired movement for this frame
-    Vector2 desiredMove = Vector2Scale(dir, currentSpeed * deltaTime);
-    
+void Zombie::moveAndCollide(Vector2 direction, float distance, const WallList& walls) {
     // Apply desired movement
-    pos = Vector2Add(pos, desiredMove);
+    pos = Vector2Add(pos, Vector2Scale(direction, distance));
 
     // --- Robust Collision Resolution ---
     // Iterate multiple times to resolve cascades of collisions (e.g., in corners)
@@ -298,9 +258,9 @@ void Zombie::resolveSingleWallCollision(Vector2& circlePos, float circleRadius,
 }
 
 
-void Zombie::handleAttackingState(Vector2 playerPos, float deltaTime, float& playerHealth) {
-    float distToPlayer = Vector2Distance(pos, playerPos);
-    if (distToPlayer < size + 20.0f - ZOMBIE_ATTACK_RANGE_BUFFER && attackCooldownTimer <= 0) {
+void Zombie::handleAttackingState(float playerDistanceSq, float playerRadius, float& playerHealth) {
+    float reach = size + playerRadius - ZOMBIE_ATTACK_RANGE_BUFFER;
+    if (playerDistanceSq < reach * reach && attackCooldownTimer <= 0) {
         playerHealth -= damage;
         attackCooldownTimer = ZOMBIE_ATTACK_COOLDOWN;
     }
@@ -327,7 +287,7 @@ void Zombie::updateTimers(float deltaTime) {
 
 // --- Private Helper Functions for Drawing ---
 
-void Zombie::drawHealthBar() const {
+void Zombie::drawHealthBar(Renderer& renderer) const {
     // Only draw health bar if not dying and health > 0
     if (currentState == ZombieState::DYING || health <= 0) return;
 
@@ -339,15 +299,38 @@ void Zombie::drawHealthBar() const {
     float headRadius = size * 0.6f;
 
     Rectangle bgBar = { pos.x - barWidth / 2, headCenter.y - headRadius - 15, barWidth, barHeight };
-    DrawRectangleRec(bgBar, RED);
+    renderer.drawRectangle(bgBar, RED);
 
     Rectangle fgBar = { bgBar.x, bgBar.y, barWidth * healthPercent, barHeight };
-    DrawRectangleRec(fgBar, GREEN);
+    renderer.drawRectangle(fgBar, GREEN);
 }
 
-void Zombie::drawExplosionEffect() const {
+// The body's outline at a fraction of the primitives: same head, body and legs placement and bob
+// as draw(), flat colored, with only the eyes for a face
+void Zombie::drawSilhouette(Renderer& renderer, Color skin) const {
+    float bobOffset = sinf(GetTime() * 12.0f) * 3.0f;
+    float headRadius = size * 0.6f;
+    Vector2 headCenter = { pos.x, pos.y - size * 0.8f + bobOffset };
+    Vector2 bodyPos = { pos.x, pos.y + size * 0.15f + bobOffset };
+    float legWidth = size * 0.25f;
+    float legTop = pos.y + size * 0.7f * 0.8f + bobOffset;
+
+    renderer.drawRectangle({ pos.x - legWidth * 0.8f, legTop, legWidth * 2.1f, size * 0.75f }, skin); // Both legs
+    renderer.drawEllipse(bodyPos, size * 0.6f, size * 0.7f, skin);
+    renderer.drawCircle(headCenter, headRadius, skin);
+    Color pupilColor = CLITERAL(Color){ 150, 0, 0, 255 };
+    renderer.drawCircle({ headCenter.x + headRadius * 0.3f, headCenter.y - headRadius * 0.2f }, headRadius * 0.18f, pupilColor);
+    renderer.drawCircle({ headCenter.x - headRadius * 0.3f, headCenter.y - headRadius * 0.2f }, headRadius * 0.18f, pupilColor);
+}
+
+void Zombie::drawExplosionEffect(Renderer& renderer, ZombieDetail detail) const {
+    if (detail == ZombieDetail::Silhouette) {
+        renderer.drawCircle(pos, explosionRadius, ColorAlpha(ORANGE, explosionAlpha));
+        return;
+    }
+
     // Draw multiple concentric, fading circles for the explosion
-    int numCircles = 3;
+    int numCircles = detail == ZombieDetail::Full ? 3 : 1;
     for (int i = 0; i < numCircles; ++i) {
         float currentExplosionRadius = explosionRadius * (1.0f - (float)i / numCircles);
         float currentExplosionAlpha = explosionAlpha * (1.0f - (float)i / numCircles);
@@ -357,18 +340,18 @@ void Zombie::drawExplosionEffect() const {
         Color color2 = ColorAlpha(RED, (unsigned char)(currentExplosionAlpha * 0.7f * 255));
         Color color3 = ColorAlpha(DARKGRAY, (unsigned char)(currentExplosionAlpha * 0.4f * 255));
 
-        DrawCircleV(pos, currentExplosionRadius, color1);
-        DrawCircleLines(pos.x, pos.y, currentExplosionRadius * 0.8f, color2);
-        DrawCircleLines(pos.x, pos.y, currentExplosionRadius * 0.4f, color3);
+        renderer.drawCircle(pos, currentExplosionRadius, color1);
+        renderer.drawCircleLines(pos, currentExplosionRadius * 0.8f, color2);
+        renderer.drawCircleLines(pos, currentExplosionRadius * 0.4f, color3);
     }
 
     // Optional: Draw few small particles bursting outwards
-    int numParticles = 8;
+    int numParticles = detail == ZombieDetail::Full ? 8 : 4;
     for (int i = 0; i < numParticles; ++i) {
         float angle = (float)i * (360.0f / numParticles) * DEG2RAD;
         Vector2 particleDir = { cosf(angle), sinf(angle) };
         // Particles move faster as explosion expands
         Vector2 particlePos = Vector2Add(pos, Vector2Scale(particleDir, explosionRadius * 0.7f)); 
-        DrawCircleV(particlePos, 2 + explosionRadius * 0.05f, ColorAlpha(YELLOW, (unsigned char)(explosionAlpha * 255)));
+        renderer.drawCircle(particlePos, 2 + explosionRadius * 0.05f, ColorAlpha(YELLOW, (unsigned char)(explosionAlpha * 255)));
     }
 }
\ No newline at end of file
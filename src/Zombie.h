@@ -1,7 +1,30 @@
 #pragma once
 #include "raylib.h"
+#include <cstdint>
 #include <vector>
+#include <memory_resource>
 #include "raymath.h"
+#include "FloorArena.h" // WallList
+
+class Renderer;
+
+// Zombie archetypes. Their stats and behaviour are fixed at compile time (ZombieTypes.h); a zombie
+// only records which one it is, so the list stays one flat array of a single type.
+enum class ZombieKind : uint8_t {
+    Fast,
+    Tank,
+    Runner,  // Leaps at the player from mid range
+    Exploder, // Bursts next to the player, or wherever it is killed
+    Spitter   // Keeps its distance and spits at the player (EnemyProjectiles)
+};
+constexpr int ZOMBIE_KIND_COUNT = 5;
+
+// How much of a zombie is drawn; lowered by the quality governor when frames run over budget
+enum class ZombieDetail : uint8_t {
+    Full,      // The whole body, the death burst with all its rings and particles
+    Reduced,   // The body without teeth, scars, wounds or its drop shadow; the death burst with one ring and half the particles
+    Silhouette // Head, body and legs in flat color with the eyes; the death burst as one fading disc
+};
 
 class Zombie {
 public:
@@ -12,6 +35,17 @@ public:
         DEAD   // Ready for removal from game
     };
 
+    // What a Runner, an Exploder or a Spitter is in the middle of; the plain chasers stay at NONE
+    enum class Action : uint8_t {
+        NONE,
+        WINDUP,  // Runner crouching before a leap, Spitter rearing back before a spit
+        LEAPING, // Runner in the air along leapDirection
+        FUSE     // Exploder about to burst
+    };
+
+    uint32_t id; // Unique within a floor, assigned at spawn (WaveDirector); survives erases, so snapshots can delta by id
+    ZombieKind kind;
+    Action action;
     Vector2 pos;
     float speed;
     int health;
@@ -25,6 +59,8 @@ public:
     float attackCooldownTimer;
     float hitFlashTimer;
     float deathTimer; // Timer for the dying animation (explosion/fade)
+    float actionTimer; // Time left in the current action; with no action, until the next may start
+    Vector2 leapDirection;
 
     // Explosion specific properties
     float explosionRadius; // Current radius of the explosion effect
@@ -37,29 +73,36 @@ public:
     static const float ZOMBIE_ATTACK_RANGE_BUFFER;
     static const float ZOMBIE_EXPLOSION_MAX_RADIUS; // Max size of the explosion particles/effect
 
-    Zombie(Vector2 pos, float speed, int health, int damage, float size, Color color = GREEN);
-
-    virtual void update(Vector2 playerPos, float deltaTime, const std::vector<Rectangle>& walls, float& playerHealth);
-    virtual void draw() const;
+    // Zombies are made through the archetypes (SpawnZombie / MakeZombie in ZombieTypes.h)
+    Zombie(ZombieKind kind, Vector2 pos, float speed, int health, int damage, float size, Color color);
 
-    virtual void takeDamage(int dmg);
+    void takeDamage(int dmg);
     Vector2 getPos() const { return pos; }
     float getSize() const { return size; }
     bool isDead() const { return currentState == ZombieState::DEAD; }
+    bool isAlive() const { return currentState == ZombieState::CHASING || currentState == ZombieState::ATTACKING; }
 
-    virtual ~Zombie() = default;
-
-private:
-    void handleChasingState(Vector2 playerPos, float deltaTime, const std::vector<Rectangle>& walls);
-    void handleAttackingState(Vector2 playerPos, float deltaTime, float& playerHealth);
-    void handleDyingState(float deltaTime); // Updates explosion/fade
+    // --- Shared behaviour, composed by the archetype kernels (ZombieTypes.cpp) ---
     void updateTimers(float deltaTime);
+    // Steps 'distance' px towards 'direction', then pushes out of the walls
+    void moveAndCollide(Vector2 direction, float distance, const WallList& walls);
+    // Bites when the player (squared center distance 'playerDistanceSq', body 'playerRadius') is in reach
+    void handleAttackingState(float playerDistanceSq, float playerRadius, float& playerHealth);
+    void handleDyingState(float deltaTime); // Updates explosion/fade
+    // Starts the death animation once health has run out; true on the tick that happens
+    bool beginDyingIfKilled();
 
-    // Helper to check if zombie at a given position collides with any wall
-    bool checkWallCollision(Vector2 checkPos, float checkSize, const std::vector<Rectangle>& walls) const;
-    // New: Resolves a single circle-rectangle collision by pushing the circle out
+    // The standard body and health bar (or the death explosion); archetypes draw extras on top
+    void draw(Renderer& renderer, ZombieDetail detail = ZombieDetail::Full) const;
+
+private:
+    // Resolves a single circle-rectangle collision by pushing the circle out
     void resolveSingleWallCollision(Vector2& circlePos, float circleRadius, const Rectangle& wall) const;
 
-    void drawHealthBar() const;
-    void drawExplosionEffect() const; // Draws the death explosion
-};
\ No newline at end of file
+    void drawHealthBar(Renderer& renderer) const;
+    void drawSilhouette(Renderer& renderer, Color skin) const;
+    void drawExplosionEffect(Renderer& renderer, ZombieDetail detail) const; // Draws the death explosion
+};
+
+// Zombies of the current floor, backed by the floor's arena
+using ZombieList = std::pmr::vector<Zombie>;
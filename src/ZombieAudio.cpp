@@ -0,0 +1,104 @@
+#include "ZombieAudio.h"
+#include "Rng.h"
+#include <cmath>
+#include <cstdint>
+
+static const int SAMPLE_RATE = 22050;
+static const float TWO_PI = 6.2831853f;
+
+// Master level of each sound before distance attenuation
+static const float SOUND_VOLUME[ZOMBIE_SOUND_COUNT] = { 0.35f, 0.5f, 0.6f };
+
+// Mono 16-bit sample of 'seconds', from fn(t, noise) in -1..1; noise is white, from a fixed seed
+template <typename Fn>
+static Sound Synthesize(float seconds, uint64_t seed, Fn fn) {
+    std::vector<int16_t> data((size_t)(seconds * SAMPLE_RATE));
+    Rng rng(seed);
+    for (size_t i = 0; i < data.size(); ++i) {
+        float noise = rng.range(-1000, 1000) / 1000.0f;
+        float v = fn(i / (float)SAMPLE_RATE, noise);
+        v = std::fmax(-1.0f, std::fmin(1.0f, v));
+        data[i] = (int16_t)(v * 32000.0f);
+    }
+    Wave wave = { (unsigned int)data.size(), SAMPLE_RATE, 16, 1, data.data() };
+    return LoadSoundFromWave(wave); // Copies the samples
+}
+
+// A buzzy low voice: the first few harmonics at phase 'phi'
+static float Voice(float phi) {
+    return sinf(phi) + 0.5f * sinf(2 * phi) + 0.33f * sinf(3 * phi) + 0.25f * sinf(4 * phi);
+}
+
+static Sound MakeGroan() {
+    float seconds = ZOMBIE_SOUND_SECONDS[(int)ZombieSound::Groan];
+    float phi = 0.0f, rumble = 0.0f;
+    return Synthesize(seconds, 1, [&](float t, float noise) {
+        // Around 85 Hz with a slow wobble, sagging towards the end; swells in, trails off
+        float f = 85.0f * (1.0f + 0.06f * sinf(TWO_PI * 4.5f * t)) * (1.0f - 0.15f * t / seconds);
+        phi += TWO_PI * f / SAMPLE_RATE;
+        rumble += 0.1f * (noise - rumble); // Low-passed breath
+        float envelope = std::fmin(t / 0.12f, 1.0f) * std::fmin((seconds - t) / 0.35f, 1.0f);
+        return envelope * (0.3f * Voice(phi) + 0.5f * rumble);
+    });
+}
+
+static Sound MakeHit() {
+    float seconds = ZOMBIE_SOUND_SECONDS[(int)ZombieSound::Hit];
+    float thud = 0.0f;
+    return Synthesize(seconds, 2, [&](float t, float noise) {
+        // A wet smack: a noise burst over a 160 Hz thump, gone in a few hundredths of a second
+        thud += 0.3f * (noise - thud);
+        return expf(-t * 30.0f) * (0.6f * thud + 0.5f * sinf(TWO_PI * 160.0f * t));
+    });
+}
+
+static Sound MakeDeath() {
+    float seconds = ZOMBIE_SOUND_SECONDS[(int)ZombieSound::Death];
+    float phi = 0.0f, burst = 0.0f;
+    return Synthesize(seconds, 3, [&](float t, float noise) {
+        // A howl falling from 160 to 55 Hz over the burst of the body going
+        float f = 160.0f - 105.0f * t / seconds;
+        phi += TWO_PI * f / SAMPLE_RATE;
+        burst += 0.4f * (noise - burst);
+        float envelope = std::fmin(t / 0.02f, 1.0f) * (1.0f - t / seconds);
+        return envelope * (0.3f * Voice(phi) + 0.7f * burst * expf(-t * 8.0f));
+    });
+}
+
+ZombieAudio::ZombieAudio(int voiceSlots) : ready(IsAudioDeviceReady()), samples{}, slotSound(voiceSlots, -1) {
+    if (!ready) return; // Headless, or the device failed to open: stay silent
+    samples[(int)ZombieSound::Groan] = MakeGroan();
+    samples[(int)ZombieSound::Hit] = MakeHit();
+    samples[(int)ZombieSound::Death] = MakeDeath();
+    for (int slot = 0; slot < voiceSlots; ++slot) {
+        for (int sound = 0; sound < ZOMBIE_SOUND_COUNT; ++sound) aliases.push_back(LoadSoundAlias(samples[sound]));
+    }
+}
+
+ZombieAudio::~ZombieAudio() {
+    unload();
+}
+
+void ZombieAudio::unload() {
+    if (!ready) return;
+    for (Sound& alias : aliases) UnloadSoundAlias(alias);
+    for (Sound& sample : samples) UnloadSound(sample);
+    aliases.clear();
+    ready = false;
+}
+
+void ZombieAudio::play(const std::vector<VoiceStart>& starts) {
+    if (!ready) return;
+    for (const VoiceStart& start : starts) {
+        int sound = (int)start.voice.sound;
+        int previous = slotSound[start.slot];
+        if (previous >= 0 && previous != sound) StopSound(aliases[start.slot * ZOMBIE_SOUND_COUNT + previous]);
+        slotSound[start.slot] = sound;
+
+        Sound& alias = aliases[start.slot * ZOMBIE_SOUND_COUNT + sound];
+        SetSoundVolume(alias, SOUND_VOLUME[sound] * start.voice.gain);
+        SetSoundPan(alias, 0.5f - 0.5f * start.voice.pan); // raylib 5.0: 0.5 is center, 1.0 full left
+        SetSoundPitch(alias, start.voice.pitch);
+        PlaySound(alias); // Restarts it if this slot was already playing the same sound
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "raylib.h"
+#include "ZombieVoices.h"
+#include <vector>
+
+// Plays the zombie voices VoiceScheduler starts. There are no sample files for zombies, so the
+// groan, hit and death samples are synthesized once at startup (ZOMBIE_SOUND_SECONDS long); each
+// voice slot gets its own alias of every sample, so slots play, pan and pitch independently.
+// Does nothing without an audio device.
+class ZombieAudio {
+public:
+    explicit ZombieAudio(int voiceSlots);
+    ~ZombieAudio();
+
+    ZombieAudio(const ZombieAudio&) = delete;
+    ZombieAudio& operator=(const ZombieAudio&) = delete;
+
+    void play(const std::vector<VoiceStart>& starts);
+    void unload(); // Before CloseAudioDevice; the destructor calls it too
+
+private:
+    bool ready;
+    Sound samples[ZOMBIE_SOUND_COUNT];
+    std::vector<Sound> aliases; // slot * ZOMBIE_SOUND_COUNT + sound
+    std::vector<int> slotSound; // Sound each slot last played, -1 before its first
+};
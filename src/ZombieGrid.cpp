@@ -0,0 +1,191 @@
+#include "ZombieGrid.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+const float ZombieGrid::DEFAULT_CELL_SIZE = 64.0f;
+
+ZombieGrid::ZombieGrid() : zombies(nullptr), cellSize(DEFAULT_CELL_SIZE), cols(0), rows(0), maxZombieSize(0.0f) {}
+
+static int ClampInt(int value, int min, int max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+int ZombieGrid::cellOf(Vector2 p) const {
+    int col = ClampInt((int)floorf(p.x / cellSize), 0, cols - 1);
+    int row = ClampInt((int)floorf(p.y / cellSize), 0, rows - 1);
+    return row * cols + col;
+}
+
+int ZombieGrid::rowOf(float y) const {
+    return ClampInt((int)floorf(y / cellSize), 0, rows - 1);
+}
+
+bool ZombieGrid::segmentColumns(Vector2 from, Vector2 to, float radius, int row, int& minCol, int& maxCol) const {
+    // The row's band of y, widened by 'radius'; border rows reach out to the zombies clamped into them
+    float low = row == 0 ? -FLT_MAX : row * cellSize - radius;
+    float high = row == rows - 1 ? FLT_MAX : (row + 1) * cellSize + radius;
+
+    // Part of the segment inside the band, as a parameter range
+    float t0 = 0.0f, t1 = 1.0f;
+    float dy = to.y - from.y;
+    if (dy == 0.0f) {
+        if (from.y < low || from.y > high) return false;
+    } else {
+        float a = (low - from.y) / dy;
+        float b = (high - from.y) / dy;
+        if (a > b) { float t = a; a = b; b = t; }
+        if (a > t0) t0 = a;
+        if (b < t1) t1 = b;
+        if (t0 > t1) return false;
+    }
+    float x0 = from.x + (to.x - from.x) * t0;
+    float x1 = from.x + (to.x - from.x) * t1;
+    if (x0 > x1) { float x = x0; x0 = x1; x1 = x; }
+    minCol = ClampInt((int)floorf((x0 - radius) / cellSize), 0, cols - 1);
+    maxCol = ClampInt((int)floorf((x1 + radius) / cellSize), 0, cols - 1);
+    return true;
+}
+
+void ZombieGrid::cellRange(Vector2 center, float radius, int& minCol, int& minRow, int& maxCol, int& maxRow) const {
+    // Clamped like cellOf(), so a query near the edge also reaches zombies parked in the border cells
+    minCol = ClampInt((int)floorf((center.x - radius) / cellSize), 0, cols - 1);
+    minRow = ClampInt((int)floorf((center.y - radius) / cellSize), 0, rows - 1);
+    maxCol = ClampInt((int)floorf((center.x + radius) / cellSize), 0, cols - 1);
+    maxRow = ClampInt((int)floorf((center.y + radius) / cellSize), 0, rows - 1);
+}
+
+void ZombieGrid::build(const ZombieList& zombieList, float worldWidth, float worldHeight, float newCellSize) {
+    zombies = &zombieList;
+    cellSize = newCellSize;
+    cols = (int)ceilf(worldWidth / cellSize);
+    rows = (int)ceilf(worldHeight / cellSize);
+    if (cols < 1) cols = 1;
+    if (rows < 1) rows = 1;
+
+    int cellCount = cols * rows;
+    int count = (int)zombieList.size();
+    cellStart.assign(cellCount + 1, 0);
+    zombieCell.resize(count);
+    cellZombies.resize(count);
+
+    // Pass 1: count per cell (shifted by one so the prefix sum yields start offsets)
+    maxZombieSize = 0.0f;
+    for (int z = 0; z < count; ++z) {
+        if (zombieList[z].size > maxZombieSize) maxZombieSize = zombieList[z].size;
+        int cell = cellOf(zombieList[z].pos);
+        zombieCell[z] = cell;
+        cellStart[cell + 1]++;
+    }
+    for (int i = 0; i < cellCount; ++i) cellStart[i + 1] += cellStart[i];
+
+    // Pass 2: scatter, walking each cell's cursor up from its start (restored by the shift below)
+    for (int z = 0; z < count; ++z) {
+        cellZombies[cellStart[zombieCell[z]]++] = z;
+    }
+    for (int i = cellCount; i > 0; --i) cellStart[i] = cellStart[i - 1];
+    cellStart[0] = 0;
+}
+
+void ZombieGrid::clear() {
+    zombies = nullptr;
+    maxZombieSize = 0.0f;
+    cellStart.clear();
+    cellZombies.clear();
+}
+
+int ZombieGrid::nearestAlive(Vector2 point, float maxRadius) const {
+    if (!zombies || zombies->empty()) return -1;
+    int centerCol = ClampInt((int)floorf(point.x / cellSize), 0, cols - 1);
+    int centerRow = ClampInt((int)floorf(point.y / cellSize), 0, rows - 1);
+    int maxRing = (int)ceilf(maxRadius / cellSize) + 1;
+    int gridRings = cols > rows ? cols : rows;
+    if (maxRing > gridRings) maxRing = gridRings;
+
+    int best = -1;
+    float bestDistSq = maxRadius * maxRadius;
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        // Every cell in this ring is at least (ring - 1) cells away from the point
+        if (best >= 0 && ring > 1) {
+            float minDist = (ring - 1) * cellSize;
+            if (minDist * minDist > bestDistSq) break;
+        }
+        for (int row = centerRow - ring; row <= centerRow + ring; ++row) {
+            if (row < 0 || row >= rows) continue;
+            bool edgeRow = row == centerRow - ring || row == centerRow + ring;
+            int step = edgeRow ? 1 : 2 * ring; // Interior rows of the ring only have their two end cells
+            for (int col = centerCol - ring; col <= centerCol + ring; col += step) {
+                if (col < 0 || col >= cols) continue;
+                int cell = row * cols + col;
+                for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                    const Zombie& zombie = (*zombies)[cellZombies[i]];
+                    if (zombie.currentState == Zombie::ZombieState::DYING || zombie.currentState == Zombie::ZombieState::DEAD) continue;
+                    float dx = zombie.pos.x - point.x;
+                    float dy = zombie.pos.y - point.y;
+                    float distSq = dx * dx + dy * dy;
+                    if (distSq < bestDistSq || (best < 0 && distSq <= bestDistSq)) {
+                        bestDistSq = distSq;
+                        best = cellZombies[i];
+                    }
+                }
+            }
+        }
+    }
+    return best;
+}
+
+int ZombieGrid::nearest(Vector2 point, float maxRadius, int maxCount, std::vector<Neighbour>& out) const {
+    out.clear();
+    if (!zombies || zombies->empty() || maxCount <= 0) return 0;
+    int centerCol = ClampInt((int)floorf(point.x / cellSize), 0, cols - 1);
+    int centerRow = ClampInt((int)floorf(point.y / cellSize), 0, rows - 1);
+    int maxRing = (int)ceilf(maxRadius / cellSize) + 1;
+    int gridRings = cols > rows ? cols : rows;
+    if (maxRing > gridRings) maxRing = gridRings;
+
+    // 'out' is a max-heap on distance while searching: its top is the one to replace
+    auto farther = [](const Neighbour& a, const Neighbour& b) { return a.distanceSq < b.distanceSq; };
+    float maxDistSq = maxRadius * maxRadius;
+    int examined = 0;
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        if (ring > 1) {
+            float minDist = (ring - 1) * cellSize;
+            if (minDist * minDist > maxDistSq) break;
+            if ((int)out.size() == maxCount && minDist * minDist > out.front().distanceSq) break;
+        }
+        for (int row = centerRow - ring; row <= centerRow + ring; ++row) {
+            if (row < 0 || row >= rows) continue;
+            bool edgeRow = row == centerRow - ring || row == centerRow + ring;
+            int step = edgeRow ? 1 : 2 * ring;
+            for (int col = centerCol - ring; col <= centerCol + ring; col += step) {
+                if (col < 0 || col >= cols) continue;
+                int cell = row * cols + col;
+                for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                    const Zombie& zombie = (*zombies)[cellZombies[i]];
+                    examined++;
+                    if (zombie.currentState == Zombie::ZombieState::DEAD) continue;
+                    float dx = zombie.pos.x - point.x;
+                    float dy = zombie.pos.y - point.y;
+                    float distSq = dx * dx + dy * dy;
+                    if (distSq > maxDistSq) continue;
+                    if ((int)out.size() < maxCount) {
+                        out.push_back({ distSq, cellZombies[i] });
+                        std::push_heap(out.begin(), out.end(), farther);
+                    } else if (distSq < out.front().distanceSq) {
+                        std::pop_heap(out.begin(), out.end(), farther);
+                        out.back() = { distSq, cellZombies[i] };
+                        std::push_heap(out.begin(), out.end(), farther);
+                    }
+                }
+            }
+        }
+    }
+    std::sort_heap(out.begin(), out.end(), farther);
+    return examined;
+}
+
+int ZombieGrid::countInRadius(Vector2 center, float radius) const {
+    int count = 0;
+    forEachInRadius(center, radius, [&count](int, const Zombie&) { count++; });
+    return count;
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "raylib.h"
+#include "Zombie.h"
+#include <vector>
+
+// Uniform-grid index over the floor's zombies, rebuilt from scratch every tick (World::step) with
+// a counting sort: one offsets array per cell plus one flat array of zombie indices, laid out like
+// WallIndex. Radius and nearest-neighbour queries then touch only the cells around the query
+// instead of every zombie. Zombies outside the world (the spawn ring) are clamped into the border
+// cells, so every zombie is indexed. Storage is reused between builds; it only grows.
+class ZombieGrid {
+public:
+    static const float DEFAULT_CELL_SIZE;
+
+    ZombieGrid();
+
+    void build(const ZombieList& zombies, float worldWidth, float worldHeight, float cellSize = DEFAULT_CELL_SIZE);
+    void clear();
+
+    // Calls fn(int index, const Zombie&) for every zombie whose center lies within 'radius' of
+    // 'center' (pass radius + zombie size to test overlap). Dying zombies are included.
+    template <typename Fn>
+    void forEachInRadius(Vector2 center, float radius, Fn&& fn) const {
+        if (!zombies || zombies->empty()) return;
+        int minCol, minRow, maxCol, maxRow;
+        cellRange(center, radius, minCol, minRow, maxCol, maxRow);
+        float radiusSq = radius * radius;
+        for (int row = minRow; row <= maxRow; ++row) {
+            for (int col = minCol; col <= maxCol; ++col) {
+                int cell = row * cols + col;
+                for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                    int index = cellZombies[i];
+                    const Zombie& zombie = (*zombies)[index];
+                    float dx = zombie.pos.x - center.x;
+                    float dy = zombie.pos.y - center.y;
+                    if (dx * dx + dy * dy <= radiusSq) fn(index, zombie);
+                }
+            }
+        }
+    }
+
+    // Calls fn(int index, const Zombie&) for every zombie whose cell lies within 'radius' of the
+    // segment from 'from' to 'to', each once. A superset: the caller does the exact test, and
+    // passes radius >= getMaxZombieSize() to catch every zombie whose body touches the segment.
+    template <typename Fn>
+    void forEachNearSegment(Vector2 from, Vector2 to, float radius, Fn&& fn) const {
+        if (!zombies || zombies->empty()) return;
+        int minRow = rowOf((from.y < to.y ? from.y : to.y) - radius);
+        int maxRow = rowOf((from.y > to.y ? from.y : to.y) + radius);
+        for (int row = minRow; row <= maxRow; ++row) {
+            int minCol, maxCol;
+            if (!segmentColumns(from, to, radius, row, minCol, maxCol)) continue;
+            // A row's cells are contiguous in the compressed layout: one slice covers the span
+            for (int i = cellStart[row * cols + minCol]; i < cellStart[row * cols + maxCol + 1]; ++i) {
+                int index = cellZombies[i];
+                fn(index, (*zombies)[index]);
+            }
+        }
+    }
+
+    // Largest Zombie::size at the last build
+    float getMaxZombieSize() const { return maxZombieSize; }
+    // Zombies indexed at the last build: the first this many of the list
+    int getIndexedCount() const { return (int)zombieCell.size(); }
+
+    // Index of the closest zombie that is still alive (chasing or attacking) within 'maxRadius'
+    // of 'point', or -1. Searches outward ring by ring and stops once no closer cell remains.
+    int nearestAlive(Vector2 point, float maxRadius) const;
+
+    struct Neighbour {
+        float distanceSq;
+        int index;
+    };
+    // The up to 'maxCount' zombies closest to 'point' within 'maxRadius', dying ones included (dead
+    // ones are not), nearest first in 'out'. Searches outward ring by ring like nearestAlive and
+    // stops once the list is full and no closer cell remains, so a dense crowd costs the cells
+    // around the point, not the crowd. Returns the number of zombies examined.
+    int nearest(Vector2 point, float maxRadius, int maxCount, std::vector<Neighbour>& out) const;
+
+    int countInRadius(Vector2 center, float radius) const;
+
+    int getCols() const { return cols; }
+    int getRows() const { return rows; }
+    float getCellSize() const { return cellSize; }
+
+private:
+    const ZombieList* zombies;
+    float cellSize;
+    int cols;
+    int rows;
+    std::vector<int> cellStart;   // cols*rows + 1 offsets into cellZombies
+    std::vector<int> cellZombies; // Zombie indices, grouped by cell
+    std::vector<int> zombieCell;  // Cell of each zombie, kept from the counting pass for the scatter pass
+    float maxZombieSize;
+
+    int cellOf(Vector2 p) const;
+    int rowOf(float y) const;
+    // Columns of 'row' within 'radius' of the segment; false when the segment stays clear of the row
+    bool segmentColumns(Vector2 from, Vector2 to, float radius, int row, int& minCol, int& maxCol) const;
+    void cellRange(Vector2 center, float radius, int& minCol, int& minRow, int& maxCol, int& maxRow) const;
+};
@@ -0,0 +1,265 @@
+#include "ZombieTypes.h"
+#include "Renderer.h"
+#include "raymath.h"
+
+#ifndef CLAMP
+#define CLAMP(value, min, max) ((value < min) ? min : (value > max) ? max : value)
+#endif
+
+// --- Behaviour hooks. The primary templates are the plain chaser; archetypes that behave
+// differently specialize them. Kernels call them with the archetype fixed at compile time. ---
+
+// Movement while chasing: walk straight at the player
+template <typename Archetype>
+static void Chase(Zombie& zombie, ZombieContext& context) {
+    Vector2 dir = Vector2Normalize(Vector2Subtract(context.playerPos, zombie.pos));
+    zombie.moveAndCollide(dir, zombie.speed * context.deltaTime, context.walls);
+}
+
+// Runs on the tick the zombie starts dying
+template <typename Archetype>
+static void OnDeath(Zombie&, ZombieContext&) {}
+
+// Drawn over the standard body of a live zombie
+template <typename Archetype>
+static void DrawExtras(Renderer&, const Zombie&) {}
+
+template <>
+void Chase<RunnerZombie>(Zombie& zombie, ZombieContext& context) {
+    using Runner = RunnerZombie;
+    float dt = context.deltaTime;
+    switch (zombie.action) {
+        case Zombie::Action::WINDUP:
+            zombie.actionTimer -= dt;
+            if (zombie.actionTimer <= 0) {
+                // Aim at where the player is now, not where they were when the crouch began
+                zombie.action = Zombie::Action::LEAPING;
+                zombie.actionTimer = Runner::LEAP_DURATION;
+                zombie.leapDirection = Vector2Normalize(Vector2Subtract(context.playerPos, zombie.pos));
+            }
+            return;
+        case Zombie::Action::LEAPING:
+            zombie.moveAndCollide(zombie.leapDirection, Runner::LEAP_SPEED * dt, context.walls);
+            zombie.actionTimer -= dt;
+            if (zombie.actionTimer <= 0) {
+                zombie.action = Zombie::Action::NONE;
+                zombie.actionTimer = Runner::LEAP_COOLDOWN;
+            }
+            return;
+        default:
+            break;
+    }
+
+    if (zombie.actionTimer > 0) zombie.actionTimer -= dt; // Cooling down from the last leap
+    float distance = Vector2Distance(zombie.pos, context.playerPos);
+    if (zombie.actionTimer <= 0 && distance >= Runner::LEAP_MIN_RANGE && distance <= Runner::LEAP_RANGE) {
+        zombie.action = Zombie::Action::WINDUP;
+        zombie.actionTimer = Runner::LEAP_WINDUP;
+        return;
+    }
+    Chase<FastZombie>(zombie, context);
+}
+
+template <>
+void DrawExtras<RunnerZombie>(Renderer& renderer, const Zombie& zombie) {
+    if (zombie.action == Zombie::Action::WINDUP) {
+        // Dust kicked up by the crouch
+        renderer.drawEllipse({ zombie.pos.x, zombie.pos.y + zombie.size * 1.4f }, zombie.size * 1.2f, zombie.size * 0.3f,
+                             ColorAlpha(Color{ 120, 100, 80, 255 }, 0.6f));
+    } else if (zombie.action == Zombie::Action::LEAPING) {
+        // Speed streaks trailing the leap
+        Vector2 back = Vector2Negate(zombie.leapDirection);
+        Vector2 side = { -back.y * zombie.size * 0.5f, back.x * zombie.size * 0.5f };
+        for (int i = -1; i <= 1; ++i) {
+            Vector2 from = Vector2Add(Vector2Add(zombie.pos, Vector2Scale(back, zombie.size)), Vector2Scale(side, (float)i));
+            renderer.drawLine(from, Vector2Add(from, Vector2Scale(back, zombie.size * 1.5f)), 2, ColorAlpha(RAYWHITE, 0.5f));
+        }
+    }
+}
+
+template <>
+void Chase<ExploderZombie>(Zombie& zombie, ZombieContext& context) {
+    using Exploder = ExploderZombie;
+    if (zombie.action == Zombie::Action::FUSE) {
+        zombie.actionTimer -= context.deltaTime;
+        if (zombie.actionTimer <= 0) zombie.health = 0; // Bursts through OnDeath this very tick
+        return;
+    }
+    float gap = Vector2Distance(zombie.pos, context.playerPos) - zombie.size - context.playerSize;
+    if (gap <= Exploder::FUSE_RANGE) {
+        zombie.action = Zombie::Action::FUSE;
+        zombie.actionTimer = Exploder::FUSE_TIME;
+        return;
+    }
+    Chase<FastZombie>(zombie, context);
+}
+
+template <>
+void OnDeath<ExploderZombie>(Zombie& zombie, ZombieContext& context) {
+    context.bursts.push_back({ zombie.pos, ExploderZombie::BURST_RADIUS, ExploderZombie::BURST_DAMAGE });
+}
+
+template <>
+void DrawExtras<ExploderZombie>(Renderer& renderer, const Zombie& zombie) {
+    // Swollen pustules on the belly; a lit fuse makes them glow and a warning ring pulse
+    bool lit = zombie.action == Zombie::Action::FUSE;
+    Color pustule = lit ? ORANGE : Color{ 210, 220, 90, 255 };
+    float r = zombie.size;
+    renderer.drawCircle({ zombie.pos.x - r * 0.25f, zombie.pos.y + r * 0.1f }, r * 0.18f, pustule);
+    renderer.drawCircle({ zombie.pos.x + r * 0.2f, zombie.pos.y + r * 0.35f }, r * 0.14f, pustule);
+    if (lit) {
+        float pulse = 1.0f - zombie.actionTimer / ExploderZombie::FUSE_TIME; // 0 -> 1 as the fuse burns
+        renderer.drawCircleLines(zombie.pos, r * (1.2f + 0.5f * pulse), ColorAlpha(RED, 0.4f + 0.6f * pulse));
+    }
+}
+
+template <>
+void Chase<SpitterZombie>(Zombie& zombie, ZombieContext& context) {
+    using Spitter = SpitterZombie;
+    if (zombie.action == Zombie::Action::WINDUP) {
+        zombie.actionTimer -= context.deltaTime;
+        if (zombie.actionTimer <= 0) {
+            // Spit from the edge of the body at where the player is now; a full pool swallows the shot
+            Vector2 dir = Vector2Normalize(Vector2Subtract(context.playerPos, zombie.pos));
+            Vector2 mouth = Vector2Add(zombie.pos, Vector2Scale(dir, zombie.size));
+            context.projectiles.spawn({ mouth, Vector2Scale(dir, Spitter::SPIT_SPEED), Spitter::SPIT_LIFETIME, Spitter::SPIT_DAMAGE });
+            zombie.action = Zombie::Action::NONE;
+            zombie.actionTimer = Spitter::SPIT_INTERVAL;
+        }
+        return;
+    }
+
+    bool inRange = Vector2Distance(zombie.pos, context.playerPos) <= Spitter::SPIT_RANGE;
+    if (zombie.actionTimer > 0) {
+        // Between spits: hold ground while the player stays in range, without re-checking the line
+        zombie.actionTimer -= context.deltaTime;
+        if (!inRange) Chase<FastZombie>(zombie, context);
+        return;
+    }
+    // Ready: spit if the player is in sight (the ray is only cast in range), else close in
+    if (inRange && context.occupancy.lineOfSight(zombie.pos, context.playerPos)) {
+        zombie.action = Zombie::Action::WINDUP;
+        zombie.actionTimer = Spitter::SPIT_WINDUP;
+    } else {
+        Chase<FastZombie>(zombie, context);
+    }
+}
+
+template <>
+void DrawExtras<SpitterZombie>(Renderer& renderer, const Zombie& zombie) {
+    // A swollen throat sac that bulges while rearing back to spit
+    float r = zombie.size;
+    float swell = 0.0f;
+    if (zombie.action == Zombie::Action::WINDUP) swell = 1.0f - zombie.actionTimer / SpitterZombie::SPIT_WINDUP;
+    renderer.drawCircle({ zombie.pos.x, zombie.pos.y + r * 0.45f }, r * (0.25f + 0.15f * swell), Color{ 170, 220, 60, 255 });
+}
+
+// --- Kernels: one archetype's batch at a time ---
+
+template <typename Archetype>
+static void UpdateBatch(Zombie* zombies, const int* indices, int count, ZombieContext& context) {
+    // Melee reach is measured against the player's body; distances come from the contact query
+    float playerRadius = context.playerSize;
+    ZombieContext farContext = context; // Far zombies on their update tick catch up the ticks they skipped
+    farContext.deltaTime = context.deltaTime * context.farStride;
+    for (int i = 0; i < count; ++i) {
+        Zombie& zombie = zombies[indices[i]];
+        if (zombie.currentState == Zombie::ZombieState::DEAD) continue; // No updates for fully dead zombies
+
+        ZombieContext* zombieContext = &context;
+        if (context.farStride > 1 && zombie.currentState == Zombie::ZombieState::CHASING &&
+            Vector2DistanceSqr(zombie.pos, context.playerPos) > FAR_UPDATE_DISTANCE * FAR_UPDATE_DISTANCE) {
+            if ((zombie.id + context.tick) % (uint64_t)context.farStride != 0) {
+                // Skipped this tick, but a zombie shot dead starts dying now, not on its next update
+                if (zombie.beginDyingIfKilled()) {
+                    OnDeath<Archetype>(zombie, context);
+                    zombie.health = CLAMP(zombie.health, 0, zombie.maxHealth);
+                }
+                continue;
+            }
+            zombieContext = &farContext;
+        }
+
+        float distanceSq = context.playerDistanceSq[indices[i]];
+        float touch = zombie.size + playerRadius;
+        zombie.updateTimers(zombieContext->deltaTime);
+        switch (zombie.currentState) {
+            case Zombie::ZombieState::CHASING: {
+                Chase<Archetype>(zombie, *zombieContext);
+                float reach = touch - Zombie::ZOMBIE_ATTACK_RANGE_BUFFER;
+                if (Archetype::DAMAGE > 0 && zombie.action == Zombie::Action::NONE && distanceSq < reach * reach &&
+                    zombie.attackCooldownTimer <= 0) {
+                    zombie.currentState = Zombie::ZombieState::ATTACKING;
+                }
+                break;
+            }
+            case Zombie::ZombieState::ATTACKING:
+                zombie.handleAttackingState(distanceSq, playerRadius, context.playerHealth);
+                if (distanceSq >= touch * touch || zombie.attackCooldownTimer > 0) {
+                    zombie.currentState = Zombie::ZombieState::CHASING;
+                }
+                break;
+            case Zombie::ZombieState::DYING:
+                zombie.handleDyingState(context.deltaTime); // This will update explosion and deathTimer
+                if (zombie.deathTimer <= 0) zombie.currentState = Zombie::ZombieState::DEAD; // Transition to fully DEAD
+                break;
+            case Zombie::ZombieState::DEAD:
+                break;
+        }
+
+        if (zombie.beginDyingIfKilled()) OnDeath<Archetype>(zombie, context);
+        // Ensure health doesn't go below 0 (important for drawing health bar)
+        zombie.health = CLAMP(zombie.health, 0, zombie.maxHealth);
+    }
+}
+
+template <typename Archetype>
+static void DrawBatch(Renderer& renderer, const Zombie* zombies, const int* indices, int count, ZombieDetail detail) {
+    for (int i = 0; i < count; ++i) {
+        const Zombie& zombie = zombies[indices[i]];
+        zombie.draw(renderer, detail);
+        if (zombie.isAlive()) DrawExtras<Archetype>(renderer, zombie);
+    }
+}
+
+void DrawZombies(Renderer& renderer, const Zombie* zombies, ZombieKind kind, const int* indices, int count, ZombieDetail detail) {
+    switch (kind) {
+        case ZombieKind::Fast: DrawBatch<FastZombie>(renderer, zombies, indices, count, detail); break;
+        case ZombieKind::Tank: DrawBatch<TankZombie>(renderer, zombies, indices, count, detail); break;
+        case ZombieKind::Runner: DrawBatch<RunnerZombie>(renderer, zombies, indices, count, detail); break;
+        case ZombieKind::Exploder: DrawBatch<ExploderZombie>(renderer, zombies, indices, count, detail); break;
+        case ZombieKind::Spitter: DrawBatch<SpitterZombie>(renderer, zombies, indices, count, detail); break;
+    }
+}
+
+// --- ZombieBatches ---
+
+void ZombieBatches::build(const Zombie* zombies, int count) {
+    int counts[ZOMBIE_KIND_COUNT] = {};
+    for (int i = 0; i < count; ++i) counts[(int)zombies[i].kind]++;
+    start[0] = 0;
+    for (int k = 0; k < ZOMBIE_KIND_COUNT; ++k) start[k + 1] = start[k] + counts[k];
+
+    indices.resize(count);
+    int cursor[ZOMBIE_KIND_COUNT];
+    for (int k = 0; k < ZOMBIE_KIND_COUNT; ++k) cursor[k] = start[k];
+    for (int i = 0; i < count; ++i) indices[cursor[(int)zombies[i].kind]++] = i;
+}
+
+void ZombieBatches::update(Zombie* zombies, ZombieContext& context) const {
+    const int* batch = indices.data();
+    UpdateBatch<FastZombie>(zombies, batch + start[(int)ZombieKind::Fast], getCount(ZombieKind::Fast), context);
+    UpdateBatch<TankZombie>(zombies, batch + start[(int)ZombieKind::Tank], getCount(ZombieKind::Tank), context);
+    UpdateBatch<RunnerZombie>(zombies, batch + start[(int)ZombieKind::Runner], getCount(ZombieKind::Runner), context);
+    UpdateBatch<ExploderZombie>(zombies, batch + start[(int)ZombieKind::Exploder], getCount(ZombieKind::Exploder), context);
+    UpdateBatch<SpitterZombie>(zombies, batch + start[(int)ZombieKind::Spitter], getCount(ZombieKind::Spitter), context);
+}
+
+void ZombieBatches::draw(Renderer& renderer, const Zombie* zombies, ZombieDetail detail) const {
+    const int* batch = indices.data();
+    DrawBatch<FastZombie>(renderer, zombies, batch + start[(int)ZombieKind::Fast], getCount(ZombieKind::Fast), detail);
+    DrawBatch<TankZombie>(renderer, zombies, batch + start[(int)ZombieKind::Tank], getCount(ZombieKind::Tank), detail);
+    DrawBatch<RunnerZombie>(renderer, zombies, batch + start[(int)ZombieKind::Runner], getCount(ZombieKind::Runner), detail);
+    DrawBatch<ExploderZombie>(renderer, zombies, batch + start[(int)ZombieKind::Exploder], getCount(ZombieKind::Exploder), detail);
+    DrawBatch<SpitterZombie>(renderer, zombies, batch + start[(int)ZombieKind::Spitter], getCount(ZombieKind::Spitter), detail);
+}
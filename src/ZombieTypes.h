@@ -1,16 +1,175 @@
 // ZombieTypes.h
 #pragma once
 #include "Zombie.h"
+#include "Player.h" // Explosion
+#include "OccupancyGrid.h"
+#include "EnemyProjectiles.h"
 #include "raylib.h"
+#include <vector>
 
-class FastZombie : public Zombie {
-public:
-    FastZombie(Vector2 pos) : Zombie(pos, 120.0f, 50, 5, 15.0f, RED) {}
-    // No draw override — use base draw() which respects bodyColor
+// Compile-time zombie archetypes. Each is a traits struct of constants; its behaviour is a set of
+// static hooks that the update and draw kernels (ZombieTypes.cpp) are instantiated with, and
+// ZombieBatches runs each kernel over one archetype's zombies at a time. The per-zombie loops
+// therefore have no virtual calls and no switch on the zombie's kind.
+
+// Everything a zombie update reads or affects outside the zombie itself
+struct ZombieContext {
+    Vector2 playerPos;
+    float playerSize;
+    float deltaTime;
+    const WallList& walls;
+    const OccupancyGrid& occupancy; // Line of sight for ranged attackers
+    // Per zombie index: squared distance to the player for zombies in contact range (from World's
+    // one contact query per step, taken before the zombies move), infinity for every other zombie
+    const float* playerDistanceSq;
+    float& playerHealth;
+    std::vector<Explosion>& bursts; // Exploders that went off; World::step resolves them
+    EnemyProjectiles& projectiles;  // Where ranged attackers fire into
+    // Chasing zombies farther than FAR_UPDATE_DISTANCE from the player update only every
+    // 'farStride'-th tick (staggered by id), with deltaTime scaled to match; 1 updates all every tick
+    int farStride;
+    uint64_t tick;
+};
+
+struct FastZombie {
+    static constexpr ZombieKind KIND = ZombieKind::Fast;
+    static constexpr float SPEED = 120.0f;
+    static constexpr int HEALTH = 50;
+    static constexpr int DAMAGE = 5;
+    static constexpr float SIZE = 15.0f;
+    static constexpr Color COLOR = RED;
+    static constexpr float SPAWN_COST = 1.0f;
+    static constexpr int SPAWN_WEIGHT = 40; // Relative odds of being rolled by the WaveDirector
+};
+
+struct TankZombie {
+    static constexpr ZombieKind KIND = ZombieKind::Tank;
+    static constexpr float SPEED = 40.0f;
+    static constexpr int HEALTH = 200;
+    static constexpr int DAMAGE = 20;
+    static constexpr float SIZE = 25.0f;
+    static constexpr Color COLOR = DARKGREEN;
+    static constexpr float SPAWN_COST = 2.0f;
+    static constexpr int SPAWN_WEIGHT = 25;
+};
+
+// Shambles slowly until the player is in leaping range, crouches for a moment (the tell), then
+// flies at where the player stood, and needs a breather before the next leap
+struct RunnerZombie {
+    static constexpr ZombieKind KIND = ZombieKind::Runner;
+    static constexpr float SPEED = 70.0f;
+    static constexpr int HEALTH = 60;
+    static constexpr int DAMAGE = 10;
+    static constexpr float SIZE = 14.0f;
+    static constexpr Color COLOR = Color{ 200, 120, 40, 255 };
+    static constexpr float SPAWN_COST = 1.5f;
+    static constexpr int SPAWN_WEIGHT = 20;
+
+    static constexpr float LEAP_MIN_RANGE = 60.0f; // Closer than this it just walks in
+    static constexpr float LEAP_RANGE = 220.0f;
+    static constexpr float LEAP_WINDUP = 0.35f;
+    static constexpr float LEAP_DURATION = 0.3f;
+    static constexpr float LEAP_SPEED = 600.0f;
+    static constexpr float LEAP_COOLDOWN = 2.0f;
 };
 
-class TankZombie : public Zombie {
+// Walks up to the player, lights a short fuse and bursts, hurting everything around it: the
+// player, other zombies and walls. Killed before that, it bursts where it falls.
+struct ExploderZombie {
+    static constexpr ZombieKind KIND = ZombieKind::Exploder;
+    static constexpr float SPEED = 55.0f;
+    static constexpr int HEALTH = 70;
+    static constexpr int DAMAGE = 0; // Hurts through its burst only
+    static constexpr float SIZE = 20.0f;
+    static constexpr Color COLOR = Color{ 150, 170, 40, 255 };
+    static constexpr float SPAWN_COST = 2.0f;
+    static constexpr int SPAWN_WEIGHT = 15;
+
+    static constexpr float FUSE_RANGE = 12.0f; // Gap to the player's body that lights the fuse
+    static constexpr float FUSE_TIME = 0.6f;
+    static constexpr float BURST_RADIUS = 90.0f;
+    static constexpr int BURST_DAMAGE = 45;
+};
+
+// Closes in until it has a clear line to the player within range, then stands and spits, rearing
+// back briefly before each shot (the tell). Spit flies straight and stops at walls.
+struct SpitterZombie {
+    static constexpr ZombieKind KIND = ZombieKind::Spitter;
+    static constexpr float SPEED = 60.0f;
+    static constexpr int HEALTH = 40;
+    static constexpr int DAMAGE = 0; // Hurts through its spit only
+    static constexpr float SIZE = 16.0f;
+    static constexpr Color COLOR = Color{ 120, 70, 150, 255 };
+    static constexpr float SPAWN_COST = 1.5f;
+    static constexpr int SPAWN_WEIGHT = 15;
+
+    static constexpr float SPIT_RANGE = 280.0f;
+    static constexpr float SPIT_WINDUP = 0.25f;
+    static constexpr float SPIT_INTERVAL = 1.6f; // From one spit to when the next windup may start
+    static constexpr float SPIT_SPEED = 300.0f;
+    static constexpr float SPIT_LIFETIME = 1.5f;
+    static constexpr int SPIT_DAMAGE = 8;
+};
+
+// Beyond every archetype's attack range (leap, spit), so a zombie updated at a lower rate is only
+// ever walking towards the player
+constexpr float FAR_UPDATE_DISTANCE = 360.0f;
+static_assert(FAR_UPDATE_DISTANCE > RunnerZombie::LEAP_RANGE && FAR_UPDATE_DISTANCE > SpitterZombie::SPIT_RANGE,
+              "Far zombies must be out of every ranged action's reach");
+
+// Runtime view of the archetypes' constants, indexed by ZombieKind (for spawning and tools)
+struct ZombieArchetype {
+    float speed;
+    int health;
+    int damage;
+    float size;
+    Color color;
+    float spawnCost;
+    int spawnWeight;
+};
+
+template <typename Archetype>
+constexpr ZombieArchetype DescribeArchetype() {
+    return { Archetype::SPEED, Archetype::HEALTH, Archetype::DAMAGE, Archetype::SIZE, Archetype::COLOR,
+             Archetype::SPAWN_COST, Archetype::SPAWN_WEIGHT };
+}
+
+constexpr ZombieArchetype ZOMBIE_ARCHETYPES[ZOMBIE_KIND_COUNT] = {
+    DescribeArchetype<FastZombie>(),
+    DescribeArchetype<TankZombie>(),
+    DescribeArchetype<RunnerZombie>(),
+    DescribeArchetype<ExploderZombie>(),
+    DescribeArchetype<SpitterZombie>(),
+};
+
+template <typename Archetype>
+Zombie SpawnZombie(Vector2 pos) {
+    return Zombie(Archetype::KIND, pos, Archetype::SPEED, Archetype::HEALTH, Archetype::DAMAGE, Archetype::SIZE, Archetype::COLOR);
+}
+
+inline Zombie MakeZombie(ZombieKind kind, Vector2 pos) {
+    const ZombieArchetype& a = ZOMBIE_ARCHETYPES[(int)kind];
+    return Zombie(kind, pos, a.speed, a.health, a.damage, a.size, a.color);
+}
+
+// Draws zombies[indices[0..count)], all of archetype 'kind', through that archetype's kernel
+// (for callers that group zombies themselves, such as the y-sorted DrawList)
+void DrawZombies(Renderer& renderer, const Zombie* zombies, ZombieKind kind, const int* indices, int count,
+                 ZombieDetail detail = ZombieDetail::Full);
+
+// Zombie indices grouped by archetype (ascending within a group, so each batch still walks the
+// list front to back). Rebuilt with one counting pass whenever the list may have changed.
+class ZombieBatches {
 public:
-    TankZombie(Vector2 pos) : Zombie(pos, 40.0f, 200, 20, 25.0f, DARKGREEN) {}
-    // No draw override
+    void build(const Zombie* zombies, int count);
+
+    // One kernel call per archetype over its batch
+    void update(Zombie* zombies, ZombieContext& context) const;
+    void draw(Renderer& renderer, const Zombie* zombies, ZombieDetail detail = ZombieDetail::Full) const;
+
+    int getCount(ZombieKind kind) const { return start[(int)kind + 1] - start[(int)kind]; }
+
+private:
+    int start[ZOMBIE_KIND_COUNT + 1] = {};
+    std::vector<int> indices;
 };
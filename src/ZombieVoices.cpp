@@ -0,0 +1,145 @@
+#include "ZombieVoices.h"
+#include "World.h"
+#include <algorithm>
+#include <cmath>
+
+const float ZOMBIE_SOUND_SECONDS[ZOMBIE_SOUND_COUNT] = { 0.9f, 0.15f, 0.6f };
+
+VoiceScheduler::VoiceScheduler(const Config& config) : config(config), slots(config.maxVoices, { 0.0f, 0.0 }) {
+    pending.reserve(config.maxRequests);
+    starts.reserve(config.maxVoices);
+}
+
+int VoiceScheduler::Priority(ZombieSound sound) {
+    switch (sound) {
+        case ZombieSound::Death: return 3;
+        case ZombieSound::Hit: return 2;
+        default: return 1;
+    }
+}
+
+void VoiceScheduler::request(const VoiceRequest& voice) {
+    current.requested++;
+    if (voice.gain < config.minGain) {
+        current.culled++;
+        return;
+    }
+    // Priority first; gain (at most 1) only orders requests of the same priority
+    float rank = Priority(voice.sound) * 2.0f + voice.gain;
+    if ((int)pending.size() < config.maxRequests) {
+        pending.push_back({ rank, voice });
+        return;
+    }
+    auto lowest = std::min_element(pending.begin(), pending.end(),
+                                   [](const Pending& a, const Pending& b) { return a.rank < b.rank; });
+    current.limited++;
+    if (rank > lowest->rank) *lowest = { rank, voice };
+}
+
+const std::vector<VoiceStart>& VoiceScheduler::schedule(double now) {
+    starts.clear();
+    std::sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) { return a.rank > b.rank; });
+    for (size_t i = 0; i < pending.size(); ++i) {
+        const Pending& p = pending[i];
+        // A free slot, or else the lowest-ranked voice still playing
+        int chosen = -1;
+        for (int s = 0; s < (int)slots.size(); ++s) {
+            if (slots[s].endTime <= now) {
+                chosen = s;
+                break;
+            }
+            if (chosen < 0 || slots[s].rank < slots[chosen].rank) chosen = s;
+        }
+        bool free = chosen >= 0 && slots[chosen].endTime <= now;
+        if (chosen < 0 || (!free && slots[chosen].rank >= p.rank)) {
+            current.limited += (int)(pending.size() - i); // The rest rank no higher
+            break;
+        }
+        if (!free) current.stolen++;
+        float seconds = ZOMBIE_SOUND_SECONDS[(int)p.voice.sound] / std::max(p.voice.pitch, 0.1f);
+        slots[chosen] = { p.rank, now + seconds };
+        starts.push_back({ chosen, p.voice });
+        current.started++;
+    }
+    pending.clear();
+
+    last = current;
+    totals.requested += current.requested;
+    totals.culled += current.culled;
+    totals.limited += current.limited;
+    totals.started += current.started;
+    totals.stolen += current.stolen;
+    current = Stats();
+    return starts;
+}
+
+int VoiceScheduler::getActiveVoices(double now) const {
+    int active = 0;
+    for (const Slot& slot : slots) {
+        if (slot.endTime > now) active++;
+    }
+    return active;
+}
+
+ZombieVoices::ZombieVoices(const Config& config)
+    : config(config), lastTime(0.0f), lastEvaluated(0), lastExamined(0) {
+    nearest.reserve(config.maxSources);
+}
+
+float ZombieVoices::gainAt(float distance) const {
+    if (distance <= config.fullGainDistance) return 1.0f;
+    if (distance >= config.audibleDistance) return 0.0f;
+    float t = 1.0f - (distance - config.fullGainDistance) / (config.audibleDistance - config.fullGainDistance);
+    return t * t; // Falls off quickly at first, then trails away to nothing at the edge
+}
+
+float ZombieVoices::panFor(float offsetX) const {
+    return std::min(std::max(offsetX / config.panWidth, -1.0f), 1.0f);
+}
+
+// Voice by build: big zombies low, small and quick ones high
+static float KindPitch(ZombieKind kind) {
+    switch (kind) {
+        case ZombieKind::Tank: return 0.75f;
+        case ZombieKind::Fast: return 1.15f;
+        case ZombieKind::Runner: return 1.1f;
+        case ZombieKind::Exploder: return 0.9f;
+        case ZombieKind::Spitter: return 1.25f;
+        default: return 1.0f;
+    }
+}
+
+void ZombieVoices::listen(const World& world, Vector2 listener, VoiceScheduler& scheduler) {
+    float window = world.time - lastTime;
+    lastTime = world.time;
+    lastEvaluated = 0;
+    lastExamined = 0;
+    if (window <= 0.0f) return;
+
+    lastExamined = world.zombieGrid.nearest(listener, config.audibleDistance, config.maxSources, nearest);
+    const ZombieList& zombies = world.floor.zombies;
+    const float slack = 1e-4f; // The timers count down in float steps
+    for (const ZombieGrid::Neighbour& n : nearest) {
+        const Zombie& zombie = zombies[n.index];
+        lastEvaluated++;
+
+        ZombieSound sound;
+        if (zombie.currentState == Zombie::ZombieState::DYING) {
+            if (zombie.deathTimer < Zombie::ZOMBIE_DEATH_DURATION - window - slack) continue;
+            sound = ZombieSound::Death;
+        } else if (zombie.hitFlashTimer > 0.0f && zombie.hitFlashTimer >= Zombie::ZOMBIE_HIT_FLASH_DURATION - window - slack) {
+            sound = ZombieSound::Hit;
+        } else {
+            // A period between the two intervals and a phase within it, both from the id
+            uint32_t hash = zombie.id * 2654435761u;
+            float period = config.groanMinInterval + (config.groanMaxInterval - config.groanMinInterval) * ((hash >> 16) & 1023) / 1023.0f;
+            float phase = period * (hash & 0xffff) / 65535.0f;
+            if (std::floor((world.time + phase) / period) == std::floor((world.time - window + phase) / period)) continue;
+            sound = ZombieSound::Groan;
+        }
+
+        uint32_t jitter = (zombie.id * 40503u) >> 8;
+        float pitch = KindPitch(zombie.kind) * (0.92f + 0.16f * (jitter & 255) / 255.0f);
+        scheduler.request({ sound, gainAt(std::sqrt(n.distanceSq)), panFor(zombie.pos.x - listener.x), pitch });
+    }
+}
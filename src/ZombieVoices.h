@@ -0,0 +1,130 @@
+#pragma once
+#include "raylib.h"
+#include "ZombieGrid.h" // ZombieGrid::Neighbour
+#include <cstdint>
+#include <vector>
+
+class World;
+
+// What a zombie can be heard doing
+enum class ZombieSound : uint8_t {
+    Groan, // Now and then while it lives
+    Hit,   // Took damage and lived
+    Death  // Started dying
+};
+constexpr int ZOMBIE_SOUND_COUNT = 3;
+
+// Length of each sound's sample in seconds (the game synthesizes them to exactly this); a voice
+// holds its slot this long at pitch 1
+extern const float ZOMBIE_SOUND_SECONDS[ZOMBIE_SOUND_COUNT];
+
+// One sound a source asks for, already placed relative to the listener
+struct VoiceRequest {
+    ZombieSound sound;
+    float gain;  // Distance attenuation, 0..1
+    float pan;   // -1 full left .. 1 full right
+    float pitch; // Per-source variation around 1
+};
+
+// A voice to start now in 'slot', cutting off whatever the slot was playing
+struct VoiceStart {
+    int slot;
+    VoiceRequest voice;
+};
+
+// Mixer-level voice limiting. Requests are collected over a tick; schedule() culls the ones too
+// quiet to hear, ranks the rest by their sound's priority (death over hit over groan) and then by
+// gain, and starts as many as there are free voice slots, taking over slots whose voices rank
+// lower. The game only calls PlaySound for what schedule() starts, so however many zombies ask,
+// no more than maxVoices ever play at once and the loudest, most important ones are the ones heard.
+class VoiceScheduler {
+public:
+    struct Config {
+        int maxVoices = 12;
+        int maxRequests = 64; // Kept per tick; past this a request only gets in by outranking the lowest
+        float minGain = 0.03f; // Quieter requests are culled
+    };
+
+    // Of the last schedule(), and totals since construction
+    struct Stats {
+        int requested = 0;
+        int culled = 0;  // Too quiet
+        int limited = 0; // Audible, but outranked by requests or playing voices when every slot was taken
+        int started = 0;
+        int stolen = 0;  // Starts that cut off a lower-ranked voice
+    };
+
+    VoiceScheduler() : VoiceScheduler(Config()) {}
+    explicit VoiceScheduler(const Config& config);
+
+    void request(const VoiceRequest& voice);
+
+    // Decides this tick's voices at 'now' (seconds on any steady clock) and clears the requests.
+    // The result stays valid until the next call.
+    const std::vector<VoiceStart>& schedule(double now);
+
+    int getActiveVoices(double now) const; // Slots still playing at 'now'
+    int getMaxVoices() const { return config.maxVoices; }
+    const Stats& getLastStats() const { return last; }
+    const Stats& getTotals() const { return totals; }
+
+    static int Priority(ZombieSound sound);
+
+private:
+    struct Pending {
+        float rank;
+        VoiceRequest voice;
+    };
+    struct Slot {
+        float rank;
+        double endTime;
+    };
+
+    Config config;
+    std::vector<Pending> pending;
+    std::vector<Slot> slots;
+    std::vector<VoiceStart> starts;
+    Stats current;
+    Stats last;
+    Stats totals;
+};
+
+// Listens to the floor's zombies from the player's position each tick. Only the nearest
+// maxSources within earshot are evaluated, found through the World's zombie grid, so a horde of
+// thousands costs the same handful of evaluations as a dozen; anything farther is inaudible anyway.
+// For each, it requests the sounds it made since the last call:
+// - a death when it started dying, a hit when it took damage and lived (read from its death and
+//   hit-flash timers, so the simulation needs no audio hooks)
+// - a groan every few seconds, on a period and phase of its own derived from its id
+// with gain falling off with distance and pan following the horizontal offset.
+class ZombieVoices {
+public:
+    struct Config {
+        float fullGainDistance = 120.0f; // Heard at full volume within this
+        float audibleDistance = 650.0f;  // And not at all beyond it
+        float panWidth = 500.0f;         // Horizontal offset panned fully to one side
+        int maxSources = 32;             // Nearest zombies evaluated per tick
+        float groanMinInterval = 3.0f;
+        float groanMaxInterval = 7.0f;
+    };
+
+    ZombieVoices() : ZombieVoices(Config()) {}
+    explicit ZombieVoices(const Config& config);
+
+    // Requests the sounds heard since the last call, by world time; none when the time went back
+    // (a rewind or a new game)
+    void listen(const World& world, Vector2 listener, VoiceScheduler& scheduler);
+
+    float gainAt(float distance) const;
+    float panFor(float offsetX) const;
+
+    int getLastEvaluated() const { return lastEvaluated; } // Zombies evaluated by the last listen(), at most maxSources
+    int getLastExamined() const { return lastExamined; }   // Zombies the grid search looked at to find them
+
+private:
+    Config config;
+    std::vector<ZombieGrid::Neighbour> nearest;
+    float lastTime;
+    int lastEvaluated;
+    int lastExamined;
+};
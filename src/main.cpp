@@ -1,81 +1,44 @@
 #include "raylib.h"
 #include "Player.h"
 #include "Weapon.h"
-#include "ZombieTypes.h" // Assumed to define FastZombie, TankZombie, etc.
+#include "ZombieTypes.h" // Zombie archetypes and their batched update/draw kernels
 #include "WeaponTypes.h" // Assumed to define CreatePistol, CreateShotgun, CreateRifle, WeaponType enum
 #include <algorithm>
 #include "raymath.h"
 #include <vector>
 #include <memory> // For std::unique_ptr, if you eventually use it for entities
-#include <cstdlib> // For srand, rand
-#include <ctime> // For time (to seed srand)
-#include "CollisionUtils.h" // Assumed to have CollidesWithWallCircle
-#include <string> // Added for std::string usage in DrawGameHUD
+#include <ctime> // For time (to seed the world)
+#include "BulletRenderer.h" // Batched bullet drawing from one baked glow sprite
+#include "HudLayer.h" // Retained HUD with cached text textures
+#include "FloorLayer.h" // Floor background and walls baked into textures; explosions scorch, breaks patch them
+#include "Renderer.h" // Render-command interface (raylib backend here, null backend for headless counting)
+#include "World.h" // Headless game simulation: floor, player, spawning and progression
+#include "WorldCheckpoint.h" // Exact save/restore for floor retries and rewind
+#include "Bot.h" // Scripted player (autopilot and soak tests)
+#include "DrawList.h" // Per-frame y-sorted draw keys, radix-sorted, drawn in runs of one material
+#include "Metrics.h" // Telemetry: frame/step histograms, live counts, heap allocations
+#include "HeapCounter.h"
+#include "QualityGovernor.h" // Frame-time driven quality tiers
+#include "InputEvents.h" // Timestamped input events, folded into each step's PlayerInput
+#include "ZombieVoices.h" // Positional zombie sounds, culled and capped before anything plays
+#include "ZombieAudio.h"
+#ifndef __EMSCRIPTEN__
+#include "MetricsEndpoint.h" // Local Prometheus scrape endpoint (native only)
+#endif
+#include <bitset>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <utility> // For std::move
 
 // --- Constants ---
 const int SCREEN_WIDTH = 1200;
 const int SCREEN_HEIGHT = 800; // Adjusted height for better 16:9 aspect or similar, feel free to change back
 
-const int MAX_FLOORS = 3;
-const int ZOMBIES_PER_FLOOR = 20;
+// Floor count, kills per floor and the horde cap live with the simulation (World.cpp)
 
-// --- Helper Functions ---
-// Clamps a float value between a minimum and maximum
-float ClampFloat(float val, float minVal, float maxVal) {
-    return (val < minVal) ? minVal : (val > maxVal) ? maxVal : val;
-}
-
-// Seeds the random number generator
-void SeedRandom() {
-    srand(static_cast<unsigned>(time(nullptr)));
-}
-
-// Creates a vector of random wall rectangles, ensuring no overlaps
-std::vector<Rectangle> CreateWalls(int targetWallCount = 14) {
-    std::vector<Rectangle> walls;
-    int maxAttemptsPerWall = 100; // Max attempts to place each individual wall
-
-    // Define a clearance area around the player's initial spawn point to ensure walls don't block it
-    // Assuming player starts roughly at SCREEN_WIDTH/2, SCREEN_HEIGHT/2 with radius 20
-    Rectangle playerSpawnClearance = {SCREEN_WIDTH / 2 - 40, SCREEN_HEIGHT / 2 - 40, 80, 80}; 
-
-    for (int i = 0; i < targetWallCount; ++i) {
-        int attempts = 0;
-        bool placed = false;
-        while (attempts < maxAttemptsPerWall && !placed) {
-            float x = static_cast<float>(GetRandomValue(50, SCREEN_WIDTH - 150)); // Avoid edges
-            float y = static_cast<float>(GetRandomValue(50, SCREEN_HEIGHT - 150)); // Avoid edges
-            bool horizontal = GetRandomValue(0, 1);
-            float width = horizontal ? static_cast<float>(GetRandomValue(80, 250)) : 20.0f;
-            float height = horizontal ? 20.0f : static_cast<float>(GetRandomValue(80, 250));
-            Rectangle newWall = { x, y, width, height };
-
-            bool overlaps = false;
-            // Check collision with existing walls
-            for (const auto& existingWall : walls) {
-                if (CheckCollisionRecs(newWall, existingWall)) {
-                    overlaps = true;
-                    break;
-                }
-            }
-
-            // Ensure new walls don't overlap with the player's initial spawn area
-            if (CheckCollisionRecs(newWall, playerSpawnClearance)) {
-                overlaps = true;
-            }
-
-            if (!overlaps) {
-                walls.push_back(newWall);
-                placed = true;
-            }
-            attempts++;
-        }
-        // If 'placed' is false after maxAttemptsPerWall, it means we couldn't place this wall,
-        // so we simply skip it and move to the next wall (if any remaining for targetWallCount).
-    }
-    return walls;
-}
+const double FRAME_SECONDS = 1.0 / 60.0;
+const double INPUT_POLL_SECONDS = 0.001; // Input polling interval while waiting for the next frame (native)
 
 // --- Game States ---
 enum GameState {
@@ -92,7 +55,48 @@ enum GameState {
 void DrawPistolIcon(int x, int y);
 void DrawShotgunIcon(int x, int y);
 void DrawRifleIcon(int x, int y);
+void DrawRailgunIcon(int x, int y);
+void DrawLauncherIcon(int x, int y);
+void DrawMinigunIcon(int x, int y);
+
+
+// Short-lived fireball drawn where a blast went off (the scorch mark itself goes into the FloorLayer)
+struct ExplosionFlash {
+    Vector2 center;
+    float radius;
+    float timer;
+};
+const float EXPLOSION_FLASH_DURATION = 0.3f;
+
+// Keys and clicks pressed since the last frame. The frame pacing polls the input several times a
+// frame, and IsKeyPressed/IsMouseButtonPressed only report presses of the latest poll, so the
+// presses of every poll are collected here for the frame to read.
+struct PressLatch {
+    std::bitset<512> keys;
+    bool click = false;
+
+    void collect() {
+        for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed()) {
+            if (key > 0 && key < (int)keys.size()) keys.set(key);
+        }
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) click = true;
+    }
+    bool key(int key) const { return keys.test(key); }
+    void clear() {
+        keys.reset();
+        click = false;
+    }
+};
 
+// The controls as the devices show them at this poll; dash is a press since the previous poll
+static PlayerInput PollControls() {
+    PlayerInput input = { { 0, 0 }, GetMousePosition(), IsMouseButtonDown(MOUSE_LEFT_BUTTON), IsKeyPressed(KEY_SPACE) };
+    if (IsKeyDown(KEY_W)) input.move.y -= 1;
+    if (IsKeyDown(KEY_S)) input.move.y += 1;
+    if (IsKeyDown(KEY_D)) input.move.x += 1;
+    if (IsKeyDown(KEY_A)) input.move.x -= 1;
+    return input;
+}
 
 // --- Drawing Functions for UI ---
 
@@ -106,15 +110,18 @@ void DrawWeaponSelectionScreen(float time, WeaponType& hoveredWeapon) { // hover
                50, 2, GOLD); // Larger, more prominent title
 
     // Weapon Cards Layout
-    float cardWidth = 300;
+    float cardWidth = 182;
     float cardHeight = 400;
-    float padding = 40;
-    float startX = (SCREEN_WIDTH - (cardWidth * 3 + padding * 2)) / 2;
+    float padding = 10;
+    float startX = (SCREEN_WIDTH - (cardWidth * 6 + padding * 5)) / 2;
     float cardY = 150;
 
     Rectangle pistolRect = {startX, cardY, cardWidth, cardHeight};
     Rectangle shotgunRect = {startX + cardWidth + padding, cardY, cardWidth, cardHeight};
     Rectangle rifleRect = {startX + (cardWidth + padding) * 2, cardY, cardWidth, cardHeight};
+    Rectangle railgunRect = {startX + (cardWidth + padding) * 3, cardY, cardWidth, cardHeight};
+    Rectangle launcherRect = {startX + (cardWidth + padding) * 4, cardY, cardWidth, cardHeight};
+    Rectangle minigunRect = {startX + (cardWidth + padding) * 5, cardY, cardWidth, cardHeight};
 
     // Draw Card UI with highlight if hovered
     auto DrawCard = [&](Rectangle rect, Color baseColor, const char* name, const char* stats[], int statCount, void (*DrawIcon)(int, int), bool isHovered) {
@@ -132,7 +139,7 @@ void DrawWeaponSelectionScreen(float time, WeaponType& hoveredWeapon) { // hover
         DrawRectangleRoundedLines(rect, radius, 10, borderColor); 
 
         // Name of the weapon
-        DrawText(name, rect.x + 20, rect.y + 20, 30, WHITE);
+        DrawText(name, rect.x + 16, rect.y + 20, 26, WHITE);
 
         // Icon (Adjust position for the icons which have their own internal sizing)
         // Icon is centered horizontally within the card
@@ -140,7 +147,7 @@ void DrawWeaponSelectionScreen(float time, WeaponType& hoveredWeapon) { // hover
 
         // Stats list
         for (int i = 0; i < statCount; ++i) {
-            DrawText(stats[i], rect.x + 20, rect.y + 250 + i * 25, 20, LIGHTGRAY);
+            DrawText(stats[i], rect.x + 16, rect.y + 250 + i * 25, 18, LIGHTGRAY);
         }
 
         // Selection Hint, appears only when hovered
@@ -153,6 +160,9 @@ void DrawWeaponSelectionScreen(float time, WeaponType& hoveredWeapon) { // hover
     const char* pistolStats[] = {"FIRE RATE: 3.0/s", "BULLET SPEED: 600", "DAMAGE: 20"}; // From your WeaponTypes.cpp
     const char* shotgunStats[] = {"FIRE RATE: 1.0/s", "BULLET SPEED: 400", "DAMAGE: 50"};
     const char* rifleStats[] = {"FIRE RATE: 5.0/s", "BULLET SPEED: 800", "DAMAGE: 15"};
+    const char* railgunStats[] = {"FIRE RATE: 0.8/s", "HITSCAN, PIERCES 3", "DAMAGE: 120"};
+    const char* launcherStats[] = {"FIRE RATE: 0.7/s", "BLAST RADIUS: 110", "DAMAGE: 80 (AREA)"};
+    const char* minigunStats[] = {"FIRE RATE: 20/s", "BULLET SPEED: 900", "DAMAGE: 5"};
 
     // Determine which weapon card is currently hovered over by the mouse
     Vector2 mouse = GetMousePosition();
@@ -160,6 +170,9 @@ void DrawWeaponSelectionScreen(float time, WeaponType& hoveredWeapon) { // hover
     if (CheckCollisionPointRec(mouse, pistolRect)) currentHoveredWeapon = WeaponType::Pistol;
     else if (CheckCollisionPointRec(mouse, shotgunRect)) currentHoveredWeapon = WeaponType::Shotgun;
     else if (CheckCollisionPointRec(mouse, rifleRect)) currentHoveredWeapon = WeaponType::Rifle;
+    else if (CheckCollisionPointRec(mouse, railgunRect)) currentHoveredWeapon = WeaponType::Railgun;
+    else if (CheckCollisionPointRec(mouse, launcherRect)) currentHoveredWeapon = WeaponType::Launcher;
+    else if (CheckCollisionPointRec(mouse, minigunRect)) currentHoveredWeapon = WeaponType::Minigun;
     else currentHoveredWeapon = hoveredWeapon; // Keep the last hovered weapon if mouse moves off all cards
     hoveredWeapon = currentHoveredWeapon; // Update the reference passed to the function
 
@@ -167,6 +180,9 @@ void DrawWeaponSelectionScreen(float time, WeaponType& hoveredWeapon) { // hover
     DrawCard(pistolRect, SKYBLUE, "1. PISTOL", pistolStats, 3, DrawPistolIcon, hoveredWeapon == WeaponType::Pistol);
     DrawCard(shotgunRect, RED, "2. SHOTGUN", shotgunStats, 3, DrawShotgunIcon, hoveredWeapon == WeaponType::Shotgun);
     DrawCard(rifleRect, GREEN, "3. RIFLE", rifleStats, 3, DrawRifleIcon, hoveredWeapon == WeaponType::Rifle);
+    DrawCard(railgunRect, BLUE, "4. RAILGUN", railgunStats, 3, DrawRailgunIcon, hoveredWeapon == WeaponType::Railgun);
+    DrawCard(launcherRect, ORANGE, "5. LAUNCHER", launcherStats, 3, DrawLauncherIcon, hoveredWeapon == WeaponType::Launcher);
+    DrawCard(minigunRect, GRAY, "6. MINIGUN", minigunStats, 3, DrawMinigunIcon, hoveredWeapon == WeaponType::Minigun);
 
     // Preview Stickman + Weapon at bottom to demonstrate the chosen weapon
     float animOffset = sinf(time * 4) * 5; // Smaller, smoother bounce animation
@@ -193,6 +209,15 @@ void DrawWeaponSelectionScreen(float time, WeaponType& hoveredWeapon) { // hover
         case WeaponType::Rifle:
             DrawRifleIcon(weaponPreviewPos.x, weaponPreviewPos.y);
             break;
+        case WeaponType::Railgun:
+            DrawRailgunIcon(weaponPreviewPos.x, weaponPreviewPos.y);
+            break;
+        case WeaponType::Launcher:
+            DrawLauncherIcon(weaponPreviewPos.x, weaponPreviewPos.y);
+            break;
+        case WeaponType::Minigun:
+            DrawMinigunIcon(weaponPreviewPos.x, weaponPreviewPos.y);
+            break;
         default: 
             DrawPistolIcon(weaponPreviewPos.x, weaponPreviewPos.y); // Fallback to pistol preview
             break;
@@ -200,149 +225,96 @@ void DrawWeaponSelectionScreen(float time, WeaponType& hoveredWeapon) { // hover
 }
 
 
-// Improved In-Game HUD
-void DrawGameHUD(const Player& player, int currentFloor, int maxFloors, int zombiesKilled, int zombiesPerFloor) {
-    // Top Bar Background: Semi-transparent dark bar across the top
-    DrawRectangle(0, 0, SCREEN_WIDTH, 70, ColorAlpha(BLACK, 0.7f)); 
-
-    // Game Title
-    DrawTextEx(GetFontDefault(), "ZOMBIE SURVIVAL", (Vector2){20, 18}, 30, 2, LIME);
-
-    // Floor Progress display
-    DrawTextEx(GetFontDefault(), TextFormat("FLOOR: %d/%d", currentFloor, maxFloors),
-               (Vector2){SCREEN_WIDTH / 2 - 150, 25}, 25, 2, GOLD);
-
-    // Zombies Killed / Remaining (dynamic color based on progress)
-    // Turns green when all zombies for the floor are killed
-    Color zombieCountColor = (zombiesKilled >= zombiesPerFloor) ? GREEN : ORANGE;
-    DrawTextEx(GetFontDefault(), TextFormat("ZOMBIES KILLED: %d/%d", zombiesKilled, zombiesPerFloor),
-               (Vector2){SCREEN_WIDTH / 2 + 50, 25}, 25, 2, zombieCountColor);
-
-
-    // Player Health Bar (Bottom Left)
-    float healthBarWidth = 200;
-    float healthBarHeight = 25;
-    float healthX = 20;
-    float healthY = SCREEN_HEIGHT - 40;
-
-    // Background for health bar
-    DrawRectangle(healthX, healthY, healthBarWidth, healthBarHeight, ColorAlpha(DARKGRAY, 0.8f));
-    // Actual health fill, clamped to prevent drawing outside bounds
-    float currentHealthWidth = ClampFloat(player.health / 100.0f, 0.0f, 1.0f) * healthBarWidth;
-    // Health bar color changes based on remaining health
-    Color healthColor = LIME;
-    if (player.health < 60) healthColor = YELLOW;
-    if (player.health < 30) healthColor = RED;
-    DrawRectangle(healthX, healthY, currentHealthWidth, healthBarHeight, healthColor);
-    // Health bar border
-    DrawRectangleLinesEx({healthX, healthY, healthBarWidth, healthBarHeight}, 2, BLACK);
-    // Health Text overlay
-    DrawTextEx(GetFontDefault(), TextFormat("HP: %d", (int)player.health),
-               (Vector2){healthX + healthBarWidth / 2 - MeasureText(TextFormat("HP: %d", (int)player.health), 20)/2, healthY + 3},
-               20, 2, WHITE);
-
-    // Current Weapon Display (Bottom Right)
-    float weaponDisplayWidth = 180;
-    float weaponDisplayHeight = 25;
-    float weaponX = SCREEN_WIDTH - weaponDisplayWidth - 20;
-    float weaponY = SCREEN_HEIGHT - 40;
-
-    DrawRectangle(weaponX, weaponY, weaponDisplayWidth, weaponDisplayHeight, ColorAlpha(DARKGRAY, 0.8f));
-    // Retrieve weapon name based on type enum
-    std::string weaponName;
-    switch(player.weapon.type) { 
-        case WeaponType::Pistol: weaponName = "Pistol"; break;
-        case WeaponType::Shotgun: weaponName = "Shotgun"; break;
-        case WeaponType::Rifle: weaponName = "Rifle"; break;
-        default: weaponName = "Unknown"; break;
-    }
-    DrawTextEx(GetFontDefault(), TextFormat("WEAPON: %s", weaponName.c_str()),
-               (Vector2){weaponX + 10, weaponY + 3}, 20, 2, RAYWHITE);
-    DrawRectangleLinesEx({weaponX, weaponY, weaponDisplayWidth, weaponDisplayHeight}, 2, BLACK);
-
-
-    // Crosshair (more refined, separated lines)
-    Vector2 mouse = GetMousePosition();
-    float crosshairSize = 15.0f; // Length of each crosshair arm
-    float gap = 3.0f; // Gap from the center
-    Color crosshairColor = RED;
-
-    // Horizontal lines
-    DrawLineEx({mouse.x - crosshairSize, mouse.y}, {mouse.x - gap, mouse.y}, 2, crosshairColor);
-    DrawLineEx({mouse.x + gap, mouse.y}, {mouse.x + crosshairSize, mouse.y}, 2, crosshairColor);
-    // Vertical lines
-    DrawLineEx({mouse.x, mouse.y - crosshairSize}, {mouse.x, mouse.y - gap}, 2, crosshairColor);
-    DrawLineEx({mouse.x, mouse.y + gap}, {mouse.x, mouse.y + crosshairSize}, 2, crosshairColor);
-}
-
-// Draw Game Over Screen
-void DrawGameOverScreen() {
-    ClearBackground(Color{30, 0, 0, 255}); // Dark red background for game over
-
-    // "YOU ARE DEAD!" text with a shadow effect
-    DrawTextEx(GetFontDefault(), "YOU ARE DEAD!",
-               (Vector2){(float)SCREEN_WIDTH / 2 - MeasureText("YOU ARE DEAD!", 80) / 2, SCREEN_HEIGHT / 2 - 80},
-               80, 2, DARKGRAY); // Shadow text
-    DrawTextEx(GetFontDefault(), "YOU ARE DEAD!",
-               (Vector2){(float)SCREEN_WIDTH / 2 - MeasureText("YOU ARE DEAD!", 80) / 2 - 5, SCREEN_HEIGHT / 2 - 85},
-               80, 2, RED); // Main text
-
-    // "GAME OVER" with skull emojis for extra flair
-    DrawTextEx(GetFontDefault(), "💀 GAME OVER 💀",
-               (Vector2){(float)SCREEN_WIDTH / 2 - MeasureText("💀 GAME OVER 💀", 50) / 2, SCREEN_HEIGHT / 2 + 20},
-               50, 2, WHITE);
-    // Restart hint
-    DrawTextEx(GetFontDefault(), "Press R to Restart",
-               (Vector2){(float)SCREEN_WIDTH / 2 - MeasureText("Press R to Restart", 30) / 2, SCREEN_HEIGHT / 2 + 100},
-               30, 2, LIGHTGRAY);
-}
-
-// Draw Game Win Screen
-void DrawGameWinScreen() {
-    ClearBackground(Color{0, 30, 0, 255}); // Dark green background for win
-
-    // "CONGRATULATIONS!" text with a shadow effect
-    DrawTextEx(GetFontDefault(), "CONGRATULATIONS!",
-               (Vector2){(float)SCREEN_WIDTH / 2 - MeasureText("CONGRATULATIONS!", 80) / 2, SCREEN_HEIGHT / 2 - 80},
-               80, 2, DARKGREEN); // Shadow
-    DrawTextEx(GetFontDefault(), "CONGRATULATIONS!",
-               (Vector2){(float)SCREEN_WIDTH / 2 - MeasureText("CONGRATULATIONS!", 80) / 2 - 5, SCREEN_HEIGHT / 2 - 85},
-               80, 2, LIME); // Main
-
-    // "ALL FLOORS CLEARED! YOU WIN!" with trophy emojis
-    DrawTextEx(GetFontDefault(), "🏆 ALL FLOORS CLEARED! YOU WIN! 🏆",
-               (Vector2){(float)SCREEN_WIDTH / 2 - MeasureText("🏆 ALL FLOORS CLEARED! YOU WIN! 🏆", 40) / 2, SCREEN_HEIGHT / 2 + 20},
-               40, 2, GOLD);
-    // Play Again hint
-    DrawTextEx(GetFontDefault(), "Press R to Play Again",
-               (Vector2){(float)SCREEN_WIDTH / 2 - MeasureText("Press R to Play Again", 30) / 2, SCREEN_HEIGHT / 2 + 100},
-               30, 2, LIGHTGRAY);
-}
+// In-game HUD and the game over / win screens are drawn by HudLayer (HudLayer.cpp),
+// which caches their text in textures and only re-renders it when the shown value changes.
 
 
 // --- Main Game Loop ---
-int main() {
+// Options: --metrics-file <path> appends a telemetry snapshot every 10 s to a rolling file;
+// --metrics-port <port> serves it at http://127.0.0.1:<port>/metrics (native builds)
+int main(int argc, char** argv) {
+    const char* metricsFile = nullptr;
+    int metricsPort = -1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--metrics-file") == 0) metricsFile = argv[i + 1];
+        else if (strcmp(argv[i], "--metrics-port") == 0) metricsPort = atoi(argv[i + 1]);
+    }
+
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "🧟 Zombie Survival");
     
     // ADDED: Initialize the audio device right after window creation
     InitAudioDevice(); 
 
-    SetTargetFPS(60);
-    SeedRandom(); // Use the refined seeding function
+#ifdef __EMSCRIPTEN__
+    SetTargetFPS(60); // The browser paces frames; input arrives once per frame
+#endif
+    // Natively the loop paces itself after EndDrawing, polling the input while it waits
+
+    // Bake the bullet glow sprite once; needs the GL context created by InitWindow
+    RaylibRenderer renderer; // All gameplay drawing goes through this
+    BulletRenderer bulletRenderer;
+    bulletRenderer.load();
+    HudLayer hud(SCREEN_WIDTH, SCREEN_HEIGHT);
+    FloorLayer floorLayer(SCREEN_WIDTH, SCREEN_HEIGHT);
+    int floorLayerFloor = 0; // Floor whose scorch marks the layer holds
+    std::vector<ExplosionFlash> explosionFlashes;
+    bool showRenderStats = false; // Toggled with F1
+    bool autopilot = false;       // Toggled with F3: the soak-test bot plays through the same PlayerInput
+    QualityGovernor quality;      // F4 cycles AUTO and each tier locked
+    ZombieVoices zombieVoices;    // The nearest zombies' groans, hits and deaths, heard from the player
+    VoiceScheduler voiceScheduler;
+    ZombieAudio zombieAudio(voiceScheduler.getMaxVoices());
 
     GameState gameState = SELECTING_WEAPON;
 
     // Game variables - FIX: Initialize selectedWeapon and player immediately
     // CORRECTED: Use std::move() when initializing player with selectedWeapon
     Weapon selectedWeapon = CreatePistol(); // Create the weapon (lvalue)
-    Player player({ (float)SCREEN_WIDTH / 2, (float)SCREEN_HEIGHT / 2 }, { 1, 0 }, 20.0f, 100, std::move(selectedWeapon));
-    
-    std::vector<Rectangle> walls;
-    std::vector<Zombie> zombies;
-    float spawnTimer;
-    float spawnInterval;
-    int currentFloor;
-    int zombiesKilled;
+
+    // The simulation owns the player and the current floor; these references stay valid across restarts
+    World world((float)SCREEN_WIDTH, (float)SCREEN_HEIGHT);
+    Player& player = world.player;
+    const ZombieList& zombies = world.floor.zombies;
+    DrawList drawList; // Refilled and sorted each frame
+    int drawRuns = 0;
+    double drawSortMs = 0.0;
+
+    // Telemetry, recorded every frame whether or not anything exports it
+    MetricsRegistry metrics;
+    WorldMetrics worldMetrics(metrics);
+    LatencyHistogram& frameTime = metrics.histogram("zh_frame_seconds", "Frame time (frame start to frame start)");
+    LatencyHistogram& clickToFlash = metrics.histogram("zh_click_to_flash_seconds",
+                                                       "Fire press to the end of the frame that drew its muzzle flash");
+    MetricGauge& qualityTier = metrics.gauge("zh_quality_tier", "Quality tier (0 = full, 3 = minimal)");
+    MetricCounter& qualityChanges = metrics.counter("zh_quality_changes_total", "Quality tier changes made by the governor");
+    MetricGauge& audioVoices = metrics.gauge("zh_audio_voices", "Zombie voices playing");
+    MetricCounter& audioStarted = metrics.counter("zh_audio_voices_started_total", "Zombie voices started by the scheduler");
+    std::unique_ptr<MetricsFileWriter> metricsWriter;
+    if (metricsFile) metricsWriter.reset(new MetricsFileWriter(metrics, metricsFile, 10.0, 4 * 1024 * 1024));
+#ifndef __EMSCRIPTEN__
+    MetricsEndpoint metricsEndpoint(metrics);
+    if (metricsPort >= 0) metricsEndpoint.open((uint16_t)metricsPort);
+#endif
+
+    // Input: every poll queues what changed, stamped with its time; each step consumes the events
+    // of the time it covers, so shots are timed at the press instead of at the frame
+    InputEventQueue inputQueue;
+    InputRecorder inputRecorder(inputQueue);
+    InputTimeline inputTimeline;
+    PressLatch pressed;
+    int inputPolls = 0, inputPollsLastFrame = 0;
+    double pendingPressTime = -1.0; // A press whose shot this frame draws
+    auto pollInput = [&]() {
+        pressed.collect();
+        inputRecorder.record(GetTime(), PollControls());
+        inputPolls++;
+    };
+
+    // Exact copies of the world: the start of the current floor (for "retry floor" after dying)
+    // and the last few seconds of play (hold Backspace to rewind)
+    WorldCheckpoint floorStart;
+    RewindBuffer rewindBuffer(5.0f, 0.1f);
+    Bot bot(static_cast<uint64_t>(time(nullptr)));
 
     // For weapon selection screen
     float uiTime = 0.0f; // Separate time for UI animations
@@ -356,24 +328,38 @@ int main() {
         // destructor will be called (if defined), which should unload its sound.
         // The new Weapon object will then load its sound in its constructor.
         // CORRECTED: Use std::move() when re-initializing player with selectedWeapon
-        player = Player({ (float)SCREEN_WIDTH / 2, (float)SCREEN_HEIGHT / 2 }, { 1, 0 }, 20.0f, 100, std::move(selectedWeapon));
-
-        walls = CreateWalls(14); // Regenerate walls for each new floor/game
-        zombies.clear(); // Clear any existing zombies
-        spawnTimer = 0.0f;
-        spawnInterval = 2.0f; // Initial spawn interval
-        currentFloor = 1;
-        zombiesKilled = 0;
-
-        // Reset random seed for reproducible wall layouts or specific map seeds if desired
-        // srand(static_cast<unsigned>(time(nullptr))); 
+        // A fresh seed per game: every wall layout and spawn comes from the world's own RNG
+        world.start(std::move(selectedWeapon), static_cast<uint64_t>(time(nullptr)));
+        SaveCheckpoint(world, floorStart);
+        rewindBuffer.clear();
+        floorLayer.invalidate();
+        explosionFlashes.clear();
     };
 
     InitializeGame(); // Call once at the beginning to set up initial game state
 
+    double lastFrameStart = GetTime();
     while (!WindowShouldClose()) {
-        float deltaTime = GetFrameTime();
+        auto frameStart = std::chrono::steady_clock::now();
+        double frameStartTime = GetTime();
+        float deltaTime = (float)(frameStartTime - lastFrameStart); // On the clock the input events are stamped with
+        PlayerInput controls = inputTimeline.consume(inputQueue, lastFrameStart, frameStartTime);
+        lastFrameStart = frameStartTime;
         uiTime += deltaTime; // Update UI animation time
+        frameTime.record((uint64_t)(deltaTime * 1e9f));
+
+        if (pressed.key(KEY_F1)) showRenderStats = !showRenderStats;
+        if (pressed.key(KEY_F2)) world.setHordeMode(!world.hordeMode); // Stress spawning up to World::HORDE_MAX_ALIVE
+        if (pressed.key(KEY_F3)) autopilot = !autopilot;
+        if (pressed.key(KEY_F4)) {
+            // AUTO -> FULL -> REDUCED -> LOW -> MINIMAL -> AUTO
+            if (!quality.isLocked()) quality.lock(QualityTier::Full);
+            else if (quality.getTier() == QualityTier::Minimal) quality.unlock();
+            else quality.lock((QualityTier)((int)quality.getTier() + 1));
+        }
+        QualitySettings qualitySettings = quality.getSettings();
+        world.farZombieUpdateStride = qualitySettings.farZombieUpdateStride;
+        floorLayer.setShading(qualitySettings.floorShading);
 
         BeginDrawing();
 
@@ -383,149 +369,158 @@ int main() {
 
                 // Handle weapon selection inputs (keyboard and mouse click on hovered card)
                 // If a key (1, 2, 3) is pressed OR the left mouse button is pressed while hovering over a card
-                if (IsKeyPressed(KEY_ONE) || (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && hoveredWeapon == WeaponType::Pistol)) {
+                if (pressed.key(KEY_ONE) || (pressed.click && hoveredWeapon == WeaponType::Pistol)) {
                     selectedWeapon = CreatePistol();
                     InitializeGame(); // Re-initialize game state, but retain the chosen weapon
                     gameState = PLAYING;
                 }
-                if (IsKeyPressed(KEY_TWO) || (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && hoveredWeapon == WeaponType::Shotgun)) {
+                if (pressed.key(KEY_TWO) || (pressed.click && hoveredWeapon == WeaponType::Shotgun)) {
                     selectedWeapon = CreateShotgun();
                     InitializeGame();
                     gameState = PLAYING;
                 }
-                if (IsKeyPressed(KEY_THREE) || (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && hoveredWeapon == WeaponType::Rifle)) {
+                if (pressed.key(KEY_THREE) || (pressed.click && hoveredWeapon == WeaponType::Rifle)) {
                     selectedWeapon = CreateRifle();
                     InitializeGame();
                     gameState = PLAYING;
                 }
-                break;
-
-            case PLAYING: {
-                // Dungeon floor: dark concrete/stone background
-                ClearBackground(Color{ 35, 30, 25, 255 }); 
-
-                // Add subtle grid lines for stone tiles to give it a dungeon feel
-                int gridSize = 100; // Size of each "tile"
-                Color gridColor = ColorAlpha(Color{50, 45, 40, 255}, 0.5f); // Darker, semi-transparent lines
-
-                for (int x = 0; x < SCREEN_WIDTH; x += gridSize) {
-                    DrawLine(x, 0, x, SCREEN_HEIGHT, gridColor);
+                if (pressed.key(KEY_FOUR) || (pressed.click && hoveredWeapon == WeaponType::Railgun)) {
+                    selectedWeapon = CreateRailgun();
+                    InitializeGame();
+                    gameState = PLAYING;
                 }
-                for (int y = 0; y < SCREEN_HEIGHT; y += gridSize) {
-                    DrawLine(0, y, SCREEN_WIDTH, y, gridColor);
+                if (pressed.key(KEY_FIVE) || (pressed.click && hoveredWeapon == WeaponType::Launcher)) {
+                    selectedWeapon = CreateLauncher();
+                    InitializeGame();
+                    gameState = PLAYING;
                 }
-
-                // Add a subtle vignette effect around the edges for atmosphere
-                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT / 4, ColorAlpha(BLACK, 0.4f)); // Top fade
-                DrawRectangle(0, SCREEN_HEIGHT - SCREEN_HEIGHT / 4, SCREEN_WIDTH, SCREEN_HEIGHT / 4, ColorAlpha(BLACK, 0.4f)); // Bottom fade
-                DrawRectangle(0, 0, SCREEN_WIDTH / 4, SCREEN_HEIGHT, ColorAlpha(BLACK, 0.4f)); // Left fade
-                DrawRectangle(SCREEN_WIDTH - SCREEN_WIDTH / 4, 0, SCREEN_WIDTH / 4, SCREEN_HEIGHT, ColorAlpha(BLACK, 0.4f)); // Right fade
-
-
-                // Input Handling for player movement
-                Vector2 move = { 0, 0 };
-                if (IsKeyDown(KEY_W)) move.y -= 1;
-                if (IsKeyDown(KEY_S)) move.y += 1;
-                if (IsKeyDown(KEY_D)) move.x += 1;
-                if (IsKeyDown(KEY_A)) move.x -= 1;
-                if (Vector2Length(move) > 0) move = Vector2Normalize(move); // Normalize diagonal movement
-
-                float moveSpeed = 200.0f;
-                Vector2 newPlayerPos = Vector2Add(player.pos, Vector2Scale(move, moveSpeed * deltaTime));
-
-                // Check for wall collisions before updating player position
-                if (!CollidesWithWallCircle(newPlayerPos, player.size, walls)) {
-                    player.pos = newPlayerPos;
+                if (pressed.key(KEY_SIX) || (pressed.click && hoveredWeapon == WeaponType::Minigun)) {
+                    selectedWeapon = CreateMinigun();
+                    InitializeGame();
+                    gameState = PLAYING;
                 }
+                break;
 
-                // Player facing direction towards mouse
-                Vector2 mouse = GetMousePosition();
-                player.facing = Vector2Normalize(Vector2Subtract(mouse, player.pos));
-
-                // Shooting with left mouse button
-                if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
-                    player.shoot(GetTime());
+            case PLAYING: {
+                // Dungeon floor (stone, tile lines, vignette) with this floor's scorch marks, one quad
+                if (world.currentFloor != floorLayerFloor) {
+                    floorLayer.invalidate(); // New floor (or rewound onto another one): clean stone
+                    floorLayerFloor = world.currentFloor;
                 }
-
-                // Zombie Spawning Logic
-                spawnTimer += deltaTime;
-                if (spawnTimer >= spawnInterval && (int)zombies.size() < ZOMBIES_PER_FLOOR) {
-                    spawnTimer = 0.0f;
-                    // Make zombies spawn randomly around the screen edges
-                    Vector2 spawnPos;
-                    int side = GetRandomValue(0, 3); // 0: top, 1: bottom, 2: left, 3: right
-                    switch (side) {
-                        case 0: spawnPos = { (float)GetRandomValue(0, SCREEN_WIDTH), -50.0f }; break; // Top edge, slightly off-screen
-                        case 1: spawnPos = { (float)GetRandomValue(0, SCREEN_WIDTH), (float)SCREEN_HEIGHT + 50.0f }; break; // Bottom edge
-                        case 2: spawnPos = { -50.0f, (float)GetRandomValue(0, SCREEN_HEIGHT) }; break; // Left edge
-                        case 3: spawnPos = { (float)SCREEN_WIDTH + 50.0f, (float)GetRandomValue(0, SCREEN_HEIGHT) }; break; // Right edge
+                floorLayer.draw(renderer);
+
+
+                // Input Handling: the simulation only sees this step's PlayerInput, folded from the
+                // input events since the last frame
+                PlayerInput input = autopilot ? bot.think(world) : controls;
+
+                if (IsKeyDown(KEY_BACKSPACE)) {
+                    rewindBuffer.stepBack(world); // One checkpoint (0.1 s) back per frame while held
+                    floorLayer.invalidateWalls(); // Broken walls may be standing again
+                } else {
+                    // Movement, shooting, spawning, zombie AI, kills and floor progression
+                    auto stepStart = std::chrono::steady_clock::now();
+                    float lastFireTime = player.weapon.lastFireTime;
+                    world.step(deltaTime, input);
+                    if (!autopilot && inputTimeline.getLastPressTime() >= 0.0 && player.weapon.lastFireTime != lastFireTime) {
+                        pendingPressTime = inputTimeline.getLastPressTime(); // This frame shows the press's muzzle flash
                     }
-
-                    // Randomly spawn Fast or Tank zombies
-                    if (GetRandomValue(0, 1) == 0)
-                        zombies.emplace_back(FastZombie(spawnPos));
-                    else
-                        zombies.emplace_back(TankZombie(spawnPos));
-                }
-
-                // Update entities (player, zombies)
-                player.update(deltaTime, zombies, walls);
-                for (auto& zombie : zombies) {
-                    zombie.update(player.pos, deltaTime, walls, player.health); // Passing player.health might be for zombie AI
-                }
-
-                // Remove dead zombies and update kill count
-                int zombiesBeforeErase = (int)zombies.size();
-                zombies.erase(std::remove_if(zombies.begin(), zombies.end(), [](const Zombie& z) { return z.isDead(); }), zombies.end());
-                zombiesKilled += (zombiesBeforeErase - (int)zombies.size());
-
-                // Check for floor completion
-                if (zombiesKilled >= ZOMBIES_PER_FLOOR) {
-                    if (currentFloor < MAX_FLOORS) {
-                        // Advance to next floor
-                        zombiesKilled = 0;
-                        currentFloor++;
-                        zombies.clear(); // Clear existing zombies
-                        walls = CreateWalls(14); // Generate new walls for the next floor
-                        spawnInterval *= 0.9f; // Make next floor harder (faster spawns)
-                        if (spawnInterval < 0.5f) spawnInterval = 0.5f; // Cap minimum spawn interval
-                        // Replenish player health slightly for reaching a new floor
-                        player.health = ClampFloat(player.health + 20, 0, 100);
-                    } else {
-                        gameState = GAME_WIN; // All floors cleared, player wins
+                    auto stepTime = std::chrono::steady_clock::now() - stepStart;
+                    worldMetrics.stepTime.record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(stepTime).count());
+                    worldMetrics.steps.add();
+                    for (const Explosion& explosion : world.explosions) {
+                        floorLayer.scorch(explosion.center, explosion.radius);
+                        explosionFlashes.push_back({ explosion.center, explosion.radius, EXPLOSION_FLASH_DURATION });
                     }
+                    for (const Rectangle& area : world.wallChanges) floorLayer.redrawWalls(renderer, world.floor, area);
+                    rewindBuffer.record(world);
+                    if (world.currentFloor != floorStart.scalars.currentFloor) SaveCheckpoint(world, floorStart); // Reached a new floor
                 }
 
-                // Draw game elements
-                for (const auto& wall : walls) {
-                    // Wall Design Improvement: Add a subtle shadow and inner detail for a more realistic look
-                    float shadowOffset = 4.0f;
-                    float detailInset = 5.0f; // For inner detail
-
-                    // Draw shadow (slightly offset, darker color)
-                    DrawRectangleRounded({wall.x + shadowOffset, wall.y + shadowOffset, wall.width, wall.height}, 0.3f, 5, ColorAlpha(BLACK, 0.5f));
-
-                    // Draw main wall body (a grungier, brownish-grey for concrete/stone)
-                    DrawRectangleRounded(wall, 0.3f, 5, Color{90, 80, 70, 255}); 
+                // What the player hears of the zombies this frame (nothing while rewinding)
+                zombieVoices.listen(world, player.pos, voiceScheduler);
+                zombieAudio.play(voiceScheduler.schedule(GetTime()));
+                audioStarted.add(voiceScheduler.getLastStats().started);
 
-                    // Draw inner detail (simulates bricks/texture or lighter worn areas)
-                    // Smaller rectangle slightly lighter
-                    DrawRectangleRounded({wall.x + detailInset, wall.y + detailInset, wall.width - 2 * detailInset, wall.height - 2 * detailInset}, 0.2f, 5, Color{110, 100, 90, 255});
+                // Draw game elements
+                floorLayer.drawWalls(renderer, world.floor); // Baked with their damage; patched where they changed
 
-                    // Draw a subtle dark border to define the shape more clearly
-                    DrawRectangleRoundedLines(wall, 0.3f, 5, Color{60, 50, 40, 255}); 
+                // Player and zombies back to front by where their feet are; the projectile layers on top
+                drawList.clear();
+                drawList.add(DrawLayer::Entities, player.pos.y + player.size, DrawMaterial::Player, 0);
+                for (int i = 0; i < (int)zombies.size(); ++i) {
+                    drawList.add(DrawLayer::Entities, zombies[i].pos.y + zombies[i].size, zombies[i].kind, (uint32_t)i);
                 }
-
-                player.draw(); // Draws player and their bullets
-
-                for (const auto& zombie : zombies)
-                    zombie.draw();
+                drawList.add(DrawLayer::Projectiles, 0.0f, DrawMaterial::Bullets, 0);
+                drawList.add(DrawLayer::Projectiles, 0.0f, DrawMaterial::Spit, 0);
+                double sortStart = GetTime();
+                drawList.sort();
+                drawSortMs = (GetTime() - sortStart) * 1000.0;
+
+                drawRuns = 0;
+                drawList.forEachRun([&](DrawMaterial material, const int* items, int count) {
+                    drawRuns++;
+                    switch (material) {
+                        case DrawMaterial::Player: player.draw(renderer); break; // Player, weapon and muzzle flash
+                        case DrawMaterial::Bullets: bulletRenderer.draw(renderer, player.bullets); break; // Whole layer in one batch
+                        case DrawMaterial::Spit: bulletRenderer.drawSpit(renderer, world.enemyProjectiles); break; // Same atlas, same batch
+                        default: DrawZombies(renderer, zombies.data(), (ZombieKind)material, items, count, qualitySettings.zombieDetail); break; // One archetype kernel per run
+                    }
+                });
+
+                // Fireballs: flash at full size, then shrink and fade
+                for (ExplosionFlash& flash : explosionFlashes) {
+                    float t = flash.timer / EXPLOSION_FLASH_DURATION; // 1 -> 0
+                    renderer.drawCircle(flash.center, flash.radius * (0.4f + 0.6f * t), ColorAlpha(ORANGE, 0.5f * t));
+                    if (qualitySettings.explosionDetail) renderer.drawCircle(flash.center, flash.radius * 0.4f * t, ColorAlpha(YELLOW, 0.8f * t));
+                    flash.timer -= deltaTime;
+                }
+                explosionFlashes.erase(std::remove_if(explosionFlashes.begin(), explosionFlashes.end(),
+                    [](const ExplosionFlash& f) { return f.timer <= 0; }), explosionFlashes.end());
 
                 // Draw the improved in-game HUD
-                DrawGameHUD(player, currentFloor, MAX_FLOORS, zombiesKilled, ZOMBIES_PER_FLOOR);
+                hud.drawGameHUD(renderer, player, world.currentFloor, World::MAX_FLOORS, world.zombiesKilled, World::ZOMBIES_PER_FLOOR);
+
+                if (autopilot) DrawText("AUTOPILOT (F3)", SCREEN_WIDTH - 200, 20, 20, YELLOW);
+
+                if (showRenderStats) {
+                    const BulletRenderer::FrameStats& bulletStats = bulletRenderer.getStats();
+                    DrawText(TextFormat("BULLETS: %d  QUADS: %d  CPU: %.3f ms", bulletStats.bulletsDrawn,
+                                        bulletStats.quadsSubmitted, bulletStats.cpuMs),
+                             20, 80, 20, RAYWHITE);
+                    const FloorArena::Stats& arenaStats = world.floor.arena.getStats();
+                    DrawText(TextFormat("FLOOR ARENA: %zu allocs  %zu / %zu bytes  %zu overflow", arenaStats.allocations,
+                                        arenaStats.bytesAllocated, world.floor.arena.getCapacity(), arenaStats.overflowBytes),
+                             20, 105, 20, RAYWHITE);
+                    const WaveDirector::Stats& waveStats = world.waveDirector.getStats();
+                    DrawText(TextFormat("WAVE%s: %d alive  %d spawn points  burst %d (peak %d)", world.hordeMode ? " (HORDE)" : "",
+                                        (int)zombies.size(), waveStats.spawnPoints, waveStats.lastBurst, waveStats.peakBurst),
+                             20, 130, 20, RAYWHITE);
+                    DrawText(TextFormat("DRAW LIST: %d items  %d runs  sort %.3f ms", drawList.getCount(), drawRuns, drawSortMs),
+                             20, 155, 20, RAYWHITE);
+                    DrawText(TextFormat("TELEMETRY: step p50 %.3f ms  p99 %.3f ms  frame p99 %.1f ms  heap %llu allocs",
+                                        worldMetrics.stepTime.percentileNs(0.50) / 1e6, worldMetrics.stepTime.percentileNs(0.99) / 1e6,
+                                        frameTime.percentileNs(0.99) / 1e6, (unsigned long long)HeapAllocationCount()),
+                             20, 180, 20, RAYWHITE);
+                    DrawText(TextFormat("QUALITY (F4): %s%s  frame %.1f / %.1f ms  %d changes  upgrade hold %.0f s",
+                                        QualityTierName(quality.getTier()), quality.isLocked() ? " (LOCKED)" : " (AUTO)",
+                                        quality.getSmoothedMs(), quality.getBudgetMs(), quality.getChanges(), quality.getUpgradeHold()),
+                             20, 205, 20, RAYWHITE);
+                    DrawText(TextFormat("INPUT: click to flash p50 %.1f ms  p99 %.1f ms  %d polls/frame  %d dropped",
+                                        clickToFlash.percentileNs(0.50) / 1e6, clickToFlash.percentileNs(0.99) / 1e6,
+                                        inputPollsLastFrame, inputRecorder.getDropped()),
+                             20, 230, 20, RAYWHITE);
+                    const VoiceScheduler::Stats& voices = voiceScheduler.getTotals();
+                    DrawText(TextFormat("AUDIO: %d/%d voices  %d zombies evaluated  %d started  %d culled  %d limited",
+                                        voiceScheduler.getActiveVoices(GetTime()), voiceScheduler.getMaxVoices(),
+                                        zombieVoices.getLastEvaluated(), voices.started, voices.culled, voices.limited),
+                             20, 255, 20, RAYWHITE);
+                }
 
-                // Check for game over condition
-                if (player.health <= 0) {
+                // Check for the end of the game (decided by this frame's step)
+                if (world.status == World::Status::WON) {
+                    gameState = GAME_WIN; // All floors cleared, player wins
+                } else if (world.status == World::Status::LOST) {
                     gameState = GAME_OVER;
                 }
 
@@ -533,25 +528,77 @@ int main() {
             }
 
             case GAME_OVER:
-                DrawGameOverScreen(); // Display game over screen
-                if (IsKeyPressed(KEY_R)) {
+                hud.drawGameOverScreen(renderer); // Display game over screen
+                if (pressed.key(KEY_R)) {
                     InitializeGame(); // Reset game state
                     gameState = SELECTING_WEAPON; // Go back to weapon selection
+                } else if (pressed.key(KEY_F)) {
+                    RestoreCheckpoint(world, floorStart); // Retry the floor as it was when reached
+                    rewindBuffer.clear();
+                    floorLayer.invalidate();
+                    gameState = PLAYING;
+                } else if (pressed.key(KEY_BACKSPACE) && rewindBuffer.rewind(world, 3.0f)) {
+                    floorLayer.invalidateWalls();
+                    gameState = PLAYING; // Back to a few seconds before the fatal hit
                 }
                 break;
 
             case GAME_WIN:
-                DrawGameWinScreen(); // Display game win screen
-                if (IsKeyPressed(KEY_R)) {
+                hud.drawGameWinScreen(renderer); // Display game win screen
+                if (pressed.key(KEY_R)) {
                     InitializeGame(); // Reset game state
                     gameState = SELECTING_WEAPON; // Go back to weapon selection
                 }
                 break;
         }
 
+        // The governor sees the frame's CPU work; waiting for vsync isn't load. A frame that missed
+        // its vsync anyway (GPU-bound, or a browser throttling us) counts at its full length.
+        float workMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        float frameMs = deltaTime * 1000.0f > 1.5f * quality.getBudgetMs() ? deltaTime * 1000.0f : workMs;
+        if (gameState == PLAYING && quality.update(frameMs, deltaTime)) qualityChanges.add();
+
+        pressed.clear(); // This frame has read its presses; EndDrawing polls the next ones
         EndDrawing();
+        pollInput();
+        if (pendingPressTime >= 0.0) {
+            clickToFlash.record((uint64_t)((GetTime() - pendingPressTime) * 1e9));
+            pendingPressTime = -1.0;
+        }
+
+        // Live counts once per frame; the exporters only format them when a snapshot is due
+        worldMetrics.zombies.set((double)zombies.size());
+        worldMetrics.bullets.set((double)player.bullets.size());
+        worldMetrics.enemyProjectiles.set((double)world.enemyProjectiles.getCount());
+        worldMetrics.arenaBytes.set((double)world.floor.arena.getStats().bytesAllocated);
+        worldMetrics.arenaAllocations.set((double)world.floor.arena.getStats().allocations);
+        worldMetrics.heapAllocations.raiseTo(HeapAllocationCount());
+        qualityTier.set((double)quality.getTier());
+        audioVoices.set((double)voiceScheduler.getActiveVoices(GetTime()));
+        if (metricsWriter) metricsWriter->poll(GetTime());
+#ifndef __EMSCRIPTEN__
+        metricsEndpoint.poll();
+
+        // Pace to 60 FPS here rather than in EndDrawing: sleep in short slices and poll the input
+        // after each, so a press is stamped within about a millisecond of happening instead of
+        // at the next frame
+        double nextFrame = frameStartTime + FRAME_SECONDS;
+        for (double now = GetTime(); now < nextFrame; now = GetTime()) {
+            WaitTime(std::min(INPUT_POLL_SECONDS, nextFrame - now));
+            PollInputEvents();
+            pollInput();
+        }
+#endif
+        inputPollsLastFrame = inputPolls;
+        inputPolls = 0;
     }
     
+    // Release GPU resources while the GL context still exists
+    bulletRenderer.unload();
+    hud.unload();
+    floorLayer.unload();
+    zombieAudio.unload();
+
     // ADDED: Close the audio device before closing the window
     CloseAudioDevice(); 
     CloseWindow();